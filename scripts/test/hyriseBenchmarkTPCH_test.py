@@ -146,6 +146,28 @@ def main():
     close_benchmark(benchmark)
     check_exit_status(benchmark)
 
+    # Run TPC-H with calibrated cost model coefficients, so that join and aggregate operators are chosen by cost, and
+    # verify the results with SQLite.
+    coefficients_filename = f"{build_dir}/cost_model_coefficients.json"
+    with open(coefficients_filename, "w") as f:
+        json.dump({"feature_costs": {"HashBuildRows": 20.0, "HashProbeRows": 12.0}}, f)
+
+    arguments = {}
+    arguments["--scale"] = ".01"
+    arguments["--queries"] = "'3,5,18'"
+    arguments["--runs"] = "1"
+    arguments["--verify"] = "true"
+    arguments["--dont_cache_binary_tables"] = "true"
+    arguments["--cost_model_coefficients"] = coefficients_filename
+
+    benchmark = run_benchmark(build_dir, arguments, "hyriseBenchmarkTPCH", True)
+
+    benchmark.expect_exact(f"Using the cost model coefficients from '{coefficients_filename}'")
+    benchmark.expect_exact("Benchmarking Queries: [ 3, 5, 18 ]")
+
+    close_benchmark(benchmark)
+    check_exit_status(benchmark)
+
     # Run TPC-H and create query plan visualizations. Test that pruning works end-to-end, that is from the command line
     # parameter all the way to the visualizer.
     arguments = {}
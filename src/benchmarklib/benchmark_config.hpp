@@ -42,6 +42,9 @@ class BenchmarkConfig {
   bool verify = false;
   bool cache_binary_tables = false;  // Defaults to false for internal use, but the CLI sets it to true by default
   bool metrics = false;
+  // JSON file with the calibrated coefficients of the CostEstimatorPhysical (see CostModelCalibration), loaded by the
+  // BenchmarkRunner
+  std::optional<std::string> cost_model_coefficients_file_path = std::nullopt;
 
  private:
   BenchmarkConfig() = default;
@@ -131,10 +131,18 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
     std::cout << "- Not tracking SQL metrics" << std::endl;
   }
 
-  return BenchmarkConfig{
+  auto config = BenchmarkConfig{
       benchmark_mode,  chunk_size,          *encoding_config, indexes, max_runs, timeout_duration,
       warmup_duration, output_file_path,    enable_scheduler, cores,   clients,  enable_visualization,
       verify,          cache_binary_tables, metrics};
+
+  const auto cost_model_coefficients_file_path = parse_result["cost_model_coefficients"].as<std::string>();
+  if (!cost_model_coefficients_file_path.empty()) {
+    config.cost_model_coefficients_file_path = cost_model_coefficients_file_path;
+    std::cout << "- Using the cost model coefficients from '" << cost_model_coefficients_file_path << "'" << std::endl;
+  }
+
+  return config;
 }
 
 EncodingConfig CLIConfigParser::parse_encoding_config(const std::string& encoding_file_str) {
@@ -535,44 +535,44 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCCTableGenerator::generate
 
 void TPCCTableGenerator::_add_constraints(
     std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const {
+  // Unlike the other benchmarks, TPC-C modifies its tables. Thus, the primary keys are enforced.
   const auto& warehouse_table = table_info_by_name.at("WAREHOUSE").table;
-  warehouse_table->add_soft_key_constraint(
-      {{warehouse_table->column_id_by_name("W_ID")}, KeyConstraintType::PRIMARY_KEY});
+  warehouse_table->add_key_constraint({{warehouse_table->column_id_by_name("W_ID")}, KeyConstraintType::PRIMARY_KEY});
 
   const auto& district_table = table_info_by_name.at("DISTRICT").table;
-  district_table->add_soft_key_constraint(
+  district_table->add_key_constraint(
       {{district_table->column_id_by_name("D_W_ID"), district_table->column_id_by_name("D_ID")},
        KeyConstraintType::PRIMARY_KEY});
 
   const auto& customer_table = table_info_by_name.at("CUSTOMER").table;
-  customer_table->add_soft_key_constraint(
+  customer_table->add_key_constraint(
       {{customer_table->column_id_by_name("C_W_ID"), customer_table->column_id_by_name("C_D_ID"),
         customer_table->column_id_by_name("C_ID")},
        KeyConstraintType::PRIMARY_KEY});
 
   const auto& new_order_table = table_info_by_name.at("NEW_ORDER").table;
-  new_order_table->add_soft_key_constraint(
+  new_order_table->add_key_constraint(
       {{new_order_table->column_id_by_name("NO_W_ID"), new_order_table->column_id_by_name("NO_D_ID"),
         new_order_table->column_id_by_name("NO_O_ID")},
        KeyConstraintType::PRIMARY_KEY});
 
   const auto& order_table = table_info_by_name.at("ORDER").table;
-  order_table->add_soft_key_constraint(
+  order_table->add_key_constraint(
       {{order_table->column_id_by_name("O_W_ID"), order_table->column_id_by_name("O_D_ID"),
         order_table->column_id_by_name("O_ID")},
        KeyConstraintType::PRIMARY_KEY});
 
   const auto& order_line_table = table_info_by_name.at("ORDER_LINE").table;
-  order_line_table->add_soft_key_constraint(
+  order_line_table->add_key_constraint(
       {{order_line_table->column_id_by_name("OL_W_ID"), order_line_table->column_id_by_name("OL_D_ID"),
         order_line_table->column_id_by_name("OL_O_ID"), order_line_table->column_id_by_name("OL_NUMBER")},
        KeyConstraintType::PRIMARY_KEY});
 
   const auto& item_table = table_info_by_name.at("ITEM").table;
-  item_table->add_soft_key_constraint({{item_table->column_id_by_name("I_ID")}, KeyConstraintType::PRIMARY_KEY});
+  item_table->add_key_constraint({{item_table->column_id_by_name("I_ID")}, KeyConstraintType::PRIMARY_KEY});
 
   const auto& stock_table = table_info_by_name.at("STOCK").table;
-  stock_table->add_soft_key_constraint(
+  stock_table->add_key_constraint(
       {{stock_table->column_id_by_name("S_W_ID"), stock_table->column_id_by_name("S_I_ID")},
        KeyConstraintType::PRIMARY_KEY});
 }
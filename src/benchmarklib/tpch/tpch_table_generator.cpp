@@ -12,6 +12,7 @@ extern "C" {
 #include "benchmark_config.hpp"
 #include "import_export/binary/binary_parser.hpp"
 #include "storage/chunk.hpp"
+#include "storage/foreign_key_constraint.hpp"
 #include "storage/table_key_constraint.hpp"
 #include "table_builder.hpp"
 #include "utils/list_directory.hpp"
@@ -372,6 +373,32 @@ void TPCHTableGenerator::_add_constraints(
   const auto region_pk_constraint =
       TableKeyConstraint{{region_table->column_id_by_name("r_regionkey")}, KeyConstraintType::PRIMARY_KEY};
   region_table->add_soft_key_constraint(region_pk_constraint);
+
+  // Foreign keys as per TPC-H Specification, paragraph 1.4.2
+  const auto add_foreign_key_constraint = [&](const std::shared_ptr<Table>& table,
+                                              const std::vector<std::string>& column_names,
+                                              const std::string& referenced_table_name,
+                                              const std::vector<std::string>& referenced_column_names) {
+    const auto& referenced_table = table_info_by_name.at(referenced_table_name).table;
+    auto column_ids = std::vector<ColumnID>{};
+    auto referenced_column_ids = std::vector<ColumnID>{};
+    for (auto column_idx = size_t{0}; column_idx < column_names.size(); ++column_idx) {
+      column_ids.emplace_back(table->column_id_by_name(column_names[column_idx]));
+      referenced_column_ids.emplace_back(referenced_table->column_id_by_name(referenced_column_names[column_idx]));
+    }
+    table->add_soft_foreign_key_constraint({column_ids, referenced_table_name, referenced_column_ids});
+  };
+
+  add_foreign_key_constraint(partsupp_table, {"ps_partkey"}, "part", {"p_partkey"});
+  add_foreign_key_constraint(partsupp_table, {"ps_suppkey"}, "supplier", {"s_suppkey"});
+  add_foreign_key_constraint(customer_table, {"c_nationkey"}, "nation", {"n_nationkey"});
+  add_foreign_key_constraint(orders_table, {"o_custkey"}, "customer", {"c_custkey"});
+  add_foreign_key_constraint(lineitem_table, {"l_orderkey"}, "orders", {"o_orderkey"});
+  add_foreign_key_constraint(lineitem_table, {"l_partkey"}, "part", {"p_partkey"});
+  add_foreign_key_constraint(lineitem_table, {"l_suppkey"}, "supplier", {"s_suppkey"});
+  add_foreign_key_constraint(lineitem_table, {"l_partkey", "l_suppkey"}, "partsupp", {"ps_partkey", "ps_suppkey"});
+  add_foreign_key_constraint(supplier_table, {"s_nationkey"}, "nation", {"n_nationkey"});
+  add_foreign_key_constraint(nation_table, {"n_regionkey"}, "region", {"r_regionkey"});
 }
 
 }  // namespace opossum
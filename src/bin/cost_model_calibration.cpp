@@ -0,0 +1,54 @@
+#include <fstream>
+#include <iostream>
+
+#include "cxxopts.hpp"
+#include "nlohmann/json.hpp"
+
+#include "cost_estimation/cost_model_calibration.hpp"
+#include "hyrise.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Calibrates the CostEstimatorPhysical for this machine and writes the CostModelCoefficients as JSON. Pass the file to
+ * the benchmarks or the server via --cost_model_coefficients, or load it with
+ * CostEstimatorPhysical::load_default_coefficients.
+ */
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"./hyriseCostModelCalibration",
+                                      "Determines the coefficients of the physical cost model for this machine."};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "Display this help and exit") // NOLINT
+    ("o,output", "File to write the coefficients to (JSON)", cxxopts::value<std::string>()->default_value("cost_model_coefficients.json"))  // NOLINT
+    ("r,repetitions", "Number of executions per operator and table size", cxxopts::value<size_t>()->default_value("3"))  // NOLINT
+    ("scheduler", "Enable or disable the scheduler. Calibrate with the setting used for running queries", cxxopts::value<bool>()->default_value("true"))  // NOLINT
+    ;  // NOLINT
+  // clang-format on
+
+  const auto parsed_options = cli_options.parse(argc, argv);
+  if (parsed_options.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  // The parallelism of the operators is part of the cost model
+  if (parsed_options["scheduler"].as<bool>()) {
+    Hyrise::get().topology.use_default_topology();
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  }
+
+  std::cout << "- Calibrating the physical cost model" << std::endl;
+  auto calibration = CostModelCalibration{{10'000, 100'000, 1'000'000}, parsed_options["repetitions"].as<size_t>()};
+  const auto coefficients = nlohmann::json(calibration.run());
+
+  const auto output_file_name = parsed_options["output"].as<std::string>();
+  auto output_file = std::ofstream{output_file_name};
+  output_file << coefficients.dump(2) << std::endl;
+  std::cout << "- Coefficients written to " << output_file_name << std::endl;
+
+  Hyrise::get().scheduler()->finish();
+  return 0;
+}
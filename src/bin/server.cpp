@@ -5,6 +5,7 @@
 
 #include "benchmark_config.hpp"
 #include "cli_config_parser.hpp"
+#include "cost_estimation/cost_estimator_physical.hpp"
 #include "server/server.hpp"
 #include "tpcc/tpcc_table_generator.hpp"
 #include "tpcds/tpcds_table_generator.hpp"
@@ -61,6 +62,7 @@ cxxopts::Options get_server_cli_options() {
                        "TPC-DS, and TPC-H. The sizing factor determines the scale factor in TPC-DS and TPC-H, and the "
                        "warehouse count in TPC-C.", cxxopts::value<std::string>()) // NOLINT
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("cost_model_coefficients", "JSON file with calibrated cost model coefficients (see hyriseCostModelCalibration). If set, join and aggregate operators are chosen by cost", cxxopts::value<std::string>()) // NOLINT
     ;  // NOLINT
   // clang-format on
 
@@ -89,6 +91,11 @@ int main(int argc, char* argv[]) {
     generate_benchmark_data(parsed_options["benchmark_data"].as<std::string>());
   }
 
+  if (parsed_options.count("cost_model_coefficients")) {
+    opossum::CostEstimatorPhysical::load_default_coefficients(
+        parsed_options["cost_model_coefficients"].as<std::string>());
+  }
+
   const auto execution_info = parsed_options["execution_info"].as<bool>();
   const auto port = parsed_options["port"].as<uint16_t>();
 
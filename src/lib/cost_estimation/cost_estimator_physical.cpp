@@ -0,0 +1,446 @@
+#include "cost_estimator_physical.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+#include "constant_mappings.hpp"
+#include "expression/abstract_expression.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+#include "storage/index/abstract_index.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Names of the CostFeatures in the JSON representation of the CostModelCoefficients
+const auto cost_feature_names = std::array<std::string, COST_FEATURE_COUNT>{
+    "ReadValues",      "HashBuildRows",   "HashProbeRows",     "SortComparisons",   "MergeRows",
+    "IndexLookups",    "NestedLoopPairs", "HashAggregateRows", "SortAggregateRows", "OutputRows"};
+
+std::mutex default_coefficients_mutex;
+std::optional<CostModelCoefficients> calibrated_cost_model_coefficients;
+
+double& feature(CostFeatures& features, const CostFeature cost_feature) {
+  return features[static_cast<size_t>(cost_feature)];
+}
+
+// Number of comparisons for sorting the given number of rows
+double sort_comparisons(const Cardinality row_count) {
+  return static_cast<double>(row_count) * std::log2(static_cast<double>(row_count) + 1.0);
+}
+
+bool chunk_has_lookup_index(const Chunk& chunk, const ColumnID column_id) {
+  const auto indexes = chunk.get_indexes(std::vector<ColumnID>{column_id});
+  return std::any_of(indexes.cbegin(), indexes.cend(),
+                     [](const auto& index) { return index->type() != SegmentIndexType::Trigram; });
+}
+
+}  // namespace
+
+namespace opossum {
+
+void from_json(const nlohmann::json& json, CostModelCoefficients& coefficients) {
+  // Apply only the coefficients that are provided, keep the default values otherwise
+  if (json.find("feature_costs") != json.end()) {
+    const auto& feature_costs = json.at("feature_costs");
+    for (auto feature_idx = size_t{0}; feature_idx < COST_FEATURE_COUNT; ++feature_idx) {
+      if (feature_costs.find(cost_feature_names[feature_idx]) != feature_costs.end()) {
+        coefficients.feature_costs[feature_idx] = feature_costs.at(cost_feature_names[feature_idx]).get<double>();
+      }
+    }
+  }
+
+  if (json.find("relative_read_costs") != json.end()) {
+    for (const auto& [name, value] : json.at("relative_read_costs").items()) {
+      const auto encoding_type_iter = encoding_type_to_string.right.find(name);
+      Assert(encoding_type_iter != encoding_type_to_string.right.end(), "Unknown encoding type '" + name + "'");
+      coefficients.relative_read_costs[static_cast<size_t>(encoding_type_iter->second)] = value.get<double>();
+    }
+  }
+}
+
+void to_json(nlohmann::json& json, const CostModelCoefficients& coefficients) {
+  auto feature_costs = nlohmann::json{};
+  for (auto feature_idx = size_t{0}; feature_idx < COST_FEATURE_COUNT; ++feature_idx) {
+    feature_costs[cost_feature_names[feature_idx]] = coefficients.feature_costs[feature_idx];
+  }
+
+  auto relative_read_costs = nlohmann::json{};
+  for (const auto& [encoding_type, name] : encoding_type_to_string.left) {
+    relative_read_costs[name] = coefficients.relative_read_costs[static_cast<size_t>(encoding_type)];
+  }
+
+  json = nlohmann::json{{"feature_costs", feature_costs}, {"relative_read_costs", relative_read_costs}};
+}
+
+CostEstimatorPhysical::CostEstimatorPhysical(
+    const std::shared_ptr<AbstractCardinalityEstimator>& init_cardinality_estimator,
+    const CostModelCoefficients& init_coefficients)
+    : AbstractCostEstimator(init_cardinality_estimator), coefficients(init_coefficients) {}
+
+std::shared_ptr<AbstractCostEstimator> CostEstimatorPhysical::new_instance() const {
+  return std::make_shared<CostEstimatorPhysical>(cardinality_estimator->new_instance(), coefficients);
+}
+
+Cost CostEstimatorPhysical::estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto output_row_count = cardinality_estimator->estimate_cardinality(node);
+  const auto left_input_row_count =
+      node->left_input() ? cardinality_estimator->estimate_cardinality(node->left_input()) : 0.0f;
+  const auto right_input_row_count =
+      node->right_input() ? cardinality_estimator->estimate_cardinality(node->right_input()) : 0.0f;
+
+  auto features = CostFeatures{};
+  feature(features, CostFeature::OutputRows) = output_row_count;
+
+  switch (node->type) {
+    case LQPNodeType::StoredTable:
+      // GetTable only forwards the chunks of the stored table
+      return Cost{0};
+
+    case LQPNodeType::Join: {
+      const auto join_node = std::static_pointer_cast<JoinNode>(node);
+      if (join_node->join_mode == JoinMode::Cross) break;
+
+      auto min_cost = std::optional<Cost>{};
+      const auto consider = [&](const std::optional<CostFeatures>& join_features) {
+        if (!join_features) return;
+        const auto join_cost = cost(*join_features);
+        if (!min_cost || join_cost < *min_cost) min_cost = join_cost;
+      };
+
+      consider(join_features(join_node, OperatorType::JoinHash));
+      consider(join_features(join_node, OperatorType::JoinSortMerge));
+      consider(join_features(join_node, OperatorType::JoinIndex, IndexSide::Left));
+      consider(join_features(join_node, OperatorType::JoinIndex, IndexSide::Right));
+      if (min_cost) return *min_cost;
+
+      // Only the JoinNestedLoop supports the join
+      feature(features, CostFeature::NestedLoopPairs) = left_input_row_count * right_input_row_count;
+    } break;
+
+    case LQPNodeType::Aggregate: {
+      const auto aggregate_node = std::static_pointer_cast<AggregateNode>(node);
+      const auto hash_cost = cost(aggregate_hash_features(aggregate_node));
+      if (aggregate_node->aggregate_expressions_begin_idx == 0) return hash_cost;
+      return std::min(hash_cost, cost(aggregate_sort_features(aggregate_node)));
+    }
+
+    case LQPNodeType::Predicate: {
+      const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+      feature(features, CostFeature::ReadValues) =
+          left_input_row_count * _relative_read_cost(predicate_node->predicate());
+    } break;
+
+    case LQPNodeType::Sort: {
+      auto relative_read_cost = 0.0;
+      for (const auto& expression : node->node_expressions) {
+        relative_read_cost += _relative_read_cost(expression);
+      }
+      feature(features, CostFeature::ReadValues) = left_input_row_count * relative_read_cost;
+      feature(features, CostFeature::SortComparisons) = sort_comparisons(left_input_row_count);
+    } break;
+
+    default:
+      feature(features, CostFeature::ReadValues) = left_input_row_count + right_input_row_count;
+  }
+
+  return cost(features);
+}
+
+std::optional<CostFeatures> CostEstimatorPhysical::join_features(const std::shared_ptr<JoinNode>& join_node,
+                                                                 const OperatorType operator_type,
+                                                                 const IndexSide index_side) const {
+  Assert(join_node->join_mode != JoinMode::Cross, "Cross joins are executed by the Product operator");
+
+  const auto& left_input = join_node->left_input();
+  const auto& right_input = join_node->right_input();
+  const auto primary_predicate =
+      OperatorJoinPredicate::from_expression(*join_node->join_predicates().front(), *left_input, *right_input);
+  if (!primary_predicate) return std::nullopt;
+
+  const auto& left_column = left_input->output_expressions()[primary_predicate->column_ids.first];
+  const auto& right_column = right_input->output_expressions()[primary_predicate->column_ids.second];
+  auto configuration = JoinConfiguration{join_node->join_mode, primary_predicate->predicate_condition,
+                                         left_column->data_type(), right_column->data_type(),
+                                         join_node->join_predicates().size() > 1};
+
+  const auto left_row_count = static_cast<double>(cardinality_estimator->estimate_cardinality(left_input));
+  const auto right_row_count = static_cast<double>(cardinality_estimator->estimate_cardinality(right_input));
+  const auto left_read_cost = left_row_count * _relative_read_cost(left_column);
+  const auto right_read_cost = right_row_count * _relative_read_cost(right_column);
+
+  auto features = CostFeatures{};
+  feature(features, CostFeature::OutputRows) = cardinality_estimator->estimate_cardinality(join_node);
+
+  switch (operator_type) {
+    case OperatorType::JoinHash: {
+      if (!JoinHash::supports(configuration)) return std::nullopt;
+
+      // See JoinHash::_on_execute for the choice of the build side
+      auto build_row_count = right_row_count;
+      auto probe_row_count = left_row_count;
+      if ((join_node->join_mode == JoinMode::Inner && left_row_count < right_row_count) ||
+          join_node->join_mode == JoinMode::Right) {
+        std::swap(build_row_count, probe_row_count);
+      }
+
+      const auto parallelism = _parallelism(static_cast<Cardinality>(left_row_count + right_row_count));
+      feature(features, CostFeature::ReadValues) = (left_read_cost + right_read_cost) / parallelism;
+      feature(features, CostFeature::HashBuildRows) = build_row_count / parallelism;
+      feature(features, CostFeature::HashProbeRows) = probe_row_count / parallelism;
+      return features;
+    }
+
+    case OperatorType::JoinSortMerge: {
+      if (!JoinSortMerge::supports(configuration)) return std::nullopt;
+
+      const auto parallelism = _parallelism(static_cast<Cardinality>(left_row_count + right_row_count));
+      feature(features, CostFeature::ReadValues) = (left_read_cost + right_read_cost) / parallelism;
+      feature(features, CostFeature::SortComparisons) =
+          (sort_comparisons(static_cast<Cardinality>(left_row_count)) +
+           sort_comparisons(static_cast<Cardinality>(right_row_count))) /
+          parallelism;
+      feature(features, CostFeature::MergeRows) = (left_row_count + right_row_count) / parallelism;
+      return features;
+    }
+
+    case OperatorType::JoinIndex: {
+      // The index side has to be a stored table, either directly or validated
+      auto index_input = index_side == IndexSide::Left ? left_input : right_input;
+      auto index_table_type = TableType::Data;
+      if (index_input->type == LQPNodeType::Validate) {
+        index_input = index_input->left_input();
+        index_table_type = TableType::References;
+      }
+      if (index_input->type != LQPNodeType::StoredTable) return std::nullopt;
+
+      configuration.index_side = index_side;
+      configuration.left_table_type = index_side == IndexSide::Left ? index_table_type : TableType::References;
+      configuration.right_table_type = index_side == IndexSide::Right ? index_table_type : TableType::References;
+      if (!JoinIndex::supports(configuration)) return std::nullopt;
+
+      const auto index_column =
+          std::dynamic_pointer_cast<LQPColumnExpression>(index_side == IndexSide::Left ? left_column : right_column);
+      if (!index_column || index_column->original_node.lock() != index_input ||
+          index_column->original_column_id == INVALID_COLUMN_ID) {
+        return std::nullopt;
+      }
+
+      const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(index_input);
+      const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+      const auto& pruned_chunk_ids = stored_table_node->pruned_chunk_ids();
+      const auto probe_row_count = index_side == IndexSide::Left ? right_row_count : left_row_count;
+      const auto probe_read_cost = index_side == IndexSide::Left ? right_read_cost : left_read_cost;
+
+      // GetTable forwards the table-wide index only if nothing was pruned (see JoinIndex::_table_hash_index)
+      const auto use_table_hash_index =
+          index_table_type == TableType::Data && configuration.predicate_condition == PredicateCondition::Equals &&
+          join_node->join_mode != JoinMode::AntiNullAsTrue && pruned_chunk_ids.empty() &&
+          stored_table_node->pruned_column_ids().empty() &&
+          table->get_table_hash_index({index_column->original_column_id});
+
+      if (use_table_hash_index) {
+        feature(features, CostFeature::IndexLookups) = probe_row_count;
+      } else {
+        // The probe side is looked up in the index of every index chunk. Chunks without index are joined using a
+        // nested loop.
+        auto indexed_chunk_count = size_t{0};
+        auto unindexed_row_count = size_t{0};
+        const auto chunk_count = table->chunk_count();
+        for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+          if (std::binary_search(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend(), chunk_id)) continue;
+          const auto chunk = table->get_chunk(chunk_id);
+          if (!chunk) continue;
+
+          if (chunk_has_lookup_index(*chunk, index_column->original_column_id)) {
+            ++indexed_chunk_count;
+          } else {
+            unindexed_row_count += chunk->size();
+          }
+        }
+        if (indexed_chunk_count == 0) return std::nullopt;
+
+        feature(features, CostFeature::IndexLookups) = probe_row_count * static_cast<double>(indexed_chunk_count);
+        feature(features, CostFeature::NestedLoopPairs) = probe_row_count * static_cast<double>(unindexed_row_count);
+      }
+
+      feature(features, CostFeature::ReadValues) = probe_read_cost;
+      return features;
+    }
+
+    default:
+      Fail("Operator type is not a predicated join");
+  }
+}
+
+CostFeatures CostEstimatorPhysical::aggregate_hash_features(
+    const std::shared_ptr<AggregateNode>& aggregate_node) const {
+  auto features = _aggregate_base_features(aggregate_node);
+  feature(features, CostFeature::HashAggregateRows) =
+      cardinality_estimator->estimate_cardinality(aggregate_node->left_input());
+  return features;
+}
+
+CostFeatures CostEstimatorPhysical::aggregate_sort_features(const std::shared_ptr<AggregateNode>& aggregate_node,
+                                                            const bool input_is_join_sort_merge) const {
+  auto features = _aggregate_base_features(aggregate_node);
+  const auto input_row_count = cardinality_estimator->estimate_cardinality(aggregate_node->left_input());
+  feature(features, CostFeature::SortAggregateRows) = input_row_count;
+
+  // The AggregateSort skips sorting chunks that are sorted by the only group-by column, but only if its input is
+  // value-clustered by a group-by column (see AggregateSort::_sort_table_chunk_wise). Otherwise, it sorts the input
+  // and reads the sorted rows again.
+  const auto is_sorted = input_is_join_sort_merge && aggregate_node->aggregate_expressions_begin_idx == 1 &&
+                         _join_sort_merge_clusters_group_by_column(aggregate_node);
+  if (!is_sorted) {
+    feature(features, CostFeature::ReadValues) *= 2.0;
+    feature(features, CostFeature::SortComparisons) = sort_comparisons(input_row_count);
+  }
+  return features;
+}
+
+Cost CostEstimatorPhysical::cost(const CostFeatures& features) const {
+  auto cost = 0.0;
+  for (auto feature_idx = size_t{0}; feature_idx < COST_FEATURE_COUNT; ++feature_idx) {
+    cost += features[feature_idx] * coefficients.feature_costs[feature_idx];
+  }
+  return static_cast<Cost>(cost);
+}
+
+CostModelCoefficients CostEstimatorPhysical::default_coefficients() {
+  const auto lock = std::lock_guard<std::mutex>{default_coefficients_mutex};
+  return calibrated_cost_model_coefficients.value_or(CostModelCoefficients{});
+}
+
+void CostEstimatorPhysical::set_default_coefficients(const CostModelCoefficients& coefficients) {
+  const auto lock = std::lock_guard<std::mutex>{default_coefficients_mutex};
+  calibrated_cost_model_coefficients = coefficients;
+}
+
+bool CostEstimatorPhysical::has_calibrated_default_coefficients() {
+  const auto lock = std::lock_guard<std::mutex>{default_coefficients_mutex};
+  return calibrated_cost_model_coefficients.has_value();
+}
+
+void CostEstimatorPhysical::reset_default_coefficients() {
+  const auto lock = std::lock_guard<std::mutex>{default_coefficients_mutex};
+  calibrated_cost_model_coefficients.reset();
+}
+
+void CostEstimatorPhysical::load_default_coefficients(const std::string& file_path) {
+  auto file = std::ifstream{file_path};
+  AssertInput(file.is_open(), "Cannot open cost model coefficients file '" + file_path + "'");
+  set_default_coefficients(nlohmann::json::parse(file).get<CostModelCoefficients>());
+}
+
+CostFeatures CostEstimatorPhysical::_aggregate_base_features(
+    const std::shared_ptr<AggregateNode>& aggregate_node) const {
+  // Group-by columns and aggregate arguments are read once
+  auto relative_read_cost = 0.0;
+  for (auto expression_idx = size_t{0}; expression_idx < aggregate_node->node_expressions.size(); ++expression_idx) {
+    const auto& expression = aggregate_node->node_expressions[expression_idx];
+    if (expression_idx < aggregate_node->aggregate_expressions_begin_idx) {
+      relative_read_cost += _relative_read_cost(expression);
+    } else {
+      for (const auto& argument : expression->arguments) {
+        relative_read_cost += _relative_read_cost(argument);
+      }
+    }
+  }
+
+  auto features = CostFeatures{};
+  feature(features, CostFeature::ReadValues) =
+      cardinality_estimator->estimate_cardinality(aggregate_node->left_input()) * relative_read_cost;
+  feature(features, CostFeature::OutputRows) = cardinality_estimator->estimate_cardinality(aggregate_node);
+  return features;
+}
+
+double CostEstimatorPhysical::_relative_read_cost(const std::shared_ptr<AbstractExpression>& expression) const {
+  auto relative_read_cost = 0.0;
+
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (sub_expression->type != ExpressionType::LQPColumn) return ExpressionVisitation::VisitArguments;
+
+    const auto column_expression = std::static_pointer_cast<LQPColumnExpression>(sub_expression);
+    // COUNT(*) does not read any values
+    if (column_expression->original_column_id == INVALID_COLUMN_ID) return ExpressionVisitation::DoNotVisitArguments;
+
+    // Columns that do not originate from a stored table (e.g., calculated by a projection) are not encoded
+    auto column_read_cost = 1.0;
+    const auto stored_table_node =
+        std::dynamic_pointer_cast<const StoredTableNode>(column_expression->original_node.lock());
+    if (stored_table_node) {
+      // Assume that all chunks are encoded like the first one that has a resident segment
+      const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+      const auto chunk_count = table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        if (!chunk) continue;
+        const auto segment = chunk->get_resident_segment(column_expression->original_column_id);
+        if (!segment) continue;
+
+        const auto encoding_type = get_segment_encoding_spec(segment).encoding_type;
+        column_read_cost = coefficients.relative_read_costs[static_cast<size_t>(encoding_type)];
+        break;
+      }
+    }
+
+    relative_read_cost += column_read_cost;
+    return ExpressionVisitation::DoNotVisitArguments;
+  });
+
+  return relative_read_cost;
+}
+
+bool CostEstimatorPhysical::_join_sort_merge_clusters_group_by_column(
+    const std::shared_ptr<AggregateNode>& aggregate_node) {
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(aggregate_node->left_input());
+  if (!join_node || join_node->join_mode == JoinMode::Cross || join_node->join_mode == JoinMode::Left ||
+      join_node->join_mode == JoinMode::Right || join_node->join_mode == JoinMode::FullOuter) {
+    return false;
+  }
+
+  // The output is clustered by both columns of the primary predicate, if it is an equality predicate
+  const auto primary_predicate =
+      std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicates().front());
+  if (!primary_predicate || primary_predicate->predicate_condition != PredicateCondition::Equals) return false;
+
+  const auto group_by_expressions_end =
+      aggregate_node->node_expressions.cbegin() + aggregate_node->aggregate_expressions_begin_idx;
+  return std::any_of(aggregate_node->node_expressions.cbegin(), group_by_expressions_end,
+                     [&](const auto& expression) {
+                       return *expression == *primary_predicate->left_operand() ||
+                              *expression == *primary_predicate->right_operand();
+                     });
+}
+
+double CostEstimatorPhysical::_parallelism(const Cardinality row_count) {
+  // Without a NodeQueueScheduler, all tasks are executed by the calling thread
+  if (std::dynamic_pointer_cast<ImmediateExecutionScheduler>(Hyrise::get().scheduler())) return 1.0;
+
+  const auto max_parallelism = std::max(static_cast<double>(Hyrise::get().topology.num_cpus()), 1.0);
+  return std::clamp(static_cast<double>(row_count) / ROWS_PER_WORKER, 1.0, max_parallelism);
+}
+
+}  // namespace opossum
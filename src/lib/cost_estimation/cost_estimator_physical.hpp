@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "nlohmann/json.hpp"
+
+#include "abstract_cost_estimator.hpp"
+#include "operators/abstract_join_operator.hpp"
+#include "operators/abstract_operator.hpp"
+#include "storage/encoding_type.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class AggregateNode;
+class JoinNode;
+
+/**
+ * Units of work that the execution of the physical operators is composed of. The CostEstimatorPhysical estimates how
+ * many units of each feature an operator performs, the CostModelCoefficients state how long a unit takes.
+ */
+enum class CostFeature : uint8_t {
+  ReadValues,         // Values read from segments, weighted by the relative read cost of the segment's encoding
+  HashBuildRows,      // Rows inserted into the hash table of the JoinHash
+  HashProbeRows,      // Rows probed against the hash table of the JoinHash
+  SortComparisons,    // n * log2(n + 1) for every sorted input of n rows
+  MergeRows,          // Rows merged by the JoinSortMerge
+  IndexLookups,       // Index lookups of the JoinIndex
+  NestedLoopPairs,    // Pairs of rows compared by a nested loop
+  HashAggregateRows,  // Rows inserted into the hash table of the AggregateHash
+  SortAggregateRows,  // Rows aggregated by the AggregateSort from consecutive groups
+  OutputRows,         // Rows written to the output
+  Count               // Dummy entry to describe the number of features
+};
+
+constexpr auto COST_FEATURE_COUNT = static_cast<size_t>(CostFeature::Count);
+
+// Amount of work per CostFeature, divided by the parallelism of the operator where it is performed in parallel
+using CostFeatures = std::array<double, COST_FEATURE_COUNT>;
+
+/**
+ * The default values are rough estimates. Use the CostModelCalibration to determine them for the machine Hyrise runs
+ * on. Until calibrated coefficients are set, the LQPTranslator does not choose operators by cost.
+ */
+struct CostModelCoefficients {
+  // Nanoseconds per unit of each CostFeature
+  CostFeatures feature_costs{1.0, 10.0, 6.0, 5.0, 4.0, 40.0, 2.0, 8.0, 3.0, 2.0};
+
+  // Cost of reading a value from a segment of each EncodingType relative to reading it from a ValueSegment
+  std::array<double, 6> relative_read_costs{1.0, 1.5, 1.5, 2.0, 1.5, 20.0};
+};
+
+void from_json(const nlohmann::json& json, CostModelCoefficients& coefficients);
+void to_json(nlohmann::json& json, const CostModelCoefficients& coefficients);
+
+/**
+ * Cost model for the execution time of the physical operators (in estimated nanoseconds). In contrast to the
+ * CostEstimatorLogical, which only counts rows, the cost of an operator depends on its implementation:
+ *
+ *  - Per-operator cost functions describe the work of JoinHash, JoinSortMerge, JoinIndex, AggregateHash, and
+ *    AggregateSort in terms of CostFeatures.
+ *  - Reading values is more expensive for heavily compressed segments (e.g., LZ4). The encoding is taken from the
+ *    stored table that a column originates from.
+ *  - The AggregateSort sorts its entire input unless the input is value-clustered by one of the group-by columns (see
+ *    AggregateSort::_on_execute). Of the join operators, only the JoinSortMerge produces such outputs for
+ *    non-outer equi-joins. As it also sorts each output chunk by the join columns, the AggregateSort does not sort at
+ *    all when grouping by a single join column. Sorting the clustered chunks individually is modeled like sorting the
+ *    entire input.
+ *  - The JoinIndex is only applicable if the index side is a stored table with indexes on the join column.
+ *  - The work of operators that are executed in parallel by the scheduler is divided by the number of workers they can
+ *    use.
+ *
+ * Once calibrated coefficients are set (see set_default_coefficients), the LQPTranslator uses this model to choose
+ * between operator implementations. For nodes that are not joins or aggregates, only the read and output costs are
+ * estimated.
+ */
+class CostEstimatorPhysical : public AbstractCostEstimator {
+ public:
+  explicit CostEstimatorPhysical(const std::shared_ptr<AbstractCardinalityEstimator>& init_cardinality_estimator,
+                                 const CostModelCoefficients& init_coefficients = default_coefficients());
+
+  std::shared_ptr<AbstractCostEstimator> new_instance() const override;
+
+  // Returns the cost of the cheapest operator for the node
+  Cost estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+  // Returns the work of executing the (predicated) join with JoinHash, JoinSortMerge, or JoinIndex (using the given
+  // index side). Returns nullopt if the operator does not support the join.
+  std::optional<CostFeatures> join_features(const std::shared_ptr<JoinNode>& join_node,
+                                            const OperatorType operator_type,
+                                            const IndexSide index_side = IndexSide::Right) const;
+
+  // Return the work of executing the aggregate with AggregateHash or AggregateSort, respectively. Whether the input of
+  // the AggregateSort is value-clustered depends on the operator that the input join is executed with.
+  CostFeatures aggregate_hash_features(const std::shared_ptr<AggregateNode>& aggregate_node) const;
+  CostFeatures aggregate_sort_features(const std::shared_ptr<AggregateNode>& aggregate_node,
+                                       const bool input_is_join_sort_merge = false) const;
+
+  Cost cost(const CostFeatures& features) const;
+
+  // Coefficients used by estimators that are created without explicit coefficients, e.g., by the LQPTranslator. Set
+  // them (e.g., to the result of the CostModelCalibration) before queries are executed. Until then, the default
+  // values of CostModelCoefficients are used.
+  static CostModelCoefficients default_coefficients();
+  static void set_default_coefficients(const CostModelCoefficients& coefficients);
+  static bool has_calibrated_default_coefficients();
+  static void reset_default_coefficients();
+
+  // Sets the default coefficients to those in the given JSON file, as written by the hyriseCostModelCalibration binary
+  static void load_default_coefficients(const std::string& file_path);
+
+  const CostModelCoefficients coefficients;
+
+  // Operators executed in parallel use one worker per ROWS_PER_WORKER input rows, at most one per CPU
+  constexpr static double ROWS_PER_WORKER = 10'000.0;
+
+ private:
+  // Returns the features that AggregateHash and AggregateSort have in common: reading the input and writing the output
+  CostFeatures _aggregate_base_features(const std::shared_ptr<AggregateNode>& aggregate_node) const;
+
+  // Returns the relative cost of reading the values of the expression. For columns of stored tables, this depends on
+  // the encoding of the table's segments.
+  double _relative_read_cost(const std::shared_ptr<AbstractExpression>& expression) const;
+
+  // Returns whether the AggregateSort's input is value-clustered by one of the group-by columns if the input join is
+  // executed by a JoinSortMerge (see JoinSortMerge::_on_execute)
+  static bool _join_sort_merge_clusters_group_by_column(const std::shared_ptr<AggregateNode>& aggregate_node);
+
+  // Number of workers that operators executed in parallel can use for the given number of input rows
+  static double _parallelism(const Cardinality row_count);
+};
+
+}  // namespace opossum
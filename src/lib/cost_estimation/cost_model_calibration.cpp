@@ -0,0 +1,295 @@
+#include "cost_model_calibration.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/aggregate_sort.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Probe side of the joins and unsorted input of the aggregates. Column a is a permutation of [0, row_count), column b
+// has 1'000 distinct values.
+const auto LEFT_TABLE_NAME = std::string{"cost_model_calibration_left"};
+
+// Build/index side of the joins with a tenth of the rows. Column a contains every tenth value of the left table's
+// column a and has a GroupKeyIndex per chunk.
+const auto RIGHT_TABLE_NAME = std::string{"cost_model_calibration_right"};
+
+// Like the left table, but sorted by b, which is reflected by the chunks' sorted_by flags
+const auto SORTED_TABLE_NAME = std::string{"cost_model_calibration_sorted"};
+
+// Number of coordinate descent iterations when fitting the feature costs
+constexpr auto FIT_ITERATIONS = 100;
+
+std::shared_ptr<Table> create_calibration_table() {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Int, false);
+  return std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+}
+
+void finalize_calibration_table(const std::shared_ptr<Table>& table) {
+  if (table->chunk_count() > 0) table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+}
+
+// Iterates over the segment and returns the fastest of the given number of runs
+template <typename T>
+std::chrono::nanoseconds measure_iteration(const AbstractSegment& segment, const size_t repetitions) {
+  auto min_runtime = std::chrono::nanoseconds::max();
+  for (auto repetition = size_t{0}; repetition < repetitions; ++repetition) {
+    auto checksum = size_t{0};
+    auto timer = Timer{};
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        checksum += position.value().size();
+      } else {
+        checksum += static_cast<size_t>(position.value());
+      }
+    });
+    min_runtime = std::min(min_runtime, timer.lap());
+    // Use the checksum, so that the iteration is not optimized away
+    Assert(checksum > 0, "Expected calibration segment to contain non-zero values");
+  }
+  return std::max(min_runtime, std::chrono::nanoseconds{1});
+}
+
+}  // namespace
+
+namespace opossum {
+
+CostModelCalibration::CostModelCalibration(const std::vector<size_t>& init_row_counts, const size_t init_repetitions)
+    : row_counts(init_row_counts), repetitions(init_repetitions) {
+  Assert(!row_counts.empty() && repetitions > 0, "Calibration requires at least one table size and repetition");
+  for (const auto row_count : row_counts) {
+    Assert(row_count >= 1'000, "Calibration tables need at least 1'000 rows");
+  }
+}
+
+CostModelCoefficients CostModelCalibration::run() {
+  auto coefficients = CostEstimatorPhysical::default_coefficients();
+  coefficients.relative_read_costs = _calibrate_read_costs();
+
+  // The features depend on the relative read costs, so they have to be calibrated first
+  const auto estimator = CostEstimatorPhysical{std::make_shared<CardinalityEstimator>(), coefficients};
+
+  _measurements.clear();
+  for (const auto row_count : row_counts) {
+    _generate_tables(row_count);
+    _measure_joins(estimator);
+    _measure_aggregates(estimator);
+    _drop_tables();
+  }
+
+  coefficients.feature_costs = _fit(coefficients.feature_costs);
+  return coefficients;
+}
+
+std::array<double, 6> CostModelCalibration::_calibrate_read_costs() const {
+  const auto row_count = row_counts.back();
+
+  auto int_values = pmr_vector<int32_t>(row_count);
+  auto string_values = pmr_vector<pmr_string>(row_count);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    int_values[row_id] = static_cast<int32_t>((row_id * 7919) % 1'000 + 1);
+    string_values[row_id] = pmr_string{"value_" + std::to_string(int_values[row_id])};
+  }
+  const auto int_segment = std::make_shared<ValueSegment<int32_t>>(std::move(int_values));
+  const auto string_segment = std::make_shared<ValueSegment<pmr_string>>(std::move(string_values));
+
+  const auto unencoded_int_runtime = measure_iteration<int32_t>(*int_segment, repetitions);
+  const auto unencoded_string_runtime = measure_iteration<pmr_string>(*string_segment, repetitions);
+
+  auto relative_read_costs = std::array<double, 6>{};
+  for (const auto& [encoding_type, name] : encoding_type_to_string.left) {
+    if (encoding_type == EncodingType::Unencoded) {
+      relative_read_costs[static_cast<size_t>(encoding_type)] = 1.0;
+      continue;
+    }
+
+    // FixedStringDictionary only supports strings
+    auto relative_read_cost = 0.0;
+    if (encoding_type == EncodingType::FixedStringDictionary) {
+      const auto encoded_segment =
+          ChunkEncoder::encode_segment(string_segment, DataType::String, SegmentEncodingSpec{encoding_type});
+      relative_read_cost =
+          static_cast<double>(measure_iteration<pmr_string>(*encoded_segment, repetitions).count()) /
+          static_cast<double>(unencoded_string_runtime.count());
+    } else {
+      const auto encoded_segment =
+          ChunkEncoder::encode_segment(int_segment, DataType::Int, SegmentEncodingSpec{encoding_type});
+      relative_read_cost = static_cast<double>(measure_iteration<int32_t>(*encoded_segment, repetitions).count()) /
+                           static_cast<double>(unencoded_int_runtime.count());
+    }
+    relative_read_costs[static_cast<size_t>(encoding_type)] = relative_read_cost;
+  }
+
+  return relative_read_costs;
+}
+
+void CostModelCalibration::_generate_tables(const size_t row_count) {
+  _drop_tables();
+
+  const auto left_table = create_calibration_table();
+  const auto sorted_table = create_calibration_table();
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    left_table->append({static_cast<int32_t>((row_id * 7919) % row_count), static_cast<int32_t>(row_id % 1'000)});
+    sorted_table->append({static_cast<int32_t>(row_id), static_cast<int32_t>(row_id * 1'000 / row_count)});
+  }
+  finalize_calibration_table(left_table);
+  finalize_calibration_table(sorted_table);
+  const auto sorted_chunk_count = sorted_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < sorted_chunk_count; ++chunk_id) {
+    sorted_table->get_chunk(chunk_id)->set_individually_sorted_by(SortColumnDefinition{ColumnID{1}});
+  }
+
+  const auto right_table = create_calibration_table();
+  for (auto row_id = size_t{0}; row_id < row_count / 10; ++row_id) {
+    right_table->append({static_cast<int32_t>(row_id * 10), static_cast<int32_t>(row_id % 1'000)});
+  }
+  finalize_calibration_table(right_table);
+  const auto right_chunk_count = right_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < right_chunk_count; ++chunk_id) {
+    right_table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  storage_manager.add_table(LEFT_TABLE_NAME, left_table);
+  storage_manager.add_table(RIGHT_TABLE_NAME, right_table);
+  storage_manager.add_table(SORTED_TABLE_NAME, sorted_table);
+}
+
+void CostModelCalibration::_drop_tables() {
+  auto& storage_manager = Hyrise::get().storage_manager;
+  for (const auto& table_name : {LEFT_TABLE_NAME, RIGHT_TABLE_NAME, SORTED_TABLE_NAME}) {
+    if (storage_manager.has_table(table_name)) storage_manager.drop_table(table_name);
+  }
+}
+
+void CostModelCalibration::_measure_joins(const CostEstimatorPhysical& estimator) {
+  const auto left_node = StoredTableNode::make(LEFT_TABLE_NAME);
+  const auto right_node = StoredTableNode::make(RIGHT_TABLE_NAME);
+  const auto join_node = JoinNode::make(
+      JoinMode::Inner, equals_(lqp_column_(left_node, ColumnID{0}), lqp_column_(right_node, ColumnID{0})), left_node,
+      right_node);
+
+  const auto join_hash_features = estimator.join_features(join_node, OperatorType::JoinHash);
+  const auto join_sort_merge_features = estimator.join_features(join_node, OperatorType::JoinSortMerge);
+  const auto join_index_features = estimator.join_features(join_node, OperatorType::JoinIndex, IndexSide::Right);
+  Assert(join_hash_features && join_sort_merge_features && join_index_features,
+         "Expected all join operators to support the calibration join");
+
+  const auto left_input = std::make_shared<GetTable>(LEFT_TABLE_NAME);
+  const auto right_input = std::make_shared<GetTable>(RIGHT_TABLE_NAME);
+  left_input->execute();
+  right_input->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  for (auto repetition = size_t{0}; repetition < repetitions; ++repetition) {
+    _measure(std::make_shared<JoinHash>(left_input, right_input, JoinMode::Inner, primary_predicate),
+             *join_hash_features);
+    _measure(std::make_shared<JoinSortMerge>(left_input, right_input, JoinMode::Inner, primary_predicate),
+             *join_sort_merge_features);
+    _measure(std::make_shared<JoinIndex>(left_input, right_input, JoinMode::Inner, primary_predicate,
+                                         std::vector<OperatorJoinPredicate>{}, IndexSide::Right),
+             *join_index_features);
+  }
+}
+
+void CostModelCalibration::_measure_aggregates(const CostEstimatorPhysical& estimator) {
+  // SELECT b, SUM(a) FROM ... GROUP BY b on unsorted and sorted input
+  for (const auto& table_name : {LEFT_TABLE_NAME, SORTED_TABLE_NAME}) {
+    const auto stored_table_node = StoredTableNode::make(table_name);
+    const auto aggregate_node =
+        AggregateNode::make(expression_vector(lqp_column_(stored_table_node, ColumnID{1})),
+                            expression_vector(sum_(lqp_column_(stored_table_node, ColumnID{0}))), stored_table_node);
+
+    const auto aggregate_hash_features = estimator.aggregate_hash_features(aggregate_node);
+    const auto aggregate_sort_features = estimator.aggregate_sort_features(aggregate_node);
+
+    const auto input = std::make_shared<GetTable>(table_name);
+    input->execute();
+
+    const auto aggregates =
+        std::vector<std::shared_ptr<AggregateExpression>>{sum_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"))};
+    const auto group_by_column_ids = std::vector<ColumnID>{ColumnID{1}};
+    for (auto repetition = size_t{0}; repetition < repetitions; ++repetition) {
+      _measure(std::make_shared<AggregateHash>(input, aggregates, group_by_column_ids), aggregate_hash_features);
+      _measure(std::make_shared<AggregateSort>(input, aggregates, group_by_column_ids), aggregate_sort_features);
+    }
+  }
+}
+
+void CostModelCalibration::_measure(const std::shared_ptr<AbstractOperator>& op, const CostFeatures& features) {
+  op->execute();
+  const auto runtime = std::max(op->performance_data->walltime, std::chrono::nanoseconds{1});
+  _measurements.emplace_back(Measurement{features, static_cast<double>(runtime.count())});
+}
+
+CostFeatures CostModelCalibration::_fit(const CostFeatures& initial_feature_costs) const {
+  auto feature_costs = initial_feature_costs;
+
+  auto exercised_features = std::array<bool, COST_FEATURE_COUNT>{};
+  for (const auto& measurement : _measurements) {
+    for (auto feature_idx = size_t{0}; feature_idx < COST_FEATURE_COUNT; ++feature_idx) {
+      if (measurement.features[feature_idx] > 0.0) exercised_features[feature_idx] = true;
+    }
+  }
+
+  // Coordinate descent for the non-negative least squares problem. Each measurement is weighted by its inverse squared
+  // runtime, so that the relative error is minimized. Otherwise, the largest inputs would dominate the fit.
+  for (auto iteration = 0; iteration < FIT_ITERATIONS; ++iteration) {
+    for (auto feature_idx = size_t{0}; feature_idx < COST_FEATURE_COUNT; ++feature_idx) {
+      if (!exercised_features[feature_idx]) continue;
+
+      auto numerator = 0.0;
+      auto denominator = 0.0;
+      for (const auto& measurement : _measurements) {
+        const auto feature_value = measurement.features[feature_idx];
+        if (feature_value == 0.0) continue;
+
+        auto other_features_runtime = 0.0;
+        for (auto other_feature_idx = size_t{0}; other_feature_idx < COST_FEATURE_COUNT; ++other_feature_idx) {
+          if (other_feature_idx == feature_idx) continue;
+          other_features_runtime += measurement.features[other_feature_idx] * feature_costs[other_feature_idx];
+        }
+
+        const auto weight = 1.0 / (measurement.runtime_ns * measurement.runtime_ns);
+        numerator += weight * feature_value * (measurement.runtime_ns - other_features_runtime);
+        denominator += weight * feature_value * feature_value;
+      }
+
+      feature_costs[feature_idx] = std::max(0.0, numerator / denominator);
+    }
+  }
+
+  return feature_costs;
+}
+
+}  // namespace opossum
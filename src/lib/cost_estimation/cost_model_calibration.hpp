@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cost_estimator_physical.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Determines the CostModelCoefficients of the CostEstimatorPhysical for the machine Hyrise runs on:
+ *
+ *  1. The relative read costs are measured by iterating over segments of every EncodingType.
+ *  2. Calibration tables of the given sizes are generated and joined (JoinHash, JoinSortMerge, JoinIndex) and
+ *     aggregated (AggregateHash, AggregateSort on unsorted and sorted input). For every execution, the estimator
+ *     provides the CostFeatures and the operator's walltime is measured.
+ *  3. The feature costs are fitted to the measurements with non-negative least squares. As the runtimes span several
+ *     orders of magnitude, the relative error is minimized. Features that none of the measured operators perform
+ *     keep their current value.
+ *
+ * The calibration tables are added to the StorageManager for the duration of the run (as the estimator looks up stored
+ * tables by name) and dropped afterwards. Calibrating takes a while, so run it once (e.g., using the
+ * hyriseCostModelCalibration binary) and pass the resulting coefficients to
+ * CostEstimatorPhysical::set_default_coefficients(). The benchmarks and the server load a file written by the binary
+ * at startup if it is passed via --cost_model_coefficients.
+ */
+class CostModelCalibration {
+ public:
+  explicit CostModelCalibration(const std::vector<size_t>& init_row_counts = {10'000, 100'000, 1'000'000},
+                                const size_t init_repetitions = 3);
+
+  CostModelCoefficients run();
+
+  const std::vector<size_t> row_counts;
+  const size_t repetitions;
+
+ private:
+  struct Measurement {
+    CostFeatures features;
+    double runtime_ns;
+  };
+
+  std::array<double, 6> _calibrate_read_costs() const;
+
+  // Generates the calibration tables for the given row count and adds them to the StorageManager
+  static void _generate_tables(const size_t row_count);
+  static void _drop_tables();
+
+  void _measure_joins(const CostEstimatorPhysical& estimator);
+  void _measure_aggregates(const CostEstimatorPhysical& estimator);
+
+  // Executes the operator (its inputs need to be executed already) and records its walltime
+  void _measure(const std::shared_ptr<AbstractOperator>& op, const CostFeatures& features);
+
+  // Fits the feature costs to the measurements, starting from (and falling back to) the given feature costs
+  CostFeatures _fit(const CostFeatures& initial_feature_costs) const;
+
+  std::vector<Measurement> _measurements;
+};
+
+}  // namespace opossum
@@ -20,6 +20,7 @@ Hyrise::Hyrise() {
   settings_manager = SettingsManager{};
   log_manager = LogManager{};
   topology = Topology{};
+  lz4_block_cache = std::make_shared<LZ4BlockCache>();
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
 }
 
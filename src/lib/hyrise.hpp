@@ -5,6 +5,8 @@
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "statistics/cardinality_feedback_cache.hpp"
+#include "storage/lz4_segment/lz4_block_cache.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/log_manager.hpp"
 #include "utils/meta_table_manager.hpp"
@@ -52,6 +54,14 @@ class Hyrise : public Singleton<Hyrise> {
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // Decompressed blocks of LZ4Segments, shared by all segments to speed up point accesses. If set to nullptr, no
+  // blocks are cached.
+  std::shared_ptr<LZ4BlockCache> lz4_block_cache;
+
+  // Cardinalities observed when executing queries, used by the CardinalityEstimator to correct its estimations. Not set
+  // by default, in which case no cardinalities are recorded.
+  std::shared_ptr<CardinalityFeedbackCache> cardinality_feedback_cache;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
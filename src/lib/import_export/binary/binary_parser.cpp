@@ -34,6 +34,15 @@ std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
   return table;
 }
 
+std::shared_ptr<AbstractSegment> BinaryParser::parse_segment(const std::string& filename, ChunkOffset row_count,
+                                                             DataType data_type, bool column_is_nullable) {
+  std::ifstream file;
+  file.open(filename, std::ios::binary);
+  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+
+  return _import_segment(file, row_count, data_type, column_is_nullable);
+}
+
 template <typename T>
 pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
   pmr_vector<T> values(count);
@@ -38,6 +38,10 @@ class BinaryParser {
    */
   static std::shared_ptr<Table> parse(const std::string& filename);
 
+  // Reads a single segment written by BinaryWriter::write_segment.
+  static std::shared_ptr<AbstractSegment> parse_segment(const std::string& filename, ChunkOffset row_count,
+                                                        DataType data_type, bool column_is_nullable);
+
  private:
   /*
    * Reads the header from the given file.
@@ -102,6 +102,17 @@ void BinaryWriter::write(const Table& table, const std::string& filename) {
   }
 }
 
+void BinaryWriter::write_segment(const AbstractSegment& segment, bool column_is_nullable,
+                                 const std::string& filename) {
+  std::ofstream ofstream;
+  ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  ofstream.open(filename, std::ios::binary);
+
+  resolve_data_and_segment_type(segment, [&](const auto data_type_t, const auto& resolved_segment) {
+    _write_segment(resolved_segment, column_is_nullable, ofstream);
+  });
+}
+
 void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
   const auto target_chunk_size = table.type() == TableType::Data ? table.target_chunk_size() : Chunk::DEFAULT_SIZE;
   export_value(ofstream, static_cast<ChunkOffset>(target_chunk_size));
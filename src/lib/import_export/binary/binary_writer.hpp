@@ -22,6 +22,10 @@ class BinaryWriter {
  public:
   static void write(const Table& table, const std::string& filename);
 
+  // Writes a single segment in the format described below (e.g., to evict it from memory, see
+  // Chunk::evict_segment). The segment can be read again using BinaryParser::parse_segment.
+  static void write_segment(const AbstractSegment& segment, bool column_is_nullable, const std::string& filename);
+
  private:
   /**
    * This methods writes the header of this table into the given ofstream.
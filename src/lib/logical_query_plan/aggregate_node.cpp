@@ -158,7 +158,11 @@ std::vector<FunctionalDependency> AggregateNode::non_trivial_functional_dependen
   return non_trivial_fds;
 }
 
-size_t AggregateNode::_on_shallow_hash() const { return aggregate_expressions_begin_idx; }
+size_t AggregateNode::_on_shallow_hash() const {
+  auto hash = boost::hash_value(aggregate_expressions_begin_idx);
+  boost::hash_combine(hash, aggregate_implementation);
+  return hash;
+}
 
 std::shared_ptr<AbstractLQPNode> AggregateNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
   const auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{
@@ -167,9 +171,11 @@ std::shared_ptr<AbstractLQPNode> AggregateNode::_on_shallow_copy(LQPNodeMapping&
   const auto aggregate_expressions = std::vector<std::shared_ptr<AbstractExpression>>{
       node_expressions.begin() + aggregate_expressions_begin_idx, node_expressions.end()};
 
-  return std::make_shared<AggregateNode>(
-      expressions_copy_and_adapt_to_different_lqp(group_by_expressions, node_mapping),
-      expressions_copy_and_adapt_to_different_lqp(aggregate_expressions, node_mapping));
+  const auto aggregate_node =
+      std::make_shared<AggregateNode>(expressions_copy_and_adapt_to_different_lqp(group_by_expressions, node_mapping),
+                                      expressions_copy_and_adapt_to_different_lqp(aggregate_expressions, node_mapping));
+  aggregate_node->aggregate_implementation = aggregate_implementation;
+  return aggregate_node;
 }
 
 bool AggregateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
@@ -177,6 +183,7 @@ bool AggregateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNode
 
   return expressions_equal_to_expressions_in_different_lqp(node_expressions, aggregate_node.node_expressions,
                                                            node_mapping) &&
-         aggregate_expressions_begin_idx == aggregate_node.aggregate_expressions_begin_idx;
+         aggregate_expressions_begin_idx == aggregate_node.aggregate_expressions_begin_idx &&
+         aggregate_implementation == aggregate_node.aggregate_implementation;
 }
 }  // namespace opossum
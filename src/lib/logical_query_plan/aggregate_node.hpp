@@ -10,6 +10,8 @@
 
 namespace opossum {
 
+enum class AggregateImplementation : uint8_t { Hash, FromMetadata };
+
 /**
  * This node type is used to describe SELECT lists for statements that have at least one of the following:
  *  - one or more aggregate functions in their SELECT list
@@ -38,6 +40,9 @@ class AggregateNode : public EnableMakeForLQPNode<AggregateNode>, public Abstrac
   // node_expression contains both the group_by- and the aggregate_expressions in that order.
   size_t aggregate_expressions_begin_idx;
 
+  // Set by the AggregateFromMetadataRule if the aggregates can be answered from the chunk metadata
+  AggregateImplementation aggregate_implementation{AggregateImplementation::Hash};
+
  protected:
   size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
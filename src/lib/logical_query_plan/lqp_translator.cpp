@@ -1,16 +1,15 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
 
-#include <boost/hana/for_each.hpp>
-#include <boost/hana/tuple.hpp>
-
 #include "abstract_lqp_node.hpp"
 #include "aggregate_node.hpp"
 #include "alias_node.hpp"
 #include "change_meta_table_node.hpp"
+#include "cost_estimation/cost_estimator_physical.hpp"
 #include "create_prepared_plan_node.hpp"
 #include "create_table_node.hpp"
 #include "create_view_node.hpp"
@@ -33,16 +32,20 @@
 #include "intersect_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "operators/aggregate_from_metadata.hpp"
 #include "operators/aggregate_hash.hpp"
+#include "operators/aggregate_sort.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
 #include "operators/delete.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
 #include "operators/import.hpp"
+#include "operators/index_only_scan.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -66,6 +69,9 @@
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/index/table_art/table_art_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
@@ -74,6 +80,13 @@ using namespace std::string_literals;  // NOLINT
 
 namespace opossum {
 
+LQPTranslator::LQPTranslator() {
+  if (CostEstimatorPhysical::has_calibrated_default_coefficients()) {
+    _cost_estimator = std::make_shared<CostEstimatorPhysical>(std::make_shared<CardinalityEstimator>());
+    _cost_estimator->guarantee_bottom_up_construction();
+  }
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -117,6 +130,11 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
   return pqp;
 }
 
+void LQPTranslator::register_operator(const std::shared_ptr<AbstractOperator>& op) {
+  Assert(op->lqp_node, "Operator needs an LQP node to be registered");
+  _operator_by_lqp_node.emplace(std::const_pointer_cast<AbstractLQPNode>(op->lqp_node), op);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     LQPNodeType type, const std::shared_ptr<AbstractLQPNode>& node) const {
   switch (type) {
@@ -224,12 +242,55 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
 
   const auto table_name = stored_table_node->table_name;
   const auto table = Hyrise::get().storage_manager.get_table(table_name);
+
+  // Table-wide indexes cover all chunks of the table, so that the IndexScan does not need to be combined with a
+  // TableScan. GetTable forwards the index to its output and maps the indexed ChunkIDs to those of its output if
+  // chunks were pruned (see GetTable::_on_execute). The index is defined on the ColumnIDs of the stored table, which
+  // GetTable maps to column_ids if columns were pruned. For equality predicates, a TableHashIndex is preferred over a
+  // TableARTIndex.
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->arguments[0]);
+  if (column_expression) {
+    auto table_index_type = SegmentIndexType::Invalid;
+    auto table_index_predicate_condition = predicate->predicate_condition;
+    auto table_index_right_values = right_values;
+    auto table_index_right_values2 = right_values2;
+    if (predicate->predicate_condition == PredicateCondition::Equals &&
+        table->get_table_hash_index({column_expression->original_column_id})) {
+      table_index_type = SegmentIndexType::TableHash;
+    } else if (TableARTIndex::is_supported(predicate->predicate_condition) &&
+               table->get_table_art_index(column_expression->original_column_id)) {
+      // If the search values cannot be cast to the data type of the column (e.g., `int_col < 3.5`), the chunk indexes
+      // and TableScans below are used instead.
+      const auto search_predicate =
+          TableARTIndex::cast_search_predicate(predicate->predicate_condition, value_variant,
+                                               value2_variant.value_or(NullValue{}), column_expression->data_type());
+      if (search_predicate) {
+        table_index_type = SegmentIndexType::TableART;
+        table_index_predicate_condition = search_predicate->predicate_condition;
+        table_index_right_values = {search_predicate->value};
+        if (value2_variant) table_index_right_values2 = {search_predicate->value2};
+      }
+    }
+
+    if (table_index_type != SegmentIndexType::Invalid) {
+      auto index_scan =
+          std::make_shared<IndexScan>(input_operator, table_index_type, column_ids, table_index_predicate_condition,
+                                      table_index_right_values, table_index_right_values2);
+      index_scan->lqp_node = node;
+      return index_scan;
+    }
+  }
+
   std::vector<ChunkID> indexed_chunks;
 
   auto pruned_table_chunk_id = ChunkID{0};
   auto pruned_chunk_ids_iter = pruned_chunk_ids.cbegin();
 
-  // Create a vector of chunk ids that have a GroupKey index and are not pruned.
+  // LIKE predicates are handled by TrigramIndexes, all other predicates by GroupKeyIndexes
+  const auto index_type = predicate->predicate_condition == PredicateCondition::Like ? SegmentIndexType::Trigram
+                                                                                     : SegmentIndexType::GroupKey;
+
+  // Create a vector of chunk ids that have an index of that type and are not pruned.
   const auto chunk_count = table->chunk_count();
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     // Check if chunk is pruned
@@ -237,9 +298,9 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
       ++pruned_chunk_ids_iter;
       continue;
     }
-    // Check if chunk has GroupKey index
+    // Check if chunk has an index of that type
     const auto chunk = table->get_chunk(chunk_id);
-    if (chunk && chunk->get_index(SegmentIndexType::GroupKey, column_ids)) {
+    if (chunk && chunk->get_index(index_type, column_ids)) {
       indexed_chunks.emplace_back(pruned_table_chunk_id);
     }
     ++pruned_table_chunk_id;
@@ -247,8 +308,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
 
   // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
   // TableScan(s).
-  auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
+  auto index_scan = std::make_shared<IndexScan>(input_operator, index_type, column_ids, predicate->predicate_condition,
+                                                right_values, right_values2);
 
   const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
 
@@ -348,37 +409,73 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   const auto& primary_join_predicate = join_predicates.front();
   std::vector<OperatorJoinPredicate> secondary_join_predicates(join_predicates.cbegin() + 1, join_predicates.cend());
 
-  auto join_operator = std::shared_ptr<AbstractOperator>{};
-
   const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
   const auto right_data_type = join_node->join_predicates().front()->arguments[1]->data_type();
+  const auto join_configuration = JoinConfiguration{join_node->join_mode, primary_join_predicate.predicate_condition,
+                                                    left_data_type, right_data_type,
+                                                    !secondary_join_predicates.empty()};
+
+  // With calibrated cost model coefficients, choose the cheapest of JoinHash, JoinSortMerge, and JoinIndex (with
+  // either input as index side). As its runtime is quadratic, the JoinNestedLoop is only used if none of them supports
+  // the join. Otherwise, an underestimated cardinality could have disastrous consequences.
+  auto join_operator_type = OperatorType::JoinNestedLoop;
+  auto index_side = IndexSide::Right;
+  if (_cost_estimator) {
+    auto min_cost = std::optional<Cost>{};
+    const auto consider_join_operator = [&](const OperatorType operator_type, const IndexSide operator_index_side) {
+      const auto features = _cost_estimator->join_features(join_node, operator_type, operator_index_side);
+      if (!features) return;
+
+      const auto cost = _cost_estimator->cost(*features);
+      if (min_cost && cost >= *min_cost) return;
+      join_operator_type = operator_type;
+      index_side = operator_index_side;
+      min_cost = cost;
+    };
+
+    consider_join_operator(OperatorType::JoinHash, IndexSide::Right);
+    consider_join_operator(OperatorType::JoinSortMerge, IndexSide::Right);
+    consider_join_operator(OperatorType::JoinIndex, IndexSide::Left);
+    consider_join_operator(OperatorType::JoinIndex, IndexSide::Right);
+  } else if (JoinHash::supports(join_configuration)) {
+    // Lacking calibrated coefficients, we assume JoinHash is always faster than JoinSortMerge, which is faster than
+    // JoinNestedLoop
+    join_operator_type = OperatorType::JoinHash;
+  } else if (JoinSortMerge::supports(join_configuration)) {
+    join_operator_type = OperatorType::JoinSortMerge;
+  }
 
-  // Lacking a proper cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
-  // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order
-  constexpr auto JOIN_OPERATOR_PREFERENCE_ORDER =
-      hana::to_tuple(hana::tuple_t<JoinHash, JoinSortMerge, JoinNestedLoop>);
-
-  boost::hana::for_each(JOIN_OPERATOR_PREFERENCE_ORDER, [&](const auto join_operator_t) {
-    using JoinOperator = typename decltype(join_operator_t)::type;
-
-    if (join_operator) return;
+  switch (join_operator_type) {
+    case OperatorType::JoinHash:
+      return std::make_shared<JoinHash>(left_input_operator, right_input_operator, join_node->join_mode,
+                                        primary_join_predicate, std::move(secondary_join_predicates));
+    case OperatorType::JoinSortMerge:
+      return std::make_shared<JoinSortMerge>(left_input_operator, right_input_operator, join_node->join_mode,
+                                             primary_join_predicate, std::move(secondary_join_predicates));
+    case OperatorType::JoinIndex:
+      return std::make_shared<JoinIndex>(left_input_operator, right_input_operator, join_node->join_mode,
+                                         primary_join_predicate, secondary_join_predicates, index_side);
+    default:
+      break;
+  }
 
-    if (JoinOperator::supports({join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
-                                right_data_type, !secondary_join_predicates.empty()})) {
-      join_operator = std::make_shared<JoinOperator>(left_input_operator, right_input_operator, join_node->join_mode,
-                                                     primary_join_predicate, std::move(secondary_join_predicates));
-    }
-  });
-  Assert(join_operator, "No operator implementation available for join '"s + join_node->description() + "'");
+  Assert(JoinNestedLoop::supports(join_configuration),
+         "No operator implementation available for join '"s + join_node->description() + "'");
 
-  return join_operator;
+  return std::make_shared<JoinNestedLoop>(left_input_operator, right_input_operator, join_node->join_mode,
+                                          primary_join_predicate, std::move(secondary_join_predicates));
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
+  const auto from_metadata = aggregate_node->aggregate_implementation == AggregateImplementation::FromMetadata;
 
-  const auto input_operator = translate_node(node->left_input());
+  // The AggregateFromMetadata performs the MVCC checks of the Validate on its own. The ColumnIDs are not affected by
+  // skipping the ValidateNode.
+  auto input_node = node->left_input();
+  if (from_metadata && input_node->type == LQPNodeType::Validate) input_node = input_node->left_input();
+  const auto input_operator = translate_node(input_node);
 
   std::vector<std::shared_ptr<AggregateExpression>> pqp_aggregate_expressions;
   pqp_aggregate_expressions.reserve(aggregate_node->node_expressions.size() -
@@ -410,6 +507,24 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     group_by_column_ids.emplace_back(*column_id);
   }
 
+  if (from_metadata) {
+    Assert(group_by_column_ids.empty(), "AggregateFromMetadata does not support GROUP BY");
+    return std::make_shared<AggregateFromMetadata>(input_operator, pqp_aggregate_expressions);
+  }
+
+  // With calibrated cost model coefficients, the AggregateSort is preferred if it is cheaper, e.g., because a
+  // JoinSortMerge already clustered and sorted its input by the group-by column. Without group-by columns, both
+  // operators only read the input once.
+  if (_cost_estimator && !group_by_column_ids.empty()) {
+    const auto input_is_join_sort_merge = input_operator->type() == OperatorType::JoinSortMerge;
+    const auto hash_cost = _cost_estimator->cost(_cost_estimator->aggregate_hash_features(aggregate_node));
+    const auto sort_cost =
+        _cost_estimator->cost(_cost_estimator->aggregate_sort_features(aggregate_node, input_is_join_sort_merge));
+    if (sort_cost < hash_cost) {
+      return std::make_shared<AggregateSort>(input_operator, pqp_aggregate_expressions, group_by_column_ids);
+    }
+  }
+
   return std::make_shared<AggregateHash>(input_operator, pqp_aggregate_expressions, group_by_column_ids);
 }
 
@@ -477,10 +592,79 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_except_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (auto index_only_scan = _translate_validate_node_to_index_only_scan(node)) return index_only_scan;
+
   const auto input_operator = translate_node(node->left_input());
   return std::make_shared<Validate>(input_operator);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node_to_index_only_scan(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node->left_input());
+  if (!predicate_node || predicate_node->scan_type != ScanType::IndexScan) return nullptr;
+
+  // The lookup in a table-wide index cannot exclude pruned chunks
+  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(predicate_node->left_input());
+  if (!stored_table_node || !stored_table_node->pruned_chunk_ids().empty()) return nullptr;
+
+  // Delete and Update require their input to reference the rows of the stored table
+  auto visited_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{node};
+  while (!visited_nodes.empty()) {
+    const auto visited_node = visited_nodes.back();
+    visited_nodes.pop_back();
+    if (visited_node->type == LQPNodeType::Delete || visited_node->type == LQPNodeType::Update) return nullptr;
+
+    const auto outputs = visited_node->outputs();
+    visited_nodes.insert(visited_nodes.end(), outputs.begin(), outputs.end());
+  }
+
+  const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(predicate_node->predicate());
+  if (!predicate || predicate->arguments.size() < 2) return nullptr;
+
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->arguments[0]);
+  if (!column_expression) return nullptr;
+
+  auto values = std::vector<AllTypeVariant>{};
+  for (auto argument_index = size_t{1}; argument_index < predicate->arguments.size(); ++argument_index) {
+    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[argument_index]);
+    if (!value_expression) return nullptr;
+    values.emplace_back(value_expression->value);
+  }
+  const auto right_values = std::vector<AllTypeVariant>{values[0]};
+  const auto right_values2 = values.size() > 1 ? std::vector<AllTypeVariant>{values[1]} : std::vector<AllTypeVariant>{};
+
+  // The index has to store all columns that are not pruned
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  const auto& pruned_column_ids = stored_table_node->pruned_column_ids();
+  auto output_column_ids = std::vector<ColumnID>{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    if (std::find(pruned_column_ids.begin(), pruned_column_ids.end(), column_id) == pruned_column_ids.end()) {
+      output_column_ids.emplace_back(column_id);
+    }
+  }
+
+  // As for the IndexScan, a TableHashIndex is preferred over a TableARTIndex for equality predicates
+  const auto index_column_id = column_expression->original_column_id;
+  auto index_type = SegmentIndexType::Invalid;
+  const auto table_hash_index = table->get_table_hash_index({index_column_id});
+  const auto table_art_index = table->get_table_art_index(index_column_id);
+  if (predicate->predicate_condition == PredicateCondition::Equals && table_hash_index &&
+      IndexOnlyScan::is_covering(*table_hash_index, output_column_ids)) {
+    index_type = SegmentIndexType::TableHash;
+  } else if (TableARTIndex::is_supported(predicate->predicate_condition) && table_art_index &&
+             IndexOnlyScan::is_covering(*table_art_index, output_column_ids)) {
+    index_type = SegmentIndexType::TableART;
+  } else {
+    return nullptr;
+  }
+
+  auto index_only_scan =
+      std::make_shared<IndexOnlyScan>(stored_table_node->table_name, index_type, std::vector<ColumnID>{index_column_id},
+                                      predicate->predicate_condition, right_values, right_values2, output_column_ids);
+  index_only_scan->lqp_node = node;
+  return index_only_scan;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_change_meta_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator_left = translate_node(node->left_input());
@@ -10,6 +10,7 @@
 namespace opossum {
 
 class AbstractOperator;
+class CostEstimatorPhysical;
 class TransactionContext;
 class AbstractExpression;
 class PredicateNode;
@@ -20,13 +21,25 @@ struct OperatorJoinPredicate;
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
  * engine, which in return is represented by its root Operator.
+ *
+ * Where multiple operators implement a node (joins and aggregates), the CostEstimatorPhysical chooses the operator
+ * once calibrated coefficients are set (see CostEstimatorPhysical::set_default_coefficients). Otherwise, a fixed order
+ * of preference is used.
  */
 class LQPTranslator {
  public:
+  LQPTranslator();
   virtual ~LQPTranslator() = default;
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  /**
+   * Makes translate_node() return @param op for LQP nodes that are equal to op->lqp_node instead of translating them.
+   * This is used to reuse operators that were already executed when a re-optimized LQP is translated during adaptive
+   * execution (see SQLPipelineStatement).
+   */
+  void register_operator(const std::shared_ptr<AbstractOperator>& op);
+
  private:
   std::shared_ptr<AbstractOperator> _translate_by_node_type(LQPNodeType type,
                                                             const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -55,6 +68,11 @@ class LQPTranslator {
       const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_validate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Returns an IndexOnlyScan if the Validate node is on top of an index scan on a stored table that can be answered
+  // using a covering table-wide index, nullptr otherwise
+  std::shared_ptr<AbstractOperator> _translate_validate_node_to_index_only_scan(
+      const std::shared_ptr<AbstractLQPNode>& node) const;
+
   // Maintenance operators
   std::shared_ptr<AbstractOperator> _translate_show_tables_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_show_columns_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -78,6 +96,10 @@ class LQPTranslator {
   //   - identical operators (operators below a diamond shape)
   //   - equal but not identical operators
   mutable LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>> _operator_by_lqp_node;
+
+  // Chooses between operator implementations, nullptr without calibrated coefficients. The LQP does not change during
+  // the translation, so cardinality estimates are cached.
+  std::shared_ptr<CostEstimatorPhysical> _cost_estimator;
 };
 
 }  // namespace opossum
@@ -19,6 +19,7 @@ enum class OperatorType {
   Aggregate,
   Alias,
   ChangeMetaTable,
+  ChunkMerge,
   CreateTable,
   CreatePreparedPlan,
   CreateView,
@@ -29,6 +30,7 @@ enum class OperatorType {
   Export,
   GetTable,
   Import,
+  IndexOnlyScan,
   IndexScan,
   Insert,
   JoinHash,
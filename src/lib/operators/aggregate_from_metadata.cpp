@@ -0,0 +1,246 @@
+#include "aggregate_from_metadata.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/abstract_read_write_operator.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The NullValueRatioStatistics store the ratio as a float. The number of NULLs can be restored exactly from it as long
+// as the chunk has fewer than 2^23 rows.
+constexpr auto MAX_CHUNK_SIZE_FOR_NULL_COUNT = ChunkOffset{1} << 23;
+
+// Returns the number of NULLs in the segment if it is known without scanning the segment
+template <typename T>
+std::optional<ChunkOffset> null_count_from_metadata(const Chunk& chunk, const AttributeStatistics<T>* statistics,
+                                                    const bool nullable) {
+  if (!nullable) return ChunkOffset{0};
+  if (!statistics || !statistics->null_value_ratio || chunk.size() >= MAX_CHUNK_SIZE_FOR_NULL_COUNT) {
+    return std::nullopt;
+  }
+
+  const auto ratio = static_cast<double>(statistics->null_value_ratio->ratio);
+  return static_cast<ChunkOffset>(std::lround(ratio * static_cast<double>(chunk.size())));
+}
+
+// Returns the minimum and the maximum value of the segment if they are stored in its pruning statistics. Only the
+// bounds of statistics built by generate_chunk_pruning_statistics are exact. The filters of other statistics might
+// include values that the segment does not contain.
+template <typename T>
+std::optional<std::pair<T, T>> min_max_from_metadata(const AttributeStatistics<T>* statistics) {
+  if (!statistics || !statistics->has_exact_bounds) return std::nullopt;
+
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (statistics->range_filter && !statistics->range_filter->ranges.empty()) {
+      const auto& ranges = statistics->range_filter->ranges;
+      return std::make_pair(ranges.front().first, ranges.back().second);
+    }
+  }
+
+  if (statistics->min_max_filter) {
+    return std::make_pair(statistics->min_max_filter->min, statistics->min_max_filter->max);
+  }
+
+  return std::nullopt;
+}
+
+}  // namespace
+
+namespace opossum {
+
+AggregateFromMetadata::AggregateFromMetadata(const std::shared_ptr<AbstractOperator>& in,
+                                             const std::vector<std::shared_ptr<AggregateExpression>>& aggregates)
+    : AbstractAggregateOperator(in, aggregates, {}, std::make_unique<PerformanceData>()) {
+  Assert(std::all_of(_aggregates.begin(), _aggregates.end(),
+                     [](const auto& aggregate) { return is_supported(aggregate->aggregate_function); }),
+         "AggregateFromMetadata only supports MIN, MAX, and COUNT");
+}
+
+const std::string& AggregateFromMetadata::name() const {
+  static const auto name = std::string{"AggregateFromMetadata"};
+  return name;
+}
+
+bool AggregateFromMetadata::is_supported(const AggregateFunction aggregate_function) {
+  return aggregate_function == AggregateFunction::Min || aggregate_function == AggregateFunction::Max ||
+         aggregate_function == AggregateFunction::Count;
+}
+
+std::shared_ptr<AbstractOperator> AggregateFromMetadata::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<AggregateFromMetadata>(copied_left_input, _aggregates);
+}
+
+void AggregateFromMetadata::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> AggregateFromMetadata::_on_execute() { return _on_execute(nullptr); }
+
+std::shared_ptr<const Table> AggregateFromMetadata::_on_execute(
+    std::shared_ptr<TransactionContext> transaction_context) {
+  DebugAssert(!transaction_context || transaction_context->phase() == TransactionPhase::Active,
+              "Transaction is not active anymore.");
+  _validate_aggregates();
+
+  const auto input_table = left_input_table();
+  Assert(input_table->type() == TableType::Data, "AggregateFromMetadata expects a stored table as input");
+  const auto chunk_count = input_table->chunk_count();
+
+  /**
+   * Determine the rows that are visible to the transaction. For chunks that are entirely visible, the filter remains
+   * nullptr and the metadata can be used. The conditions are the same as for the shortcut in the Validate operator.
+   */
+  auto position_filters = std::vector<std::shared_ptr<const AbstractPosList>>(chunk_count);
+  if (transaction_context && input_table->uses_mvcc() == UseMvcc::Yes) {
+    const auto our_tid = transaction_context->transaction_id();
+    const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+    const auto& read_write_operators = transaction_context->read_write_operators();
+    const auto has_deletes = std::any_of(read_write_operators.begin(), read_write_operators.end(),
+                                         [](const auto& read_write_operator) {
+                                           return read_write_operator->type() == OperatorType::Delete;
+                                         });
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+      if (!has_deletes && Validate::is_entire_chunk_visible(*chunk, snapshot_commit_id)) continue;
+
+      const auto& mvcc_data = chunk->mvcc_data();
+      auto visible_rows = std::make_shared<RowIDPosList>();
+      visible_rows->guarantee_single_chunk();
+      const auto chunk_size = chunk->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (Validate::is_row_visible(our_tid, snapshot_commit_id, mvcc_data->get_tid(chunk_offset),
+                                     mvcc_data->get_begin_cid(chunk_offset), mvcc_data->get_end_cid(chunk_offset))) {
+          visible_rows->emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+      position_filters[chunk_id] = std::move(visible_rows);
+    }
+  }
+
+  // Stores for each chunk whether its MvccData or at least one of its segments was scanned
+  auto scanned_chunks = std::vector<bool>(chunk_count, false);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    scanned_chunks[chunk_id] = position_filters[chunk_id] != nullptr;
+  }
+
+  _output_column_definitions.clear();
+  _output_segments.clear();
+
+  for (const auto& aggregate : _aggregates) {
+    const auto column_id = static_cast<const PQPColumnExpression&>(*aggregate->argument()).column_id;
+
+    if (column_id == INVALID_COLUMN_ID) {
+      // COUNT(*) only requires the number of visible rows
+      auto count = int64_t{0};
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto& position_filter = position_filters[chunk_id];
+        count += position_filter ? position_filter->size() : input_table->get_chunk(chunk_id)->size();
+      }
+
+      _output_column_definitions.emplace_back(aggregate->as_column_name(), DataType::Long, false);
+      _output_segments.emplace_back(std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{count}));
+      continue;
+    }
+
+    const auto aggregate_function = aggregate->aggregate_function;
+    const auto nullable = input_table->column_is_nullable(column_id);
+
+    resolve_data_type(input_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto count = int64_t{0};
+      auto result = std::optional<ColumnDataType>{};
+
+      const auto add_value = [&](const ColumnDataType& value) {
+        if (!result || (aggregate_function == AggregateFunction::Min ? value < *result : *result < value)) {
+          result = value;
+        }
+      };
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        const auto& position_filter = position_filters[chunk_id];
+
+        if (!position_filter) {
+          const auto& pruning_statistics = chunk->pruning_statistics();
+          const auto* const statistics =
+              pruning_statistics
+                  ? dynamic_cast<const AttributeStatistics<ColumnDataType>*>((*pruning_statistics)[column_id].get())
+                  : nullptr;
+
+          const auto null_count = null_count_from_metadata(*chunk, statistics, nullable);
+          if (aggregate_function == AggregateFunction::Count && null_count) {
+            count += chunk->size() - *null_count;
+            continue;
+          }
+
+          if (aggregate_function != AggregateFunction::Count) {
+            // Segments that only contain NULLs do not have a minimum or maximum
+            if (null_count && *null_count == chunk->size()) continue;
+
+            const auto min_max = min_max_from_metadata(statistics);
+            if (min_max) {
+              add_value(aggregate_function == AggregateFunction::Min ? min_max->first : min_max->second);
+              continue;
+            }
+          }
+        }
+
+        scanned_chunks[chunk_id] = true;
+        segment_iterate_filtered<ColumnDataType>(*chunk->get_segment(column_id), position_filter,
+                                                 [&](const auto& position) {
+                                                   if (position.is_null()) return;
+                                                   ++count;
+                                                   add_value(position.value());
+                                                 });
+      }
+
+      if (aggregate_function == AggregateFunction::Count) {
+        _output_column_definitions.emplace_back(aggregate->as_column_name(), DataType::Long, false);
+        _output_segments.emplace_back(std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{count}));
+      } else {
+        // As in the AggregateHash, MIN and MAX are NULL if there are no values
+        auto values = pmr_vector<ColumnDataType>{result.value_or(ColumnDataType{})};
+        auto null_values = pmr_vector<bool>{!result};
+        _output_column_definitions.emplace_back(aggregate->as_column_name(), data_type_from_type<ColumnDataType>(),
+                                                true);
+        _output_segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      }
+    });
+  }
+
+  auto& operator_performance_data = static_cast<PerformanceData&>(*performance_data);
+  const auto num_chunks_scanned = std::count(scanned_chunks.begin(), scanned_chunks.end(), true);
+  operator_performance_data.num_chunks_scanned = num_chunks_scanned;
+  operator_performance_data.num_chunks_from_metadata = chunk_count - num_chunks_scanned;
+
+  auto output = std::make_shared<Table>(_output_column_definitions, TableType::Data);
+  output->append_chunk(_output_segments);
+  return output;
+}
+
+}  // namespace opossum
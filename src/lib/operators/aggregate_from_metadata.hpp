@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_aggregate_operator.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Calculates MIN, MAX, and COUNT aggregates without GROUP BY on a stored table (i.e., the output of a GetTable) from
+ * the metadata of its chunks where possible. For a chunk in which all rows are visible to the transaction (see
+ * Validate::is_entire_chunk_visible), COUNT(*) is the chunk size, and MIN, MAX, and COUNT(column) are taken from the
+ * chunk's pruning statistics. Only chunks that might contain invisible rows (e.g., mutable chunks or chunks with
+ * deleted rows) or that lack the required statistics are scanned. The MVCC checks of the Validate operator are
+ * performed by this operator, which replaces the combination of GetTable, Validate, and AggregateHash. Without a
+ * transaction context, all rows are considered visible.
+ *
+ * The output matches that of the AggregateHash.
+ */
+class AggregateFromMetadata : public AbstractAggregateOperator {
+ public:
+  AggregateFromMetadata(const std::shared_ptr<AbstractOperator>& in,
+                        const std::vector<std::shared_ptr<AggregateExpression>>& aggregates);
+
+  const std::string& name() const override;
+
+  // Returns whether the aggregate function can be calculated by this operator
+  static bool is_supported(const AggregateFunction aggregate_function);
+
+  struct PerformanceData : public OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps> {
+    std::atomic<size_t> num_chunks_from_metadata{0};
+    std::atomic<size_t> num_chunks_scanned{0};
+
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override {
+      OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps>::output_to_stream(stream, description_mode);
+
+      const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+      stream << separator << "Chunks: " << num_chunks_from_metadata.load() << " answered from metadata, ";
+      stream << num_chunks_scanned.load() << " scanned.";
+    }
+  };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+};
+
+}  // namespace opossum
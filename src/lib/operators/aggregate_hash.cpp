@@ -1,5 +1,6 @@
 #include "aggregate_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <optional>
@@ -18,7 +19,14 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment/shared_dictionary.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
@@ -129,6 +137,214 @@ AggregateKey& get_aggregate_key([[maybe_unused]] KeysPerChunk<AggregateKey>& key
   }
 }
 
+// Without GROUP BY columns, all rows contribute to the same result. MIN, MAX, SUM, AVG, and COUNT can then be
+// calculated per run of a RunLengthSegment instead of per row. For FrameOfReferenceSegments without NULLs, MIN is the
+// smallest block minimum and SUM/AVG add up the block minima and the offsets without decoding the values. Returns false
+// if the segment cannot be aggregated in its compressed form.
+template <typename ColumnDataType, AggregateFunction aggregate_function, typename Aggregator, typename GetResult>
+bool aggregate_compressed_segment(const AbstractSegment& abstract_segment, const Aggregator& aggregator,
+                                  const GetResult& get_result) {
+  using AggregateType = typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType;
+
+  constexpr auto IS_MIN_MAX =
+      aggregate_function == AggregateFunction::Min || aggregate_function == AggregateFunction::Max;
+  constexpr auto IS_SUM_AVG =
+      std::is_arithmetic_v<ColumnDataType> &&
+      (aggregate_function == AggregateFunction::Sum || aggregate_function == AggregateFunction::Avg);
+
+  if constexpr (IS_MIN_MAX || IS_SUM_AVG || aggregate_function == AggregateFunction::Count) {
+    const auto segment_size = abstract_segment.size();
+    if (segment_size == 0) return false;
+
+    if (const auto* segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&abstract_segment)) {
+      auto& result = get_result();
+
+      const auto& values = *segment->values();
+      const auto& null_values = *segment->null_values();
+      const auto& end_positions = *segment->end_positions();
+      const auto run_count = values.size();
+
+      auto run_begin = ChunkOffset{0};
+      for (auto run_index = size_t{0}; run_index < run_count; ++run_index) {
+        // End positions are inclusive
+        const auto run_end = static_cast<ChunkOffset>(end_positions[run_index] + 1);
+        const auto run_length = run_end - run_begin;
+        run_begin = run_end;
+
+        if (null_values[run_index]) continue;
+
+        if constexpr (IS_SUM_AVG) {
+          result.accumulator += static_cast<AggregateType>(values[run_index]) * static_cast<AggregateType>(run_length);
+        } else if constexpr (IS_MIN_MAX) {
+          aggregator(values[run_index], result.aggregate_count, result.accumulator);
+        }
+        result.aggregate_count += run_length;
+      }
+
+      segment->access_counter[SegmentAccessCounter::AccessType::Sequential] += segment_size;
+      return true;
+    }
+
+    if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                              hana::type_c<ColumnDataType>)) {
+      const auto* segment = dynamic_cast<const FrameOfReferenceSegment<ColumnDataType>*>(&abstract_segment);
+      if (!segment || segment->null_values() || aggregate_function == AggregateFunction::Max) return false;
+
+      auto& result = get_result();
+      const auto& block_minima = segment->block_minima();
+
+      if constexpr (aggregate_function == AggregateFunction::Min) {
+        aggregator(*std::min_element(block_minima.cbegin(), block_minima.cend()), result.aggregate_count,
+                   result.accumulator);
+      } else if constexpr (IS_SUM_AVG) {
+        // Each value is the minimum of its block plus its offset
+        constexpr auto BLOCK_SIZE = FrameOfReferenceSegment<ColumnDataType>::block_size;
+        const auto block_count = block_minima.size();
+        for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+          const auto block_row_count = std::min(size_t{BLOCK_SIZE}, segment_size - block_index * BLOCK_SIZE);
+          result.accumulator +=
+              static_cast<AggregateType>(block_minima[block_index]) * static_cast<AggregateType>(block_row_count);
+        }
+
+        resolve_compressed_vector_type(segment->offset_values(), [&](const auto& offset_values) {
+          auto offset_sum = uint64_t{0};
+          for (auto offset_it = offset_values.cbegin(); offset_it != offset_values.cend(); ++offset_it) {
+            offset_sum += *offset_it;
+          }
+          result.accumulator += static_cast<AggregateType>(offset_sum);
+        });
+      }
+      result.aggregate_count += segment_size;
+
+      segment->access_counter[SegmentAccessCounter::AccessType::Sequential] += segment_size;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// If all segments of a GROUP BY column share a dictionary (see get_shared_dictionary), their ValueIDs uniquely
+// identify the values across chunks. In this case, we use ValueID + 1 as the key and 0 for NULL. This saves us the
+// hashing of the values, which is especially expensive for strings. The segments of stored tables can be re-encoded
+// concurrently (see ChunkEncoder::attach_to_shared_dictionaries). Thus, each segment is checked to still use the shared
+// dictionary. The values of mutable chunks are not encoded yet and are looked up in the dictionary. If a segment does
+// not use the dictionary or a value is not part of it, false is returned and the caller falls back to hashing.
+template <typename AggregateKey, typename ColumnDataType>
+bool write_value_id_keys(const Table& input_table, const ColumnID groupby_column_id, const size_t group_column_index,
+                         const std::shared_ptr<const pmr_vector<ColumnDataType>>& shared_dictionary,
+                         KeysPerChunk<AggregateKey>& keys_per_chunk) {
+  const auto null_value_id = ValueID{static_cast<ValueID::base_type>(shared_dictionary->size())};
+
+  const auto set_key = [&](auto& keys, const ChunkOffset chunk_offset, const ValueID value_id) {
+    const auto id = value_id == null_value_id ? AggregateKeyEntry{0} : static_cast<AggregateKeyEntry>(value_id) + 1;
+    if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+      keys[chunk_offset] = id;
+    } else {
+      keys[chunk_offset][group_column_index] = id;
+    }
+  };
+
+  // Returns INVALID_VALUE_ID if the value is not part of the shared dictionary
+  const auto lookup_value_id = [&](const ColumnDataType& value) {
+    const auto it = std::lower_bound(shared_dictionary->cbegin(), shared_dictionary->cend(), value);
+    if (it == shared_dictionary->cend() || *it != value) return INVALID_VALUE_ID;
+    return ValueID{static_cast<ValueID::base_type>(std::distance(shared_dictionary->cbegin(), it))};
+  };
+
+  using DictionarySegmentPtr = std::shared_ptr<const DictionarySegment<ColumnDataType>>;
+  const auto get_dictionary_segment = [&](const std::shared_ptr<const AbstractSegment>& segment) {
+    const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment);
+    if (!dictionary_segment || dictionary_segment->dictionary() != shared_dictionary) return DictionarySegmentPtr{};
+    return dictionary_segment;
+  };
+
+  // Decompressors of the referenced attribute vectors, created on first access. Usually, all reference segments point
+  // to the same column, so the decompressors are reused across input chunks. The referenced segments are kept alive
+  // while their decompressors are in use.
+  auto referenced_table = std::shared_ptr<const Table>{};
+  auto referenced_column_id = INVALID_COLUMN_ID;
+  auto referenced_segments = std::vector<DictionarySegmentPtr>{};
+  auto referenced_value_segments = std::vector<std::shared_ptr<const ValueSegment<ColumnDataType>>>{};
+  auto decompressors = std::vector<std::unique_ptr<BaseVectorDecompressor>>{};
+
+  const auto chunk_count = input_table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    auto& keys = keys_per_chunk[chunk_id];
+    const auto segment = chunk->get_segment(groupby_column_id);
+
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      if (reference_segment->referenced_table() != referenced_table ||
+          reference_segment->referenced_column_id() != referenced_column_id) {
+        referenced_table = reference_segment->referenced_table();
+        referenced_column_id = reference_segment->referenced_column_id();
+        referenced_segments.clear();
+        referenced_segments.resize(referenced_table->chunk_count());
+        referenced_value_segments.clear();
+        referenced_value_segments.resize(referenced_table->chunk_count());
+        decompressors.clear();
+        decompressors.resize(referenced_table->chunk_count());
+      }
+
+      auto chunk_offset = ChunkOffset{0};
+      for (const auto& row_id : *reference_segment->pos_list()) {
+        if (row_id.is_null()) {
+          set_key(keys, chunk_offset, null_value_id);
+        } else {
+          auto& decompressor = decompressors[row_id.chunk_id];
+          auto& value_segment = referenced_value_segments[row_id.chunk_id];
+          if (!decompressor && !value_segment) {
+            const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+            const auto segment = referenced_chunk->get_segment(referenced_column_id);
+            if (referenced_chunk->is_mutable()) {
+              value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment);
+              if (!value_segment) return false;
+            } else {
+              auto& referenced_segment = referenced_segments[row_id.chunk_id];
+              referenced_segment = get_dictionary_segment(segment);
+              if (!referenced_segment) return false;
+              decompressor = referenced_segment->attribute_vector()->create_base_decompressor();
+            }
+          }
+
+          if (decompressor) {
+            set_key(keys, chunk_offset, ValueID{decompressor->get(row_id.chunk_offset)});
+          } else {
+            const auto value = value_segment->get_typed_value(row_id.chunk_offset);
+            const auto value_id = value ? lookup_value_id(*value) : null_value_id;
+            if (value_id == INVALID_VALUE_ID) return false;
+            set_key(keys, chunk_offset, value_id);
+          }
+        }
+        ++chunk_offset;
+      }
+    } else if (chunk->is_mutable()) {
+      auto contains_all_values = true;
+      segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+        if (!contains_all_values) return;
+        const auto value_id = position.is_null() ? null_value_id : lookup_value_id(position.value());
+        if (value_id == INVALID_VALUE_ID) {
+          contains_all_values = false;
+          return;
+        }
+        set_key(keys, position.chunk_offset(), value_id);
+      });
+      if (!contains_all_values) return false;
+    } else {
+      const auto dictionary_segment = get_dictionary_segment(segment);
+      if (!dictionary_segment) return false;
+      create_iterable_from_attribute_vector(*dictionary_segment).for_each([&](const auto& position) {
+        set_key(keys, position.chunk_offset(), position.value());
+      });
+    }
+  }
+
+  return true;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -202,6 +418,17 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
 
+  if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    const auto get_result = [&]() -> auto& {
+      return get_or_add_result(std::false_type{}, result_ids, results,
+                               get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, ChunkOffset{0}),
+                               RowID{chunk_id, ChunkOffset{0}});
+    };
+    if (aggregate_compressed_segment<ColumnDataType, aggregate_function>(abstract_segment, aggregator, get_result)) {
+      return;
+    }
+  }
+
   ChunkOffset chunk_offset{0};
 
   // CacheResultIds is a boolean type parameter that is forwarded to get_or_add_result, see the documentation over there
@@ -333,6 +560,12 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() const {
                 ++chunk_offset;
               });
             }
+          } else if (const auto shared_dictionary =
+                         get_shared_dictionary<ColumnDataType>(*input_table, groupby_column_id);
+                     shared_dictionary && write_value_id_keys<AggregateKey>(*input_table, groupby_column_id,
+                                                                            group_column_index, shared_dictionary,
+                                                                            keys_per_chunk)) {
+            // The keys have been written by write_value_id_keys
           } else {
             /*
             Store unique IDs for equal values in the groupby column (similar to dictionary encoding).
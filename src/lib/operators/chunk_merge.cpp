@@ -0,0 +1,268 @@
+#include "chunk_merge.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "delete.hpp"
+#include "hyrise.hpp"
+#include "insert.hpp"
+#include "resolve_type.hpp"
+#include "sort.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/abstract_table_index.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "table_wrapper.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkMerge::ChunkMerge(const std::string& target_table_name,
+                       const std::shared_ptr<const AbstractOperator>& rows_to_merge,
+                       const std::vector<SortColumnDefinition>& sort_definitions,
+                       const ChunkEncodingSpec& chunk_encoding_spec, const MergeRemainder merge_remainder)
+    : AbstractReadWriteOperator(OperatorType::ChunkMerge, rows_to_merge),
+      _target_table_name{target_table_name},
+      _sort_definitions{sort_definitions},
+      _chunk_encoding_spec{chunk_encoding_spec},
+      _merge_remainder{merge_remainder} {}
+
+const std::string& ChunkMerge::name() const {
+  static const auto name = std::string{"ChunkMerge"};
+  return name;
+}
+
+const std::vector<ChunkID>& ChunkMerge::merged_chunk_ids() const { return _merged_chunk_ids; }
+
+size_t ChunkMerge::inserted_row_count() const { return _inserted_row_count; }
+
+std::shared_ptr<const Table> ChunkMerge::_on_execute(std::shared_ptr<TransactionContext> context) {
+  _target_table = Hyrise::get().storage_manager.get_table(_target_table_name);
+
+  DebugAssert(context, "ChunkMerge needs a transaction context");
+  Assert(_target_table->uses_mvcc() == UseMvcc::Yes, "ChunkMerge requires a table with MVCC data");
+  Assert(left_input_table()->type() == TableType::References, "ChunkMerge expects a validated reference table");
+  Assert(_chunk_encoding_spec.size() == _target_table->column_count(), "ChunkEncodingSpec does not match the table");
+
+  // Delete does not accept empty input data
+  if (left_input_table()->empty()) return nullptr;
+
+  // 1. Delete the original rows. If another transaction has modified (or locked) one of them, we cannot merge.
+  _delete = std::make_shared<Delete>(_left_input);
+  _delete->set_transaction_context(context);
+  _delete->execute();
+
+  if (_delete->execute_failed()) {
+    _mark_as_failed();
+    return nullptr;
+  }
+
+  // 2. Write the (sorted) rows into new segments.
+  auto rows = left_input_table();
+  if (!_sort_definitions.empty()) {
+    const auto sort = std::make_shared<Sort>(_left_input, _sort_definitions, _target_table->target_chunk_size());
+    sort->execute();
+    rows = sort->get_output();
+  }
+
+  auto segments_by_chunk = _write_segments(rows);
+
+  // 3. If requested, insert the rows of a partially filled last chunk into the mutable tail of the table.
+  if (_merge_remainder == MergeRemainder::InsertIntoTail && !segments_by_chunk.empty() &&
+      segments_by_chunk.back().front()->size() < _target_table->target_chunk_size()) {
+    auto chunks = std::vector<std::shared_ptr<Chunk>>{std::make_shared<Chunk>(segments_by_chunk.back())};
+    segments_by_chunk.pop_back();
+
+    const auto remainder_table =
+        std::make_shared<Table>(_target_table->column_definitions(), TableType::Data, std::move(chunks));
+    _inserted_row_count = remainder_table->row_count();
+    const auto table_wrapper = std::make_shared<TableWrapper>(remainder_table);
+    table_wrapper->execute();
+
+    _insert = std::make_shared<Insert>(_target_table_name, table_wrapper);
+    _insert->set_transaction_context(context);
+    _insert->execute();
+
+    if (_insert->execute_failed()) {
+      _mark_as_failed();
+      return nullptr;
+    }
+  }
+
+  // Encode the segments of the remaining chunks
+  const auto column_data_types = _target_table->column_data_types();
+  for (auto& segments : segments_by_chunk) {
+    const auto column_count = static_cast<ColumnID::base_type>(segments.size());
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments[column_id] = ChunkEncoder::encode_segment(segments[column_id], column_data_types[column_id],
+                                                         _chunk_encoding_spec[column_id]);
+    }
+  }
+
+  // 4. Append the new chunks. Until the commit, their rows are only visible to our own transaction (same as for rows
+  //    added by the Insert operator).
+  const auto transaction_id = context->transaction_id();
+  for (const auto& segments : segments_by_chunk) {
+    const auto chunk_size = segments.front()->size();
+    const auto mvcc_data = std::make_shared<MvccData>(chunk_size, MvccData::MAX_COMMIT_ID);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_data->set_tid(chunk_offset, transaction_id, std::memory_order_relaxed);
+    }
+
+    // Setting max_begin_cid before the chunk is finalized prevents finalize() from scanning the (uncommitted)
+    // begin_cids. As no snapshot can be newer than MAX_COMMIT_ID, the Validate operator does not use its shortcut for
+    // this chunk until we have committed.
+    mvcc_data->max_begin_cid = MvccData::MAX_COMMIT_ID;
+
+    // The chunk is complete before other threads can see it. The pruning statistics are generated from the chunk's
+    // own dictionaries. Once the chunk is attached to a shared dictionary, the dictionary contains the values of all
+    // chunks.
+    const auto chunk = std::make_shared<Chunk>(segments, mvcc_data);
+    chunk->finalize();
+    generate_chunk_pruning_statistics(chunk);
+    if (!_sort_definitions.empty()) {
+      chunk->set_individually_sorted_by(_sort_definitions.front());
+    }
+
+    {
+      // As the chunk is immutable, Inserts do not write to it (see Table::claim_mutable_tail). The lock makes sure
+      // that we know the chunk's ID.
+      const auto append_lock = _target_table->acquire_append_mutex();
+      _target_table->append_chunk(chunk);
+      _merged_chunk_ids.emplace_back(_target_table->chunk_count() - 1);
+    }
+
+    // Attaching the chunk to a shared dictionary atomically replaces its segments (see Chunk::replace_segment)
+    ChunkEncoder::attach_to_shared_dictionaries(_target_table, _merged_chunk_ids.back());
+
+    // As for the Insert operator, the new rows are indexed right away. They become visible with our commit.
+    for (const auto& table_index : _target_table->table_indexes()) {
+      table_index->insert(*chunk, _merged_chunk_ids.back(), ChunkOffset{0}, chunk->size());
+    }
+    _target_table->create_chunk_indexes(_merged_chunk_ids.back());
+  }
+
+  return nullptr;
+}
+
+std::vector<Segments> ChunkMerge::_write_segments(const std::shared_ptr<const Table>& rows) const {
+  const auto target_chunk_size = _target_table->target_chunk_size();
+  const auto row_count = rows->row_count();
+  const auto output_chunk_count = static_cast<size_t>(std::ceil(static_cast<double>(row_count) / target_chunk_size));
+  auto segments_by_chunk = std::vector<Segments>(output_chunk_count);
+
+  const auto input_chunk_count = rows->chunk_count();
+  const auto column_count = rows->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto column_is_nullable = rows->column_is_nullable(column_id);
+
+    resolve_data_type(rows->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto values = pmr_vector<ColumnDataType>{};
+      auto null_values = pmr_vector<bool>{};
+      auto output_chunk_id = size_t{0};
+
+      const auto reserve = [&]() {
+        const auto remaining_rows = row_count - output_chunk_id * target_chunk_size;
+        const auto next_chunk_size =
+            std::min(static_cast<size_t>(target_chunk_size), static_cast<size_t>(remaining_rows));
+        values.reserve(next_chunk_size);
+        if (column_is_nullable) null_values.reserve(next_chunk_size);
+      };
+
+      const auto flush = [&]() {
+        if (column_is_nullable) {
+          segments_by_chunk[output_chunk_id].emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+        } else {
+          segments_by_chunk[output_chunk_id].emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+        values = pmr_vector<ColumnDataType>{};
+        null_values = pmr_vector<bool>{};
+        ++output_chunk_id;
+        if (output_chunk_id < output_chunk_count) reserve();
+      };
+
+      reserve();
+      for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
+        const auto& segment = *rows->get_chunk(input_chunk_id)->get_segment(column_id);
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          values.emplace_back(position.is_null() ? ColumnDataType{} : position.value());
+          if (column_is_nullable) null_values.emplace_back(position.is_null());
+
+          if (values.size() == target_chunk_size) flush();
+        });
+      }
+
+      if (!values.empty()) flush();
+    });
+  }
+
+  return segments_by_chunk;
+}
+
+std::shared_ptr<AbstractOperator> ChunkMerge::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<ChunkMerge>(_target_table_name, copied_left_input, _sort_definitions, _chunk_encoding_spec,
+                                      _merge_remainder);
+}
+
+void ChunkMerge::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+void ChunkMerge::_on_commit_records(const CommitID commit_id) {
+  for (const auto chunk_id : _merged_chunk_ids) {
+    const auto chunk = _target_table->get_chunk(chunk_id);
+    const auto mvcc_data = chunk->mvcc_data();
+
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, commit_id);
+      mvcc_data->set_tid(chunk_offset, 0u, std::memory_order_relaxed);
+    }
+
+    // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
+    std::atomic_thread_fence(std::memory_order_release);
+
+    mvcc_data->max_begin_cid = commit_id;
+  }
+}
+
+void ChunkMerge::_on_rollback_records() {
+  // The original rows are restored by the Delete operator, which registered itself with the transaction context.
+  for (const auto chunk_id : _merged_chunk_ids) {
+    const auto chunk = _target_table->get_chunk(chunk_id);
+    const auto mvcc_data = chunk->mvcc_data();
+
+    for (const auto& table_index : _target_table->table_indexes()) {
+      table_index->erase(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+    }
+
+    // As for the Insert operator, end_cids have to be set to 0 before the begin_cids. See Insert::_on_rollback_records.
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_data->set_end_cid(chunk_offset, 0u);
+    }
+    chunk->increase_invalid_row_count(chunk_size);
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, 0u);
+      mvcc_data->set_tid(chunk_offset, 0u, std::memory_order_relaxed);
+    }
+
+    // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+}
+
+}  // namespace opossum
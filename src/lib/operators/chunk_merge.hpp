@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_write_operator.hpp"
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Delete;
+class Insert;
+class Table;
+class TransactionContext;
+
+// Determines what happens to the rows that do not fill a complete chunk of the target chunk size: They are either
+// written to a partially filled chunk of their own or inserted into the target table's mutable tail.
+enum class MergeRemainder { AppendChunk, InsertIntoTail };
+
+/**
+ * Operator that moves the rows referenced by its input table into new, immutable chunks that are appended to the
+ * referenced table. The input rows are (optionally) sorted, written into chunks of the table's target chunk size,
+ * encoded, and equipped with pruning statistics. The original rows are deleted using the Delete operator. Thus, the
+ * merge is performed in one MVCC-safe step: Transactions with a snapshot before the commit see the original rows,
+ * later transactions see the merged chunks. Rows that do not fill a complete chunk can be inserted into the table's
+ * mutable tail within the same transaction instead (see MergeRemainder), so that no partially filled chunk is left.
+ *
+ * This is used to merge the write-optimized tail of a table (i.e., the mutable chunks filled by the Insert operator)
+ * into the read-optimized main part of the table. A partially filled mutable tail remains the target of Inserts, even
+ * though the new chunks are appended after it. Once the operator is committed, the chunks of the original rows
+ * do not contain any visible rows anymore and can be removed as done by the MvccDeletePlugin.
+ *
+ * Assumption: The input has been validated before and references a single stored table.
+ */
+class ChunkMerge : public AbstractReadWriteOperator {
+ public:
+  ChunkMerge(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& rows_to_merge,
+             const std::vector<SortColumnDefinition>& sort_definitions, const ChunkEncodingSpec& chunk_encoding_spec,
+             const MergeRemainder merge_remainder = MergeRemainder::AppendChunk);
+
+  const std::string& name() const override;
+
+  // IDs of the chunks that were appended to the target table, available after the execution.
+  const std::vector<ChunkID>& merged_chunk_ids() const;
+
+  // Number of rows that were inserted into the mutable tail (see MergeRemainder), available after the execution.
+  size_t inserted_row_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_commit_records(const CommitID commit_id) override;
+  void _on_rollback_records() override;
+
+ private:
+  // Materializes the (sorted) rows into chunks of the target table's target chunk size
+  std::vector<Segments> _write_segments(const std::shared_ptr<const Table>& rows) const;
+
+  const std::string _target_table_name;
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const ChunkEncodingSpec _chunk_encoding_spec;
+  const MergeRemainder _merge_remainder;
+
+  std::shared_ptr<Table> _target_table;
+  std::shared_ptr<Delete> _delete;
+  std::shared_ptr<Insert> _insert;
+  std::vector<ChunkID> _merged_chunk_ids;
+  size_t _inserted_row_count{0};
+};
+
+}  // namespace opossum
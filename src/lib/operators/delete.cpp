@@ -1,12 +1,15 @@
 #include "delete.hpp"
 
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
 
 #include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/abstract_table_index.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
@@ -103,6 +106,33 @@ void Delete::_on_commit_records(const CommitID commit_id) {
       referenced_chunk->increase_invalid_row_count(1);
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
+    referenced_table->increase_invalidated_row_count(referencing_segment->pos_list()->size());
+
+    _erase_from_table_indexes(referenced_table, *referencing_segment->pos_list(), commit_id);
+  }
+}
+
+void Delete::_erase_from_table_indexes(const std::shared_ptr<const Table>& referenced_table,
+                                       const AbstractPosList& pos_list, const CommitID commit_id) {
+  const auto& table_indexes = referenced_table->table_indexes();
+  if (table_indexes.empty()) return;
+
+  auto rows_by_chunk = std::map<ChunkID, RowIDPosList>{};
+  for (const auto row_id : pos_list) {
+    rows_by_chunk[row_id.chunk_id].emplace_back(row_id);
+  }
+
+  // Transactions with an older snapshot still see the deleted rows. Thus, the rows are only removed from the indexes
+  // once all active transactions have a snapshot that includes our commit (see AbstractTableIndex).
+  const auto& transaction_manager = Hyrise::get().transaction_manager;
+  const auto lowest_snapshot_commit_id =
+      transaction_manager.get_lowest_active_snapshot_commit_id().value_or(transaction_manager.last_commit_id());
+
+  for (const auto& table_index : table_indexes) {
+    for (const auto& [chunk_id, rows] : rows_by_chunk) {
+      table_index->erase_after_commit(*referenced_table->get_chunk(chunk_id), rows, commit_id);
+    }
+    table_index->erase_obsolete_entries(lowest_snapshot_commit_id);
   }
 }
 
@@ -30,6 +30,10 @@ class Delete : public AbstractReadWriteOperator {
   void _on_rollback_records() override;
 
  private:
+  // Schedules the removal of the deleted rows from the table-wide indexes of the referenced table
+  static void _erase_from_table_indexes(const std::shared_ptr<const Table>& referenced_table,
+                                        const AbstractPosList& pos_list, const CommitID commit_id);
+
   TransactionID _transaction_id;
   std::shared_ptr<const Table> _referencing_table;
 };
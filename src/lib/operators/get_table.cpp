@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "hyrise.hpp"
+#include "storage/index/abstract_table_index.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -186,6 +187,10 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       auto output_segments_iter = output_segments.begin();
       auto output_indexes = Indexes{};
 
+      // Forward the pruning statistics of the remaining columns so that the TableScan can use them for runtime pruning
+      const auto& stored_pruning_statistics = stored_chunk->pruning_statistics();
+      auto output_pruning_statistics = ChunkPruningStatistics{};
+
       auto pruned_column_ids_iter = _pruned_column_ids.begin();
       for (auto stored_column_id = ColumnID{0}; stored_column_id < stored_table->column_count(); ++stored_column_id) {
         // Skip `stored_column_id` if it is in the sorted vector `_pruned_column_ids`
@@ -206,6 +211,9 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
         }
 
         *output_segments_iter = stored_chunk->get_segment(stored_column_id);
+        if (stored_pruning_statistics) {
+          output_pruning_statistics.emplace_back((*stored_pruning_statistics)[stored_column_id]);
+        }
         auto indexes = stored_chunk->get_indexes({*output_segments_iter});
         if (!indexes.empty()) {
           output_indexes.insert(std::end(output_indexes), std::begin(indexes), std::end(indexes));
@@ -216,13 +224,20 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       *output_chunks_iter = std::make_shared<Chunk>(std::move(output_segments), stored_chunk->mvcc_data(),
                                                     stored_chunk->get_allocator(), std::move(output_indexes));
 
-      if (output_chunk_sorted_by) {
-        // Finalizing the output chunk here is safe because this path is only taken for
-        // a sorted chunk. Chunks should never be sorted when they are still mutable
+      if (output_chunk_sorted_by || stored_pruning_statistics) {
+        // Finalizing the output chunk here is safe because this path is only taken for a sorted chunk or a chunk with
+        // pruning statistics. Chunks should never be sorted or have pruning statistics when they are still mutable.
         (*output_chunks_iter)->finalize();
+      }
+
+      if (output_chunk_sorted_by) {
         (*output_chunks_iter)->set_individually_sorted_by(*output_chunk_sorted_by);
       }
 
+      if (stored_pruning_statistics) {
+        (*output_chunks_iter)->set_pruning_statistics(output_pruning_statistics);
+      }
+
       // The output chunk contains all rows that are in the stored chunk, including invalid rows. We forward this
       // information so that following operators (currently, the Validate operator) can use it for optimizations.
       (*output_chunks_iter)->increase_invalid_row_count(stored_chunk->invalid_row_count());
@@ -231,8 +246,45 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
     ++output_chunks_iter;
   }
 
-  return std::make_shared<Table>(pruned_column_definitions, TableType::Data, std::move(output_chunks),
-                                 stored_table->uses_mvcc());
+  const auto output_table = std::make_shared<Table>(pruned_column_definitions, TableType::Data,
+                                                    std::move(output_chunks), stored_table->uses_mvcc());
+
+  /**
+   * The RowIDs stored in table-wide indexes refer to the ChunkIDs of the stored table. If chunks were excluded, the
+   * output table maps them to its own ChunkIDs (see Table::map_table_index_row_ids). Rows of chunks that are not part
+   * of the output are dropped. Indexes on pruned columns are not forwarded, the ColumnIDs of the remaining indexed
+   * columns are mapped to the ColumnIDs of the output table.
+   */
+  const auto table_indexes = stored_table->table_indexes();
+  if (!table_indexes.empty() && !excluded_chunk_ids.empty()) {
+    auto table_index_chunk_ids = std::vector<ChunkID>(chunk_count, INVALID_CHUNK_ID);
+    auto output_chunk_id = ChunkID{0};
+    for (auto stored_chunk_id = ChunkID{0}; stored_chunk_id < chunk_count; ++stored_chunk_id) {
+      if (std::binary_search(excluded_chunk_ids.begin(), excluded_chunk_ids.end(), stored_chunk_id)) continue;
+      table_index_chunk_ids[stored_chunk_id] = output_chunk_id;
+      ++output_chunk_id;
+    }
+    output_table->set_table_index_chunk_ids(std::move(table_index_chunk_ids));
+  }
+
+  for (const auto& table_index : table_indexes) {
+    auto output_column_ids = std::vector<ColumnID>{};
+    for (const auto stored_column_id : table_index->column_ids()) {
+      const auto pruned_column_ids_iter =
+          std::lower_bound(_pruned_column_ids.begin(), _pruned_column_ids.end(), stored_column_id);
+      if (pruned_column_ids_iter != _pruned_column_ids.end() && *pruned_column_ids_iter == stored_column_id) break;
+
+      const auto columns_pruned_before = std::distance(_pruned_column_ids.begin(), pruned_column_ids_iter);
+      output_column_ids.emplace_back(
+          ColumnID{static_cast<uint16_t>(static_cast<size_t>(stored_column_id) - columns_pruned_before)});
+    }
+
+    if (output_column_ids.size() == table_index->column_ids().size()) {
+      output_table->add_table_index(table_index, output_column_ids);
+    }
+  }
+
+  return output_table;
 }
 
 }  // namespace opossum
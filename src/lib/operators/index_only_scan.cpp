@@ -0,0 +1,178 @@
+#include "index_only_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <magic_enum.hpp>
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "storage/index/table_art/table_art_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+IndexOnlyScan::IndexOnlyScan(const std::string& table_name, const SegmentIndexType index_type,
+                             const std::vector<ColumnID>& index_column_ids,
+                             const PredicateCondition predicate_condition,
+                             const std::vector<AllTypeVariant>& right_values,
+                             const std::vector<AllTypeVariant>& right_values2,
+                             const std::vector<ColumnID>& output_column_ids)
+    : AbstractReadOnlyOperator{OperatorType::IndexOnlyScan},
+      _table_name{table_name},
+      _index_type{index_type},
+      _index_column_ids{index_column_ids},
+      _predicate_condition{predicate_condition},
+      _right_values{right_values},
+      _right_values2{right_values2},
+      _output_column_ids{output_column_ids} {
+  Assert(_index_type == SegmentIndexType::TableHash || _index_type == SegmentIndexType::TableART,
+         "IndexOnlyScan requires a table-wide index");
+  Assert(_index_type != SegmentIndexType::TableHash || _predicate_condition == PredicateCondition::Equals,
+         "TableHashIndex only supports equality predicates");
+  Assert(!_output_column_ids.empty(), "IndexOnlyScan requires at least one output column");
+}
+
+const std::string& IndexOnlyScan::name() const {
+  static const auto name = std::string{"IndexOnlyScan"};
+  return name;
+}
+
+std::string IndexOnlyScan::description(DescriptionMode description_mode) const {
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "(" << _table_name << ")" << separator << magic_enum::enum_name(_index_type);
+  stream << separator << _predicate_condition;
+  for (const auto& value : _right_values) {
+    stream << " " << value;
+  }
+  for (const auto& value : _right_values2) {
+    stream << " " << value;
+  }
+  return stream.str();
+}
+
+bool IndexOnlyScan::is_covering(const AbstractTableIndex& table_index, const std::vector<ColumnID>& column_ids) {
+  const auto stored_column_ids = table_index.stored_column_ids();
+  return !stored_column_ids.empty() && std::all_of(column_ids.begin(), column_ids.end(), [&](const auto column_id) {
+    return std::find(stored_column_ids.begin(), stored_column_ids.end(), column_id) != stored_column_ids.end();
+  });
+}
+
+std::shared_ptr<AbstractOperator> IndexOnlyScan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<IndexOnlyScan>(_table_name, _index_type, _index_column_ids, _predicate_condition,
+                                         _right_values, _right_values2, _output_column_ids);
+}
+
+void IndexOnlyScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> IndexOnlyScan::_on_execute() { return _on_execute(nullptr); }
+
+std::shared_ptr<const Table> IndexOnlyScan::_on_execute(std::shared_ptr<TransactionContext> transaction_context) {
+  DebugAssert(!transaction_context || transaction_context->phase() == TransactionPhase::Active,
+              "Transaction is not active anymore.");
+
+  const auto stored_table = Hyrise::get().storage_manager.get_table(_table_name);
+
+  // Look up the matching rows
+  auto table_index = std::shared_ptr<AbstractTableIndex>{};
+  auto row_ids = std::vector<RowID>{};
+  if (_index_type == SegmentIndexType::TableHash) {
+    const auto table_hash_index = stored_table->get_table_hash_index(_index_column_ids);
+    Assert(table_hash_index, "TableHashIndex does not exist");
+    row_ids = table_hash_index->lookup(_right_values);
+    table_index = table_hash_index;
+  } else {
+    const auto table_art_index = stored_table->get_table_art_index(_index_column_ids.front());
+    Assert(table_art_index, "TableARTIndex does not exist");
+    row_ids = table_art_index->lookup(_predicate_condition, _right_values.front(),
+                                      _right_values2.empty() ? AllTypeVariant{} : _right_values2.front());
+    table_index = table_art_index;
+  }
+  Assert(is_covering(*table_index, _output_column_ids), "Index does not store all output columns");
+
+  // Sorting the matches makes the output deterministic and the accesses to the MvccData local
+  std::sort(row_ids.begin(), row_ids.end());
+
+  // Remove the matches that are not visible to the transaction. Without a transaction context, all matches are
+  // returned, as an IndexScan without a Validate would do.
+  if (transaction_context) {
+    const auto our_tid = transaction_context->transaction_id();
+    const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+    auto chunk_id = INVALID_CHUNK_ID;
+    auto mvcc_data = std::shared_ptr<const MvccData>{};
+    const auto is_invisible = [&](const auto& row_id) {
+      if (row_id.chunk_id != chunk_id) {
+        chunk_id = row_id.chunk_id;
+        const auto chunk = stored_table->get_chunk(chunk_id);
+        mvcc_data = chunk ? chunk->mvcc_data() : nullptr;
+      }
+
+      // Chunks that were physically deleted do not contain visible rows
+      if (!mvcc_data) return true;
+
+      const auto chunk_offset = row_id.chunk_offset;
+      return !Validate::is_row_visible(our_tid, snapshot_commit_id, mvcc_data->get_tid(chunk_offset),
+                                       mvcc_data->get_begin_cid(chunk_offset), mvcc_data->get_end_cid(chunk_offset));
+    };
+    row_ids.erase(std::remove_if(row_ids.begin(), row_ids.end(), is_invisible), row_ids.end());
+  }
+
+  // Build the output table from the values stored in the index
+  auto output_column_definitions = TableColumnDefinitions{};
+  for (const auto column_id : _output_column_ids) {
+    output_column_definitions.emplace_back(stored_table->column_definitions()[column_id]);
+  }
+  auto output_table = std::make_shared<Table>(output_column_definitions, TableType::Data);
+  if (row_ids.empty()) return output_table;
+
+  const auto stored_column_ids = table_index->stored_column_ids();
+  const auto stored_values = table_index->stored_values(row_ids);
+
+  auto segments = Segments{};
+  for (const auto column_id : _output_column_ids) {
+    const auto stored_column_iter = std::find(stored_column_ids.begin(), stored_column_ids.end(), column_id);
+    const auto& column_values = stored_values[std::distance(stored_column_ids.begin(), stored_column_iter)];
+    const auto nullable = stored_table->column_is_nullable(column_id);
+
+    resolve_data_type(stored_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto values = pmr_vector<ColumnDataType>(column_values.size());
+      auto null_values = pmr_vector<bool>(nullable ? column_values.size() : 0);
+      for (auto row_index = size_t{0}; row_index < column_values.size(); ++row_index) {
+        if (variant_is_null(column_values[row_index])) {
+          DebugAssert(nullable, "Unexpected NULL value");
+          null_values[row_index] = true;
+          continue;
+        }
+        values[row_index] = boost::get<ColumnDataType>(column_values[row_index]);
+      }
+
+      if (nullable) {
+        segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+  output_table->append_chunk(segments);
+
+  return output_table;
+}
+
+}  // namespace opossum
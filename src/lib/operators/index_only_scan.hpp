@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "all_type_variant.hpp"
+#include "storage/index/segment_index_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTableIndex;
+
+/**
+ * Answers a predicate on the indexed column of a stored table using a covering table-wide index, i.e., a
+ * TableHashIndex or TableARTIndex with included columns (see AbstractTableIndex). Instead of retrieving the matching
+ * rows from the table, the IndexOnlyScan takes the values of the output columns from the index. The visibility of the
+ * matches is checked using the MvccData of their chunks. Thus, the IndexOnlyScan replaces the combination of
+ * GetTable, IndexScan, and Validate for queries that fetch a few columns by key.
+ *
+ * All ColumnIDs refer to the stored table. The output columns have to be stored in the index. Unlike the IndexScan,
+ * the IndexOnlyScan outputs a data table.
+ */
+class IndexOnlyScan : public AbstractReadOnlyOperator {
+ public:
+  IndexOnlyScan(const std::string& table_name, const SegmentIndexType index_type,
+                const std::vector<ColumnID>& index_column_ids, const PredicateCondition predicate_condition,
+                const std::vector<AllTypeVariant>& right_values, const std::vector<AllTypeVariant>& right_values2,
+                const std::vector<ColumnID>& output_column_ids);
+
+  const std::string& name() const final;
+  std::string description(DescriptionMode description_mode) const final;
+
+  // Returns whether the index stores the values of all given columns
+  static bool is_covering(const AbstractTableIndex& table_index, const std::vector<ColumnID>& column_ids);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) final;
+  std::shared_ptr<const Table> _on_execute() final;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const std::string _table_name;
+  const SegmentIndexType _index_type;
+  const std::vector<ColumnID> _index_column_ids;
+  const PredicateCondition _predicate_condition;
+  const std::vector<AllTypeVariant> _right_values;
+  const std::vector<AllTypeVariant> _right_values2;
+  const std::vector<ColumnID> _output_column_ids;
+};
+
+}  // namespace opossum
@@ -9,10 +9,19 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 
+#include "expression/evaluation/like_matcher.hpp"
+#include "lossless_cast.hpp"
+#include "resolve_type.hpp"
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/table_art/table_art_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/index/trigram/trigram_index.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "type_comparison.hpp"
 
 #include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
 
 namespace opossum {
 
@@ -38,6 +47,14 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  if (is_table_index_type(_index_type)) {
+    if (auto row_ids = _lookup_table_index()) {
+      _append_table_index_matches(std::move(*row_ids));
+      return _out_table;
+    }
+    PerformanceWarning("Table-wide index not available for the input table, chunks are scanned instead.");
+  }
+
   std::mutex output_mutex;
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -97,8 +114,10 @@ std::shared_ptr<AbstractTask> IndexScan::_create_job(const ChunkID chunk_id, std
 }
 
 void IndexScan::_validate_input() {
-  Assert(_predicate_condition != PredicateCondition::Like, "Predicate condition not supported by index scan.");
+  Assert(_index_type != SegmentIndexType::Invalid, "Invalid index type.");
   Assert(_predicate_condition != PredicateCondition::NotLike, "Predicate condition not supported by index scan.");
+  Assert((_predicate_condition == PredicateCondition::Like) == (_index_type == SegmentIndexType::Trigram),
+         "LIKE predicates are only supported by TrigramIndexes, which do not support other predicates.");
 
   Assert(_left_column_ids.size() == _right_values.size(),
          "Count mismatch: left column IDs and right values don’t have same size.");
@@ -108,9 +127,171 @@ void IndexScan::_validate_input() {
   }
 
   Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
+
+  if (_index_type == SegmentIndexType::TableHash) {
+    Assert(_predicate_condition == PredicateCondition::Equals, "TableHashIndex only supports equality predicates.");
+  }
+
+  if (_index_type == SegmentIndexType::TableART) {
+    Assert(_left_column_ids.size() == 1, "TableARTIndex only supports single columns.");
+    Assert(TableARTIndex::is_supported(_predicate_condition), "Predicate condition not supported by TableARTIndex.");
+  }
+
+  if (_index_type == SegmentIndexType::Trigram) {
+    Assert(_left_column_ids.size() == 1, "TrigramIndex only supports single columns.");
+    Assert(data_type_from_all_type_variant(_right_values.front()) == DataType::String, "Expected string pattern.");
+  }
+}
+
+std::optional<std::vector<RowID>> IndexScan::_lookup_table_index() const {
+  if (_index_type == SegmentIndexType::TableHash) {
+    const auto table_hash_index = _in_table->get_table_hash_index(_left_column_ids);
+    if (!table_hash_index) return std::nullopt;
+    return table_hash_index->lookup(_right_values);
+  }
+
+  const auto table_art_index = _in_table->get_table_art_index(_left_column_ids.front());
+  if (!table_art_index) return std::nullopt;
+  return table_art_index->lookup(_predicate_condition, _right_values.front(),
+                                 _right_values2.empty() ? AllTypeVariant{} : _right_values2.front());
+}
+
+void IndexScan::_append_table_index_matches(std::vector<RowID> row_ids) {
+  const auto chunk_count = _in_table->chunk_count();
+  auto chunk_is_included = std::vector<bool>(chunk_count, included_chunk_ids.empty());
+  for (const auto chunk_id : included_chunk_ids) {
+    if (chunk_id < chunk_count) chunk_is_included[chunk_id] = true;
+  }
+
+  // The index also contains rows of chunks that are not part of the input table (e.g., chunks that were excluded by
+  // GetTable or appended after it was executed). These are ignored.
+  _in_table->map_table_index_row_ids(row_ids);
+  row_ids.erase(std::remove_if(row_ids.begin(), row_ids.end(),
+                               [&](const auto& row_id) {
+                                 return row_id.chunk_id >= chunk_count || !chunk_is_included[row_id.chunk_id];
+                               }),
+                row_ids.end());
+  std::sort(row_ids.begin(), row_ids.end());
+
+  // Emit one output chunk per referenced input chunk so that each PosList references a single chunk
+  auto chunk_begin = row_ids.cbegin();
+  while (chunk_begin != row_ids.cend()) {
+    const auto chunk_id = chunk_begin->chunk_id;
+    const auto chunk_end = std::find_if(chunk_begin, row_ids.cend(),
+                                        [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+
+    const auto chunk = _in_table->get_chunk(chunk_id);
+    if (chunk) {
+      const auto matches_out = std::make_shared<RowIDPosList>(chunk_begin, chunk_end);
+      matches_out->guarantee_single_chunk();
+
+      Segments segments;
+      for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+        segments.push_back(std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out));
+      }
+      _out_table->append_chunk(segments, nullptr, chunk->get_allocator());
+    }
+
+    chunk_begin = chunk_end;
+  }
+}
+
+RowIDPosList IndexScan::_scan_chunk_without_index(const ChunkID chunk_id) {
+  if (_predicate_condition == PredicateCondition::Like) return _match_like(chunk_id, std::nullopt);
+
+  // For equality predicates, each column can be checked on its own. Other predicates on composite indexes would
+  // require a lexicographical comparison, which is not implemented.
+  Assert(_predicate_condition == PredicateCondition::Equals || _left_column_ids.size() == 1,
+         "Scanning without an index is only supported for equality predicates or single columns.");
+
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  auto row_matches = std::vector<bool>(chunk->size(), true);
+
+  const auto column_count = _left_column_ids.size();
+  for (auto column_index = size_t{0}; column_index < column_count; ++column_index) {
+    const auto column_id = _left_column_ids[column_index];
+
+    resolve_data_type(_in_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto search_value = lossless_variant_cast<ColumnDataType>(_right_values[column_index]);
+      const auto search_value2 = is_between_predicate_condition(_predicate_condition)
+                                     ? lossless_variant_cast<ColumnDataType>(_right_values2[column_index])
+                                     : search_value;
+      if (!search_value || !search_value2) {
+        Assert(_predicate_condition == PredicateCondition::Equals,
+               "Search values must have the data type of the column.");
+        std::fill(row_matches.begin(), row_matches.end(), false);
+        return;
+      }
+
+      const auto filter_rows = [&](const auto& matches) {
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          // Rows that were inserted concurrently after we determined the chunk size are ignored
+          const auto chunk_offset = position.chunk_offset();
+          if (chunk_offset >= row_matches.size()) return;
+          if (position.is_null() || !matches(position.value())) row_matches[chunk_offset] = false;
+        });
+      };
+
+      if (is_between_predicate_condition(_predicate_condition)) {
+        with_between_comparator(_predicate_condition, [&](const auto& between_comparator) {
+          filter_rows([&](const auto& value) { return between_comparator(value, *search_value, *search_value2); });
+        });
+      } else {
+        with_comparator(_predicate_condition, [&](const auto& comparator) {
+          filter_rows([&](const auto& value) { return comparator(value, *search_value); });
+        });
+      }
+    });
+  }
+
+  auto matches_out = RowIDPosList{};
+  const auto chunk_size = static_cast<ChunkOffset>(row_matches.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (row_matches[chunk_offset]) matches_out.emplace_back(chunk_id, chunk_offset);
+  }
+  matches_out.guarantee_single_chunk();
+  return matches_out;
+}
+
+RowIDPosList IndexScan::_match_like(const ChunkID chunk_id,
+                                     const std::optional<std::vector<ChunkOffset>>& candidates) const {
+  const auto& segment = *_in_table->get_chunk(chunk_id)->get_segment(_left_column_ids.front());
+  auto matches_out = RowIDPosList{};
+
+  LikeMatcher{boost::get<pmr_string>(_right_values.front())}.resolve(false, [&](const auto& matcher) {
+    if (!candidates) {
+      segment_iterate<pmr_string>(segment, [&](const auto& position) {
+        if (position.is_null() || !matcher(position.value())) return;
+        matches_out.emplace_back(chunk_id, position.chunk_offset());
+      });
+      return;
+    }
+
+    if (candidates->empty()) return;
+
+    auto position_filter = std::make_shared<RowIDPosList>();
+    position_filter->reserve(candidates->size());
+    for (const auto chunk_offset : *candidates) {
+      position_filter->emplace_back(chunk_id, chunk_offset);
+    }
+    position_filter->guarantee_single_chunk();
+
+    // The chunk offsets of filtered positions refer to the position filter
+    segment_iterate_filtered<pmr_string>(segment, position_filter, [&](const auto& position) {
+      if (position.is_null() || !matcher(position.value())) return;
+      matches_out.emplace_back((*position_filter)[position.chunk_offset()]);
+    });
+  });
+
+  matches_out.guarantee_single_chunk();
+  return matches_out;
 }
 
 RowIDPosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
+  if (is_table_index_type(_index_type)) return _scan_chunk_without_index(chunk_id);
+
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
   auto range_begin = AbstractIndex::Iterator{};
@@ -120,7 +301,16 @@ RowIDPosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   auto matches_out = RowIDPosList{};
 
   const auto index = chunk->get_index(_index_type, _left_column_ids);
-  Assert(index, "Index of specified type not found for segment (vector).");
+  if (!index) {
+    // The index might have been dropped after the plan was created (see Table::drop_index)
+    PerformanceWarning("Index of specified type not found for segment (vector), the chunk is scanned instead.");
+    return _scan_chunk_without_index(chunk_id);
+  }
+
+  if (_index_type == SegmentIndexType::Trigram) {
+    const auto& trigram_index = static_cast<const TrigramIndex&>(*index);
+    return _match_like(chunk_id, trigram_index.candidates(boost::get<pmr_string>(_right_values.front())));
+  }
 
   switch (_predicate_condition) {
     case PredicateCondition::Equals: {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "abstract_read_only_operator.hpp"
 
@@ -18,6 +20,16 @@ class AbstractTask;
  * Operator that performs a predicate search using indexes
  *
  * Note: Scans only the set of chunks passed to the constructor
+ *
+ * With SegmentIndexType::TableHash, the table-wide TableHashIndex of the input table is used for equality predicates.
+ * With SegmentIndexType::TableART, the table-wide TableARTIndex is used for comparison and between predicates. As a
+ * single lookup covers all chunks, including mutable ones, no additional TableScan is needed. If the input table
+ * does not provide the index (e.g., because GetTable pruned chunks), the chunks are scanned instead.
+ *
+ * With SegmentIndexType::Trigram, the TrigramIndexes of the chunks yield candidate rows for LIKE predicates, which are
+ * then verified using the LikeMatcher.
+ *
+ * Similarly, chunks whose index was dropped after the plan was created (see Table::drop_index) are scanned.
  */
 class IndexScan : public AbstractReadOnlyOperator {
  public:
@@ -41,6 +53,14 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _validate_input();
   std::shared_ptr<AbstractTask> _create_job(const ChunkID chunk_id, std::mutex& output_mutex);
   RowIDPosList _scan_chunk(const ChunkID chunk_id);
+  RowIDPosList _scan_chunk_without_index(const ChunkID chunk_id);
+
+  // Returns the rows of the chunk that match the LIKE pattern, checking only the given candidates if there are any
+  RowIDPosList _match_like(const ChunkID chunk_id, const std::optional<std::vector<ChunkOffset>>& candidates) const;
+
+  // Returns the matches from the table-wide index, std::nullopt if the input table does not provide the index
+  std::optional<std::vector<RowID>> _lookup_table_index() const;
+  void _append_table_index_matches(std::vector<RowID> row_ids);
 
  private:
   const SegmentIndexType _index_type;
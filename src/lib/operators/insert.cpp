@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -9,6 +10,7 @@
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "storage/abstract_encoded_segment.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -68,6 +70,32 @@ void copy_value_range(const std::shared_ptr<const AbstractSegment>& source_abstr
   }
 }
 
+// Returns whether a row that has the same key as one of the inserted rows prevents the insert. This does not depend
+// on the snapshot of the inserting transaction, as uncommitted rows of concurrent transactions have to be considered
+// as well.
+bool violates_key_constraint(const MvccData& mvcc_data, const ChunkOffset chunk_offset,
+                             const TransactionID transaction_id) {
+  // The row was deleted by a committed transaction or its insert was rolled back
+  if (mvcc_data.get_end_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) return false;
+
+  // The row is committed and is being deleted by our own transaction (e.g., as part of an Update)
+  if (mvcc_data.get_begin_cid(chunk_offset) != MvccData::MAX_COMMIT_ID &&
+      mvcc_data.get_tid(chunk_offset) == transaction_id) {
+    return false;
+  }
+
+  // The row was inserted and deleted again by the same uncommitted transaction, which resets the TID (see Delete). It
+  // never becomes visible.
+  if (mvcc_data.get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID &&
+      mvcc_data.get_tid(chunk_offset) == INVALID_TRANSACTION_ID) {
+    return false;
+  }
+
+  // All other rows are either committed, inserted by an uncommitted transaction (which might be ours), or being
+  // deleted by another transaction that might still roll back.
+  return true;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -93,28 +121,22 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
   /**
    * 1. Allocate the required rows in the target Table, without actually copying data to them.
-   *    Do so while locking the table to prevent multiple threads modifying the table's size simultaneously.
-   *    Since allocation is expected to be faster than writing to the memory, allocating under lock and then writing -
-   *    in a second step - without lock will minimize the time that the Table's append_mutex is locked.
+   *    Do so while locking the insert lane of the current thread (see Table::InsertLane) to prevent multiple threads
+   *    from modifying the size of the lane's tail simultaneously. Inserts from other threads use other lanes and are
+   *    not blocked. Since allocation is expected to be faster than writing to the memory, allocating under lock and
+   *    then writing - in a second step - without lock will minimize the time that the lane is locked.
    */
   {
-    const auto append_lock = _target_table->acquire_append_mutex();
+    auto& insert_lane = _target_table->insert_lane();
+    const auto lane_lock = std::lock_guard<std::mutex>{insert_lane.mutex};
 
     auto remaining_rows = left_input_table()->row_count();
 
-    if (_target_table->chunk_count() == 0) {
-      _target_table->append_mutable_chunk();
-    }
     while (remaining_rows > 0) {
-      auto target_chunk_id = ChunkID{_target_table->chunk_count() - 1};
-      auto target_chunk = _target_table->get_chunk(target_chunk_id);
-
-      // If the last Chunk of the target Table is either immutable or full, append a new mutable Chunk
-      if (!target_chunk->is_mutable() || target_chunk->size() == _target_table->target_chunk_size()) {
-        _target_table->append_mutable_chunk();
-        ++target_chunk_id;
-        target_chunk = _target_table->get_chunk(target_chunk_id);
-      }
+      // The lane's tail is filled up before a new chunk is appended, even if immutable chunks were appended after it
+      // (e.g., by ChunkMerge)
+      const auto target_chunk_id = _target_table->claim_mutable_tail(insert_lane);
+      const auto target_chunk = _target_table->get_chunk(target_chunk_id);
 
       const auto num_rows_for_target_chunk =
           std::min<size_t>(_target_table->target_chunk_size() - target_chunk->size(), remaining_rows);
@@ -138,6 +160,9 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
         }
       }
 
+      // Register the Insert with the chunk so that it is not finalized before we committed or rolled back.
+      target_chunk->mvcc_data()->register_insert();
+
       // Make sure the MVCC data is written before the first segment (and thus the chunk) is resized
       std::atomic_thread_fence(std::memory_order_seq_cst);
 
@@ -213,9 +238,53 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  /**
+   * 3. Add the written rows to the table-wide indexes. Until we commit, other transactions find the rows in the index
+   *    but do not see them (same as for a scan).
+   */
+  for (const auto& table_index : _target_table->table_indexes()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+      table_index->insert(*target_chunk, target_chunk_range.chunk_id, target_chunk_range.begin_chunk_offset,
+                          target_chunk_range.end_chunk_offset);
+    }
+  }
+
+  /**
+   * 4. Check the enforced key constraints (see Table::add_key_constraint). As our rows have been added to the indexes
+   *    before, two transactions that concurrently insert the same key see each other's rows and at least one of them
+   *    fails. If the check fails, the rows are removed when the transaction is rolled back.
+   */
+  if (!_satisfies_key_constraints(context->transaction_id())) {
+    _mark_as_failed();
+  }
+
   return nullptr;
 }
 
+bool Insert::_satisfies_key_constraints(const TransactionID transaction_id) const {
+  for (const auto& key_constraint_index : _target_table->key_constraint_indexes()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+      const auto matches_per_row =
+          key_constraint_index->lookup(*target_chunk, target_chunk_range.chunk_id,
+                                       target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+
+      auto row_id = RowID{target_chunk_range.chunk_id, target_chunk_range.begin_chunk_offset};
+      for (const auto& matches : matches_per_row) {
+        for (const auto& match : matches) {
+          if (match == row_id) continue;
+
+          const auto& mvcc_data = *_target_table->get_chunk(match.chunk_id)->mvcc_data();
+          if (violates_key_constraint(mvcc_data, match.chunk_offset, transaction_id)) return false;
+        }
+        ++row_id.chunk_offset;
+      }
+    }
+  }
+  return true;
+}
+
 void Insert::_on_commit_records(const CommitID cid) {
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
@@ -229,6 +298,10 @@ void Insert::_on_commit_records(const CommitID cid) {
 
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
+
+    mvcc_data->deregister_insert();
+    _target_table->increase_inserted_row_count(target_chunk_range.end_chunk_offset -
+                                               target_chunk_range.begin_chunk_offset);
   }
 }
 
@@ -237,6 +310,12 @@ void Insert::_on_rollback_records() {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
     auto mvcc_data = target_chunk->mvcc_data();
 
+    // The rolled back rows are never visible to anyone, so they can be removed from the indexes right away
+    for (const auto& table_index : _target_table->table_indexes()) {
+      table_index->erase(*target_chunk, target_chunk_range.chunk_id, target_chunk_range.begin_chunk_offset,
+                         target_chunk_range.end_chunk_offset);
+    }
+
     /**
      * !!! Crucial comment, PLEASE READ AND _UNDERSTAND_ before altering any of the following code !!!
      *
@@ -270,6 +349,8 @@ void Insert::_on_rollback_records() {
 
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
+
+    mvcc_data->deregister_insert();
   }
 }
 
@@ -18,6 +18,11 @@ class TransactionContext;
  * the values to insert in a separate table using the same column layout.
  *
  * Assumption: The input has been validated before.
+ *
+ * The execution fails if the inserted rows violate an enforced key constraint of the target table (see
+ * Table::add_key_constraint), either among themselves or together with the rows of the table, including uncommitted
+ * rows of concurrent transactions. Rows that were inserted and deleted by the same transaction are still considered
+ * as existing until the transaction commits.
  */
 class Insert : public AbstractReadWriteOperator {
  public:
@@ -36,6 +41,9 @@ class Insert : public AbstractReadWriteOperator {
   void _on_rollback_records() override;
 
  private:
+  // Checks the inserted rows against the enforced key constraints of the target table
+  bool _satisfies_key_constraints(const TransactionID transaction_id) const;
+
   const std::string _target_table_name;
 
   // Ranges of rows to which the inserted values are written
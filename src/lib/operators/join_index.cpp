@@ -1,5 +1,6 @@
 #include "join_index.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -15,16 +16,33 @@
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
 #include "utils/timer.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the first index that supports value lookups, nullptr if there is none. TrigramIndexes only answer LIKE
+// predicates.
+std::shared_ptr<AbstractIndex> find_lookup_index(const std::vector<std::shared_ptr<AbstractIndex>>& indexes) {
+  const auto index_iter = std::find_if(indexes.cbegin(), indexes.cend(), [](const auto& index) {
+    return index->type() != SegmentIndexType::Trigram;
+  });
+  return index_iter != indexes.cend() ? *index_iter : nullptr;
+}
+
+}  // namespace
+
 namespace opossum {
 
 /*
- * This is an index join implementation. It expects to find an index on the index side column.
+ * This is an index join implementation. It expects to find an index on the index side column, either a segment index
+ * per chunk or a TableHashIndex for the entire index side table.
  * It can be used for all join modes except JoinMode::Cross.
  * For the remaining join types or if no index is found it falls back to a nested loop join.
  */
@@ -169,13 +187,11 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
       if (reference_segment_pos_list->references_single_chunk()) {
         const auto index_data_table_chunk = index_data_table->get_chunk((*reference_segment_pos_list)[0].chunk_id);
         Assert(index_data_table_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-        const auto& indexes = index_data_table_chunk->get_indexes(index_data_table_column_ids);
-
-        if (!indexes.empty()) {
-          // We assume the first index to be efficient for our join
-          // as we do not want to spend time on evaluating the best index inside of this join loop
-          const auto& index = indexes.front();
+        // We assume the first index to be efficient for our join
+        // as we do not want to spend time on evaluating the best index inside of this join loop
+        const auto index = find_lookup_index(index_data_table_chunk->get_indexes(index_data_table_column_ids));
 
+        if (index) {
           // Scan all chunks from the probe side input
           const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
           for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
@@ -201,6 +217,12 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
         nested_loop_joining_duration += timer.lap();
       }
     }
+  } else if (const auto table_hash_index = _table_hash_index()) {  // DATA JOIN using a table-wide index
+    _data_join_using_table_hash_index(*table_hash_index);
+    index_joining_duration += timer.lap();
+    join_index_performance_data.chunks_scanned_with_index += _index_input_table->chunk_count();
+
+    _append_matches_non_inner(is_semi_or_anti_join);
   } else {  // DATA JOIN since only inner joins are supported for a reference table on the index side
     // Scan all chunks for index input
     const auto chunk_count_index_input_table = _index_input_table->chunk_count();
@@ -208,14 +230,12 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
       const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
       Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-      const auto& indexes =
-          index_chunk->get_indexes(std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second});
-
-      if (!indexes.empty()) {
-        // We assume the first index to be efficient for our join
-        // as we do not want to spend time on evaluating the best index inside of this join loop
-        const auto& index = indexes.front();
+      // We assume the first index to be efficient for our join
+      // as we do not want to spend time on evaluating the best index inside of this join loop
+      const auto index_column_ids = std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second};
+      const auto index = find_lookup_index(index_chunk->get_indexes(index_column_ids));
 
+      if (index) {
         // Scan all chunks from the probe side input
         const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
         for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
@@ -459,6 +479,79 @@ void JoinIndex::_append_matches(const AbstractIndex::Iterator& range_begin, cons
   }
 }
 
+std::shared_ptr<const TableHashIndex> JoinIndex::_table_hash_index() const {
+  if (_index_input_table->type() != TableType::Data ||
+      _adjusted_primary_predicate.predicate_condition != PredicateCondition::Equals ||
+      _mode == JoinMode::AntiNullAsTrue) {
+    return nullptr;
+  }
+  return _index_input_table->get_table_hash_index({_adjusted_primary_predicate.column_ids.second});
+}
+
+void JoinIndex::_data_join_using_table_hash_index(const TableHashIndex& index) {
+  // The index might contain rows that were inserted after the index input table was passed to this operator or that
+  // belong to chunks excluded by GetTable. These are ignored, so that the result does not depend on concurrent
+  // modifications.
+  const auto index_chunk_count = _index_input_table->chunk_count();
+  auto index_chunk_sizes = std::vector<ChunkOffset>(index_chunk_count);
+  for (auto index_chunk_id = ChunkID{0}; index_chunk_id < index_chunk_count; ++index_chunk_id) {
+    const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
+    if (index_chunk) index_chunk_sizes[index_chunk_id] = index_chunk->size();
+  }
+
+  const auto probe_chunk_count = _probe_input_table->chunk_count();
+  for (auto probe_chunk_id = ChunkID{0}; probe_chunk_id < probe_chunk_count; ++probe_chunk_id) {
+    const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+    segment_iterate(*probe_segment, [&](const auto& probe_side_position) {
+      if (probe_side_position.is_null()) return;
+
+      auto index_matches = index.lookup({AllTypeVariant{probe_side_position.value()}});
+      _index_input_table->map_table_index_row_ids(index_matches);
+      index_matches.erase(std::remove_if(index_matches.begin(), index_matches.end(),
+                                         [&](const auto& row_id) {
+                                           return row_id.chunk_id >= index_chunk_count ||
+                                                  row_id.chunk_offset >= index_chunk_sizes[row_id.chunk_id];
+                                         }),
+                          index_matches.end());
+
+      _append_matches(index_matches, probe_side_position.chunk_offset(), probe_chunk_id);
+    });
+  }
+}
+
+void JoinIndex::_append_matches(const std::vector<RowID>& index_matches, const ChunkOffset probe_chunk_offset,
+                                const ChunkID probe_chunk_id) {
+  if (index_matches.empty()) {
+    return;
+  }
+
+  const auto is_semi_or_anti_join =
+      _mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
+
+  // Remember the matches for non-inner joins
+  if (((is_semi_or_anti_join || _mode == JoinMode::Left) && _index_side == IndexSide::Right) ||
+      (_mode == JoinMode::Right && _index_side == IndexSide::Left) || _mode == JoinMode::FullOuter) {
+    _probe_matches[probe_chunk_id][probe_chunk_offset] = true;
+  }
+
+  if (!is_semi_or_anti_join) {
+    // we replicate the probe side value for each index side value
+    std::fill_n(std::back_inserter(*_probe_pos_list), index_matches.size(), RowID{probe_chunk_id, probe_chunk_offset});
+    _index_pos_list->insert(_index_pos_list->end(), index_matches.begin(), index_matches.end());
+  }
+
+  if ((_mode == JoinMode::Left && _index_side == IndexSide::Left) ||
+      (_mode == JoinMode::Right && _index_side == IndexSide::Right) || _mode == JoinMode::FullOuter ||
+      (is_semi_or_anti_join && _index_side == IndexSide::Left)) {
+    for (const auto& row_id : index_matches) {
+      _index_matches[row_id.chunk_id][row_id.chunk_offset] = true;
+    }
+  }
+}
+
 void JoinIndex::_append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
                                              const RowIDPosList& index_table_matches) {
   for (const auto& index_side_row_id : index_table_matches) {
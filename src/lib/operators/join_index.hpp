@@ -14,6 +14,7 @@
 namespace opossum {
 
 class MultiPredicateJoinEvaluator;
+class TableHashIndex;
 using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
 
 /**
@@ -26,6 +27,9 @@ using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
    * fallback solution (nested join loop) is used. Using the fallback solution does not increment the number of chunks
    * scanned with index in the performance data.
    *
+   * For equi joins on a data table, a TableHashIndex on the index side column is used if present. Instead of probing
+   * the segment indexes of each chunk, a single lookup per probe side value is sufficient.
+   *
    * Note: An index needs to be present on the index side table in order to execute an index join.
    */
 class JoinIndex : public AbstractJoinOperator {
@@ -80,6 +84,14 @@ class JoinIndex : public AbstractJoinOperator {
                        const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
                        const ChunkID index_chunk_id);
 
+  // Returns the TableHashIndex of the index side table if it can be used for this join, nullptr otherwise
+  std::shared_ptr<const TableHashIndex> _table_hash_index() const;
+
+  void _data_join_using_table_hash_index(const TableHashIndex& index);
+
+  void _append_matches(const std::vector<RowID>& index_matches, const ChunkOffset probe_chunk_offset,
+                       const ChunkID probe_chunk_id);
+
   void _append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
                                     const RowIDPosList& index_table_matches);
 
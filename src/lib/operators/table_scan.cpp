@@ -1,5 +1,6 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -24,6 +25,8 @@
 #include "operators/operator_scan_predicate.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
@@ -38,6 +41,44 @@
 #include "utils/lossless_predicate_cast.hpp"
 #include "utils/performance_warning.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Checks the pruning statistics of the chunk and, if the chunk is sorted by the column, its first and last value
+bool chunk_cannot_match(const Chunk& chunk, const ColumnID column_id, const PredicateCondition predicate_condition,
+                        const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2) {
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (pruning_statistics && (*pruning_statistics)[column_id]->does_not_contain(predicate_condition, value, value2)) {
+    return true;
+  }
+
+  const auto& sorted_by = chunk.individually_sorted_by();
+  const auto sort_definition = std::find_if(sorted_by.cbegin(), sorted_by.cend(),
+                                            [&](const auto& definition) { return definition.column == column_id; });
+  if (sort_definition == sorted_by.cend() || chunk.size() == 0) return false;
+
+  // NULLs are stored before all values. If the first value is NULL, we do not search for the first non-NULL value.
+  const auto& segment = *chunk.get_segment(column_id);
+  const auto first_value = segment[ChunkOffset{0}];
+  const auto last_value = segment[static_cast<ChunkOffset>(chunk.size() - 1)];
+  if (variant_is_null(first_value) || variant_is_null(last_value)) return false;
+
+  auto cannot_match = false;
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto min = boost::get<ColumnDataType>(first_value);
+    auto max = boost::get<ColumnDataType>(last_value);
+    if (sort_definition->sort_mode == SortMode::Descending) std::swap(min, max);
+
+    cannot_match = MinMaxFilter<ColumnDataType>{min, max}.does_not_contain(predicate_condition, value, value2);
+  });
+  return cannot_match;
+}
+
+}  // namespace
+
 namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
@@ -86,7 +127,10 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   std::mutex output_mutex;
 
-  const auto excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
+  auto excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
+
+  const auto pruned_chunk_ids = _prune_chunks_at_runtime(*in_table, excluded_chunk_set);
+  excluded_chunk_set.insert(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend());
 
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
   output_chunks.reserve(in_table->chunk_count() - excluded_chunk_set.size());
@@ -207,10 +251,95 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   scan_performance_data.num_chunks_with_early_out = _impl->num_chunks_with_early_out.load();
   scan_performance_data.num_chunks_with_all_rows_matching = _impl->num_chunks_with_all_rows_matching.load();
   scan_performance_data.num_chunks_with_binary_search = _impl->num_chunks_with_binary_search.load();
+  scan_performance_data.num_chunks_with_run_length_scan = _impl->num_chunks_with_run_length_scan.load();
+  scan_performance_data.num_chunks_with_zone_map = _impl->num_chunks_with_zone_map.load();
+  scan_performance_data.num_chunks_pruned_at_runtime = pruned_chunk_ids.size();
 
   return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
 
+std::vector<ChunkID> TableScan::_prune_chunks_at_runtime(const Table& in_table,
+                                                        const std::unordered_set<ChunkID>& excluded_chunk_set) const {
+  auto pruned_chunk_ids = std::vector<ChunkID>{};
+
+  // Only predicates of the form <column> <condition> <value or parameter> can be pruned. We do not resolve
+  // uncorrelated subqueries here, as this would execute them a second time.
+  auto column_expression = std::shared_ptr<PQPColumnExpression>{};
+  auto predicate_condition = PredicateCondition::Equals;
+  auto value_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+
+  if (const auto binary_predicate_expression = std::dynamic_pointer_cast<BinaryPredicateExpression>(_predicate)) {
+    predicate_condition = binary_predicate_expression->predicate_condition;
+    if (!is_binary_numeric_predicate_condition(predicate_condition)) return pruned_chunk_ids;
+
+    column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(binary_predicate_expression->left_operand());
+    value_expressions = {binary_predicate_expression->right_operand()};
+    if (!column_expression) {
+      column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(binary_predicate_expression->right_operand());
+      value_expressions = {binary_predicate_expression->left_operand()};
+      predicate_condition = flip_predicate_condition(predicate_condition);
+    }
+  } else if (const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(_predicate)) {
+    predicate_condition = between_expression->predicate_condition;
+    column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(between_expression->value());
+    value_expressions = {between_expression->lower_bound(), between_expression->upper_bound()};
+  }
+
+  if (!column_expression) return pruned_chunk_ids;
+
+  // Predicates on literal values have already been considered by the ChunkPruningRule. Only predicates on parameters,
+  // whose values were unknown during optimization, are worth another look.
+  if (std::none_of(value_expressions.cbegin(), value_expressions.cend(), [](const auto& expression) {
+        return expression->type == ExpressionType::CorrelatedParameter;
+      })) {
+    return pruned_chunk_ids;
+  }
+
+  // As in the ChunkPruningRule, we rather skip pruning than risk pruning chunks based on lossy casts
+  auto values = std::vector<AllTypeVariant>{};
+  for (const auto& value_expression : value_expressions) {
+    const auto value = expression_get_value_or_parameter(*value_expression);
+    if (!value || variant_is_null(*value)) return pruned_chunk_ids;
+
+    const auto casted_value = lossless_variant_cast(*value, column_expression->data_type());
+    if (!casted_value) return pruned_chunk_ids;
+    values.emplace_back(*casted_value);
+  }
+  const auto value2 = values.size() == 2 ? std::optional<AllTypeVariant>{values[1]} : std::nullopt;
+
+  const auto column_id = column_expression->column_id;
+  const auto chunk_count = in_table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (excluded_chunk_set.count(chunk_id)) continue;
+    const auto chunk = in_table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    auto stored_chunk = chunk;
+    auto stored_column_id = column_id;
+    if (in_table.type() == TableType::References) {
+      // The values of a reference segment are a subset of the values of the referenced chunk if there is only one
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+      if (!reference_segment) continue;
+
+      const auto& pos_list = reference_segment->pos_list();
+      if (pos_list->empty() || !pos_list->references_single_chunk()) continue;
+
+      const auto first_row_id = (*pos_list)[ChunkOffset{0}];
+      if (first_row_id.is_null()) continue;
+
+      stored_chunk = reference_segment->referenced_table()->get_chunk(first_row_id.chunk_id);
+      stored_column_id = reference_segment->referenced_column_id();
+      if (!stored_chunk) continue;
+    }
+
+    if (chunk_cannot_match(*stored_chunk, stored_column_id, predicate_condition, values[0], value2)) {
+      pruned_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+
+  return pruned_chunk_ids;
+}
+
 std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
     const std::shared_ptr<AbstractExpression>& predicate) {
   // If the predicate has an uncorrelated subquery as an argument, we resolve that subquery first. That way, we can
@@ -3,6 +3,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
@@ -52,6 +53,9 @@ class TableScan : public AbstractReadOnlyOperator {
     std::atomic<size_t> num_chunks_with_early_out{0};
     std::atomic<size_t> num_chunks_with_all_rows_matching{0};
     std::atomic<size_t> num_chunks_with_binary_search{0};
+    std::atomic<size_t> num_chunks_with_run_length_scan{0};
+    std::atomic<size_t> num_chunks_with_zone_map{0};
+    std::atomic<size_t> num_chunks_pruned_at_runtime{0};
 
     void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override {
       OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps>::output_to_stream(stream, description_mode);
@@ -59,7 +63,10 @@ class TableScan : public AbstractReadOnlyOperator {
       const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
       stream << separator << "Chunks: " << num_chunks_with_early_out.load() << " skipped with no results, ";
       stream << separator << num_chunks_with_all_rows_matching.load() << " skipped with all matching, ";
-      stream << num_chunks_with_binary_search.load() << " scanned using binary search.";
+      stream << num_chunks_with_binary_search.load() << " scanned using binary search, ";
+      stream << num_chunks_with_run_length_scan.load() << " scanned per run, ";
+      stream << num_chunks_with_zone_map.load() << " scanned using zone maps, ";
+      stream << num_chunks_pruned_at_runtime.load() << " pruned at runtime.";
     }
   };
 
@@ -80,6 +87,12 @@ class TableScan : public AbstractReadOnlyOperator {
   static std::shared_ptr<AbstractExpression> _resolve_uncorrelated_subqueries(
       const std::shared_ptr<AbstractExpression>& predicate);
 
+  // Returns the chunks that cannot contain matches according to their pruning statistics or their sort order. This
+  // complements the ChunkPruningRule for predicates on correlated parameters, whose values are only known once
+  // set_parameters() was called. For reference tables, the chunk referenced by each input chunk is checked.
+  std::vector<ChunkID> _prune_chunks_at_runtime(const Table& in_table,
+                                                const std::unordered_set<ChunkID>& excluded_chunk_set) const;
+
  private:
   const std::shared_ptr<AbstractExpression> _predicate;
 
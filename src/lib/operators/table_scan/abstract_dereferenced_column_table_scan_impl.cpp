@@ -1,10 +1,14 @@
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "resolve_type.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/zone_map.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
@@ -27,13 +31,98 @@ std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chun
 
   if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
     _scan_reference_segment(*reference_segment, chunk_id, *matches);
-  } else {
+  } else if (!_scan_segment_with_zone_map(*chunk, *segment, chunk_id, *matches)) {
     _scan_non_reference_segment(*segment, chunk_id, *matches, nullptr);
   }
 
   return matches;
 }
 
+bool AbstractDereferencedColumnTableScanImpl::_scan_segment_with_zone_map(const Chunk& chunk,
+                                                                          const AbstractSegment& segment,
+                                                                          const ChunkID chunk_id,
+                                                                          RowIDPosList& matches) {
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (!pruning_statistics) return false;
+
+  // Segments that are sorted by the scanned column are scanned using a binary search, which is faster
+  const auto& chunk_sorted_by = chunk.individually_sorted_by();
+  if (std::any_of(chunk_sorted_by.cbegin(), chunk_sorted_by.cend(),
+                  [&](const auto& sorted_by) { return sorted_by.column == _column_id; })) {
+    return false;
+  }
+
+  const auto search_values = _zone_map_search_values();
+  if (!search_values) return false;
+
+  auto block_size = ChunkOffset{0};
+  auto block_matches = std::vector<ZoneMapBlockMatch>{};
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& segment_statistics =
+        static_cast<const AttributeStatistics<ColumnDataType>&>(*(*pruning_statistics)[_column_id]);
+    if (!segment_statistics.zone_map) return;
+
+    block_size = segment_statistics.zone_map->block_size;
+    block_matches =
+        segment_statistics.zone_map->match_blocks(predicate_condition, search_values->first, search_values->second);
+  });
+
+  // If all blocks have to be scanned, the regular scan is faster because it does not need position filters
+  if (std::all_of(block_matches.cbegin(), block_matches.cend(),
+                  [](const auto block_match) { return block_match == ZoneMapBlockMatch::Some; })) {
+    return false;
+  }
+
+  const auto segment_size = segment.size();
+  const auto block_count = block_matches.size();
+  DebugAssert(block_count * block_size >= segment_size && (block_count - 1) * block_size < segment_size,
+              "ZoneMap does not match segment");
+  ++num_chunks_with_zone_map;
+
+  // Consecutive blocks with the same result are handled together
+  for (auto run_begin = size_t{0}; run_begin < block_count;) {
+    const auto block_match = block_matches[run_begin];
+    auto run_end = run_begin + 1;
+    while (run_end < block_count && block_matches[run_end] == block_match) {
+      ++run_end;
+    }
+
+    const auto begin_offset = static_cast<ChunkOffset>(run_begin * block_size);
+    const auto end_offset = static_cast<ChunkOffset>(std::min(run_end * block_size, static_cast<size_t>(segment_size)));
+
+    if (block_match == ZoneMapBlockMatch::All) {
+      for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+        matches.emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    } else if (block_match == ZoneMapBlockMatch::Some) {
+      auto position_filter = std::make_shared<RowIDPosList>(end_offset - begin_offset);
+      for (auto index = ChunkOffset{0}; index < end_offset - begin_offset; ++index) {
+        (*position_filter)[index] = RowID{chunk_id, begin_offset + index};
+      }
+      position_filter->guarantee_single_chunk();
+
+      const auto num_previous_matches = matches.size();
+      _scan_non_reference_segment(segment, chunk_id, matches, position_filter);
+
+      // As in _scan_reference_segment, the scan has written the offsets within the position filter
+      for (auto match_idx = num_previous_matches; match_idx < matches.size(); ++match_idx) {
+        matches[match_idx].chunk_offset += begin_offset;
+      }
+    }
+
+    run_begin = run_end;
+  }
+
+  return true;
+}
+
+std::optional<std::pair<AllTypeVariant, std::optional<AllTypeVariant>>>
+AbstractDereferencedColumnTableScanImpl::_zone_map_search_values() const {
+  return std::nullopt;
+}
+
 void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment,
                                                                       const ChunkID chunk_id, RowIDPosList& matches) {
   const auto& pos_list = segment.pos_list();
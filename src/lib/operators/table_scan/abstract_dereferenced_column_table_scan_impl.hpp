@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 
 #include "abstract_table_scan_impl.hpp"
 
+#include "all_type_variant.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -15,6 +17,7 @@ class ReferenceSegment;
 class AbstractSegment;
 class BaseDictionarySegment;
 class AttributeVectorIterable;
+class Chunk;
 
 /**
  * @brief The base class of table scan implementations that operate on a single column and profit from references being
@@ -34,6 +37,15 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
  protected:
   void _scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id, RowIDPosList& matches);
 
+  // Uses the ZoneMap of the segment (if any, see zone_map.hpp) to skip blocks in which no row matches and to emit
+  // blocks in which all rows match without scanning them. Returns false if no ZoneMap was used.
+  bool _scan_segment_with_zone_map(const Chunk& chunk, const AbstractSegment& segment, const ChunkID chunk_id,
+                                   RowIDPosList& matches);
+
+  // Returns the value(s) that the column is compared to if the impl supports ZoneMaps. The second value is only set
+  // for BETWEEN predicates.
+  virtual std::optional<std::pair<AllTypeVariant, std::optional<AllTypeVariant>>> _zone_map_search_values() const;
+
   // Implemented by the separate Impls. They do not need to deal with ReferenceSegments anymore, as this class
   // takes care of that. We take `matches` as an in/out parameter instead of returning it because scans on multiple
   // referenced segments of a single ReferenceSegment should result in only one PosList. Storing it as a member is
@@ -5,6 +5,7 @@
 #include <type_traits>
 
 #include "expression/between_expression.hpp"
+#include "run_length_segment_search.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
@@ -57,11 +58,39 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
   // Select optimized or generic scanning implementation based on segment type
   if (dictionary_segment) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (!position_filter && _scan_run_length_segment(segment, chunk_id, matches)) {
+    ++num_chunks_with_run_length_scan;
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
 }
 
+std::optional<std::pair<AllTypeVariant, std::optional<AllTypeVariant>>>
+ColumnBetweenTableScanImpl::_zone_map_search_values() const {
+  return std::pair<AllTypeVariant, std::optional<AllTypeVariant>>{left_value, right_value};
+}
+
+bool ColumnBetweenTableScanImpl::_scan_run_length_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+                                                          RowIDPosList& matches) const {
+  auto is_run_length_segment = false;
+  resolve_data_type(_in_table->column_data_type(_column_id), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto* run_length_segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&segment);
+    if (!run_length_segment) return;
+    is_run_length_segment = true;
+
+    const auto typed_left_value = boost::get<ColumnDataType>(left_value);
+    const auto typed_right_value = boost::get<ColumnDataType>(right_value);
+    with_between_comparator(predicate_condition, [&](auto between_comparator_function) {
+      scan_run_length_segment(*run_length_segment, chunk_id, matches, [&](const ColumnDataType& run_value) {
+        return between_comparator_function(run_value, typed_left_value, typed_right_value);
+      });
+    });
+  });
+  return is_run_length_segment;
+}
+
 void ColumnBetweenTableScanImpl::_scan_generic_segment(
     const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) const {
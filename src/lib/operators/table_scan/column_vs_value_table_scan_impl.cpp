@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "run_length_segment_search.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
@@ -47,11 +48,38 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
 
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (!position_filter && _scan_run_length_segment(segment, chunk_id, matches)) {
+    ++num_chunks_with_run_length_scan;
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
 }
 
+std::optional<std::pair<AllTypeVariant, std::optional<AllTypeVariant>>>
+ColumnVsValueTableScanImpl::_zone_map_search_values() const {
+  return std::pair<AllTypeVariant, std::optional<AllTypeVariant>>{value, std::nullopt};
+}
+
+bool ColumnVsValueTableScanImpl::_scan_run_length_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+                                                          RowIDPosList& matches) const {
+  auto is_run_length_segment = false;
+  resolve_data_type(_in_table->column_data_type(_column_id), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto* run_length_segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&segment);
+    if (!run_length_segment) return;
+    is_run_length_segment = true;
+
+    const auto typed_value = boost::get<ColumnDataType>(value);
+    with_comparator(predicate_condition, [&](auto predicate_comparator) {
+      scan_run_length_segment(*run_length_segment, chunk_id, matches, [&](const ColumnDataType& run_value) {
+        return predicate_comparator(run_value, typed_value);
+      });
+    });
+  });
+  return is_run_length_segment;
+}
+
 void ColumnVsValueTableScanImpl::_scan_generic_segment(
     const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) const {
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/run_length_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Scans a RunLengthSegment in the compressed domain: the predicate is evaluated once per run and the positions of all
+ * matching runs are written to the matches. On sorted or clustered columns, runs are long, so that the number of
+ * comparisons is much smaller than the number of rows. NULL runs never match.
+ *
+ * Only used for unfiltered segments, as the runs would otherwise have to be intersected with the position filter.
+ */
+template <typename T, typename Predicate>
+void scan_run_length_segment(const RunLengthSegment<T>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                             const Predicate& predicate) {
+  const auto& values = *segment.values();
+  const auto& null_values = *segment.null_values();
+  const auto& end_positions = *segment.end_positions();
+  const auto run_count = values.size();
+
+  auto run_begin = ChunkOffset{0};
+  for (auto run_index = size_t{0}; run_index < run_count; ++run_index) {
+    // End positions are inclusive
+    const auto run_end = static_cast<ChunkOffset>(end_positions[run_index] + 1);
+
+    if (!null_values[run_index] && predicate(values[run_index])) {
+      const auto output_begin = matches.size();
+      matches.resize(output_begin + (run_end - run_begin));
+      for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+        matches[output_begin + (chunk_offset - run_begin)] = RowID{chunk_id, chunk_offset};
+      }
+    }
+
+    run_begin = run_end;
+  }
+
+  segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+}
+
+}  // namespace opossum
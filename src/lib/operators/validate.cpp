@@ -43,14 +43,18 @@ bool Validate::_is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chun
   Assert(
       _can_use_chunk_shortcut,
       "This call to _is_entire_chunk_visible is not allowed. Are there any DeleteOperators in the same transaction?");
-  DebugAssert(!std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0})),
-              "_is_entire_chunk_visible cannot be called on reference chunks.");
+  return is_entire_chunk_visible(*chunk, snapshot_commit_id);
+}
+
+bool Validate::is_entire_chunk_visible(const Chunk& chunk, const CommitID snapshot_commit_id) {
+  DebugAssert(!std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{0})),
+              "is_entire_chunk_visible cannot be called on reference chunks.");
 
-  const auto& mvcc_data = chunk->mvcc_data();
+  const auto& mvcc_data = chunk.mvcc_data();
   const auto max_begin_cid = mvcc_data->max_begin_cid;
   if (!max_begin_cid) return false;
 
-  return snapshot_commit_id >= max_begin_cid && chunk->invalid_row_count() == 0;
+  return snapshot_commit_id >= max_begin_cid && chunk.invalid_row_count() == 0;
 }
 
 Validate::Validate(const std::shared_ptr<AbstractOperator>& in)
@@ -28,6 +28,10 @@ class Validate : public AbstractReadOnlyOperator {
   static bool is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
                              const CommitID begin_cid, const CommitID end_cid);
 
+  // Returns whether all rows of the (data) chunk are visible to a transaction with the given snapshot commit id. This
+  // does not consider the rows deleted by the transaction itself. Consult _on_execute() for the conditions.
+  static bool is_entire_chunk_visible(const Chunk& chunk, const CommitID snapshot_commit_id);
+
  private:
   void _validate_chunks(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id_start,
                         const ChunkID chunk_id_end, const TransactionID our_tid, const TransactionID snapshot_commit_id,
@@ -8,6 +8,7 @@
 #include "expression/lqp_subquery_expression.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "strategy/aggregate_from_metadata_rule.hpp"
 #include "strategy/between_composition_rule.hpp"
 #include "strategy/chunk_pruning_rule.hpp"
 #include "strategy/column_pruning_rule.hpp"
@@ -100,6 +101,9 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<PredicateMergeRule>());
 
+  // Run after all rules that might add predicates between an AggregateNode and its StoredTableNode
+  optimizer->add_rule(std::make_unique<AggregateFromMetadataRule>());
+
   return optimizer;
 }
 
@@ -0,0 +1,50 @@
+#include "aggregate_from_metadata_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "operators/aggregate_from_metadata.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void AggregateFromMetadataRule::_apply_to_plan_without_subqueries(
+    const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Aggregate) {
+      auto& aggregate_node = static_cast<AggregateNode&>(*node);
+      if (_is_applicable(aggregate_node)) {
+        aggregate_node.aggregate_implementation = AggregateImplementation::FromMetadata;
+      }
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+bool AggregateFromMetadataRule::_is_applicable(const AggregateNode& aggregate_node) {
+  // With GROUP BY, the metadata of a chunk does not tell us anything about the single groups
+  if (aggregate_node.aggregate_expressions_begin_idx > 0) return false;
+
+  auto input_node = aggregate_node.left_input();
+  if (input_node->type == LQPNodeType::Validate) input_node = input_node->left_input();
+  if (input_node->type != LQPNodeType::StoredTable) return false;
+
+  const auto& aggregate_expressions = aggregate_node.node_expressions;
+  return std::all_of(aggregate_expressions.begin(), aggregate_expressions.end(), [&](const auto& expression) {
+    const auto& aggregate_expression = static_cast<const AggregateExpression&>(*expression);
+    if (!AggregateFromMetadata::is_supported(aggregate_expression.aggregate_function)) return false;
+
+    // Only columns of the stored table can be aggregated, no expressions calculated on top of them. COUNT(*) is
+    // represented by a column expression on the stored table as well.
+    const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(aggregate_expression.argument());
+    return column_expression && column_expression->original_node.lock() == input_node;
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AggregateNode;
+
+/**
+ * Monitoring queries such as `SELECT MAX(ts) FROM events` or `SELECT COUNT(*) FROM t` aggregate entire stored tables.
+ * Instead of scanning the table, they can mostly be answered from the chunk metadata (i.e., chunk sizes and pruning
+ * statistics). This rule finds AggregateNodes without GROUP BY that only calculate MIN, MAX, and COUNT on the columns
+ * of a StoredTableNode that is their direct input or the input of a ValidateNode below them. It sets their
+ * AggregateImplementation to FromMetadata, so that the LQPTranslator creates an AggregateFromMetadata operator, which
+ * scans only those chunks whose metadata cannot be used.
+ */
+class AggregateFromMetadataRule : public AbstractRule {
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+
+  static bool _is_applicable(const AggregateNode& aggregate_node);
+};
+
+}  // namespace opossum
@@ -170,33 +170,7 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(const Table& table, co
 bool ChunkPruningRule::_can_prune(const BaseAttributeStatistics& base_segment_statistics,
                                   const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
                                   const std::optional<AllTypeVariant>& variant_value2) {
-  auto can_prune = false;
-
-  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
-    using ColumnDataType = typename decltype(data_type_t)::type;
-
-    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
-
-    // Range filters are only available for arithmetic (non-string) types.
-    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
-      if (segment_statistics.range_filter) {
-        if (segment_statistics.range_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-          can_prune = true;
-        }
-      }
-      // RangeFilters contain all the information stored in a MinMaxFilter. There is no point in having both.
-      DebugAssert(!segment_statistics.min_max_filter,
-                  "Segment should not have a MinMaxFilter and a RangeFilter at the same time");
-    }
-
-    if (segment_statistics.min_max_filter) {
-      if (segment_statistics.min_max_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-        can_prune = true;
-      }
-    }
-  });
-
-  return can_prune;
+  return base_segment_statistics.does_not_contain(predicate_condition, variant_value, variant_value2);
 }
 
 bool ChunkPruningRule::_is_non_filtering_node(const AbstractLQPNode& node) {
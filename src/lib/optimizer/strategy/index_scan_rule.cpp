@@ -15,19 +15,12 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/cardinality_estimator.hpp"
+#include "storage/index/table_art/table_art_index.hpp"
+#include "storage/index/trigram/trigram_index.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-// Only if we expect num_output_rows <= num_input_rows * selectivity_threshold, the ScanType can be set to IndexScan.
-// This value is kind of arbitrarily chosen, but the following paper suggests something similar:
-// Access Path Selection in Main-Memory Optimized Data Systems: Should I Scan or Should I Probe?
-constexpr float INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01f;
-
-// Only if the number of input rows exceeds num_input_rows, the ScanType can be set to IndexScan.
-// The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
-constexpr float INDEX_SCAN_ROW_COUNT_THRESHOLD = 1000.0f;
-
 void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
   DebugAssert(cost_estimator, "IndexScanRule requires cost estimator to be set");
   Assert(lqp_root->type == LQPNodeType::Root, "ExpressionReductionRule needs root to hold onto");
@@ -57,7 +50,10 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_stati
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
   if (!_is_single_segment_index(index_statistics)) return false;
 
-  if (index_statistics.type != SegmentIndexType::GroupKey) return false;
+  if (index_statistics.type != SegmentIndexType::GroupKey && index_statistics.type != SegmentIndexType::Trigram &&
+      !is_table_index_type(index_statistics.type)) {
+    return false;
+  }
 
   const auto operator_predicates =
       OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
@@ -71,10 +67,48 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_stati
 
   if (index_statistics.column_ids[0] != operator_predicate.column_id) return false;
 
+  // TableHashIndexes only support equality predicates
+  if (index_statistics.type == SegmentIndexType::TableHash &&
+      operator_predicate.predicate_condition != PredicateCondition::Equals) {
+    return false;
+  }
+
+  if (index_statistics.type == SegmentIndexType::TableART) {
+    if (!TableARTIndex::is_supported(operator_predicate.predicate_condition)) return false;
+
+    // Search values that cannot be cast to the data type of the column are not supported. Placeholders are checked by
+    // the LQPTranslator once their values are known.
+    const auto& value2 = operator_predicate.value2;
+    if (is_variant(operator_predicate.value) && (!value2 || is_variant(*value2))) {
+      const auto data_type =
+          predicate_node->left_input()->output_expressions().at(operator_predicate.column_id)->data_type();
+      const auto search_predicate = TableARTIndex::cast_search_predicate(
+          operator_predicate.predicate_condition, boost::get<AllTypeVariant>(operator_predicate.value),
+          value2 ? boost::get<AllTypeVariant>(*value2) : AllTypeVariant{NullValue{}}, data_type);
+      if (!search_predicate) return false;
+    }
+  }
+
+  // TrigramIndexes only support LIKE predicates whose pattern has a literal part of at least three characters, the
+  // other indexes do not support LIKE predicates
+  if ((index_statistics.type == SegmentIndexType::Trigram) !=
+      (operator_predicate.predicate_condition == PredicateCondition::Like)) {
+    return false;
+  }
+
   const auto row_count_table =
       cost_estimator->cardinality_estimator->estimate_cardinality(predicate_node->left_input());
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
 
+  if (index_statistics.type == SegmentIndexType::Trigram) {
+    // The cardinality estimator assumes a fixed selectivity for LIKE predicates, which is no basis for a decision.
+    // Instead, the TrigramIndex is used whenever it can narrow down the candidates.
+    if (!is_variant(operator_predicate.value)) return false;
+    const auto& pattern = boost::get<AllTypeVariant>(operator_predicate.value);
+    return data_type_from_all_type_variant(pattern) == DataType::String &&
+           TrigramIndex::is_pattern_supported(boost::get<pmr_string>(pattern));
+  }
+
   const auto row_count_predicate = cost_estimator->cardinality_estimator->estimate_cardinality(predicate_node);
   const float selectivity = row_count_predicate / row_count_table;
 
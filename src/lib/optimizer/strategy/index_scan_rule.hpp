@@ -22,10 +22,21 @@ class PredicateNode;
  * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * Currently, only GroupKeyIndexes, TrigramIndexes (for LIKE predicates), and the table-wide TableHashIndexes and
+ * TableARTIndexes are supported.
  */
 
 class IndexScanRule : public AbstractRule {
+ public:
+  // Only if we expect num_output_rows <= num_input_rows * selectivity_threshold, the ScanType can be set to IndexScan.
+  // This value is kind of arbitrarily chosen, but the following paper suggests something similar:
+  // Access Path Selection in Main-Memory Optimized Data Systems: Should I Scan or Should I Probe?
+  static constexpr float INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01f;
+
+  // Only if the number of input rows exceeds num_input_rows, the ScanType can be set to IndexScan.
+  // The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
+  static constexpr float INDEX_SCAN_ROW_COUNT_THRESHOLD = 1000.0f;
+
  protected:
   void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
   bool _is_index_scan_applicable(const IndexStatistics& index_statistics,
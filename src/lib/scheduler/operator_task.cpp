@@ -21,9 +21,25 @@ std::string OperatorTask::description() const {
 
 std::vector<std::shared_ptr<AbstractTask>> OperatorTask::make_tasks_from_operator(
     const std::shared_ptr<AbstractOperator>& op) {
+  return make_tasks_from_operators({op});
+}
+
+std::vector<std::shared_ptr<AbstractTask>> OperatorTask::make_tasks_from_operators(
+    const std::vector<std::shared_ptr<AbstractOperator>>& ops) {
   std::vector<std::shared_ptr<AbstractTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractTask>> task_by_op;
-  _add_tasks_from_operator(op, tasks, task_by_op);
+  for (const auto& op : ops) {
+    if (!op->performance_data->executed) _add_tasks_from_operator(op, tasks, task_by_op);
+  }
+
+  // Mark the requested operators only after all tasks were created, as an executed operator that was requested might
+  // still be the input of another requested operator
+  for (const auto& op : ops) {
+    const auto task_by_op_it = task_by_op.find(op);
+    if (task_by_op_it != task_by_op.end()) {
+      std::static_pointer_cast<OperatorTask>(task_by_op_it->second)->_keep_output = true;
+    }
+  }
   return tasks;
 }
 
@@ -36,14 +52,18 @@ std::shared_ptr<AbstractTask> OperatorTask::_add_tasks_from_operator(
   auto task = std::make_shared<OperatorTask>(op);
   task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_left_input()) {
-    auto subtree_root = _add_tasks_from_operator(left, tasks, task_by_op);
-    subtree_root->set_as_predecessor_of(task);
-  }
+  // The task of an operator that was already executed only acts as a finished predecessor of its consumers, so that
+  // they clear its output. Its inputs are not needed anymore.
+  if (!op->performance_data->executed) {
+    if (auto left = op->mutable_left_input()) {
+      auto subtree_root = _add_tasks_from_operator(left, tasks, task_by_op);
+      subtree_root->set_as_predecessor_of(task);
+    }
 
-  if (auto right = op->mutable_right_input()) {
-    auto subtree_root = _add_tasks_from_operator(right, tasks, task_by_op);
-    subtree_root->set_as_predecessor_of(task);
+    if (auto right = op->mutable_right_input()) {
+      auto subtree_root = _add_tasks_from_operator(right, tasks, task_by_op);
+      subtree_root->set_as_predecessor_of(task);
+    }
   }
 
   // Add AFTER the inputs to establish a task order where predecessor get executed before successors
@@ -55,6 +75,9 @@ std::shared_ptr<AbstractTask> OperatorTask::_add_tasks_from_operator(
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
 void OperatorTask::_on_execute() {
+  // See _add_tasks_from_operator
+  if (_op->performance_data->executed) return;
+
   auto context = _op->transaction_context();
   if (context) {
     switch (context->phase()) {
@@ -110,7 +133,7 @@ void OperatorTask::_on_execute() {
     }
     // If someone else still holds a shared_ptr to the table (e.g., a ReferenceSegment pointing to a materialized
     // temporary table), it will not yet get deleted
-    if (!previous_operator_still_needed) predecessor->get_operator()->clear_output();
+    if (!previous_operator_still_needed && !predecessor->_keep_output) predecessor->get_operator()->clear_output();
   }
 }
 }  // namespace opossum
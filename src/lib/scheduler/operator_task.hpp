@@ -20,11 +20,21 @@ class OperatorTask : public AbstractTask {
                bool stealable = true);
 
   /**
-   * Create tasks recursively from result operator and set task dependencies automatically.
+   * Create tasks recursively from result operator and set task dependencies automatically. Operators that were already
+   * executed (e.g., during adaptive execution, see SQLPipelineStatement) are not executed again. Their tasks finish
+   * immediately, so that their outputs are used and then cleared by their consumers. If the result operator was
+   * already executed, no tasks are created.
    */
   static std::vector<std::shared_ptr<AbstractTask>> make_tasks_from_operator(
       const std::shared_ptr<AbstractOperator>& op);
 
+  /**
+   * Create tasks for multiple operators, so that they can be scheduled together. Operators shared by their subplans
+   * are executed only once. The outputs of @param ops are not cleared, even if one of them is an input of another.
+   */
+  static std::vector<std::shared_ptr<AbstractTask>> make_tasks_from_operators(
+      const std::vector<std::shared_ptr<AbstractOperator>>& ops);
+
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
   std::string description() const override;
@@ -42,5 +52,8 @@ class OperatorTask : public AbstractTask {
 
  private:
   std::shared_ptr<AbstractOperator> _op;
+
+  // Set for the tasks of the operators passed to make_tasks_from_operators(), whose outputs are needed by the caller
+  bool _keep_output{false};
 };
 }  // namespace opossum
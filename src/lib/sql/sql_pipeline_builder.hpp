@@ -28,6 +28,7 @@ class Optimizer;
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
+ *  - Adaptive execution is disabled (see SQLPipelineStatement).
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -48,6 +49,12 @@ class SQLPipelineBuilder final {
    */
   SQLPipelineBuilder& disable_mvcc();
 
+  /**
+   * Re-optimizes SELECT statements during their execution if intermediate cardinalities were misestimated. Requires
+   * Hyrise::get().cardinality_feedback_cache to be set.
+   */
+  SQLPipelineBuilder& enable_adaptive_execution();
+
   SQLPipeline create_pipeline() const;
 
  private:
@@ -58,6 +65,7 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  bool _adaptive_execution{false};
 };
 
 }  // namespace opossum
@@ -1,8 +1,11 @@
 #include "sql_pipeline_statement.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <boost/algorithm/string.hpp>
 
@@ -11,6 +14,7 @@
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "operators/abstract_join_operator.hpp"
 #include "operators/export.hpp"
 #include "operators/import.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -18,24 +22,65 @@
 #include "operators/maintenance/create_view.hpp"
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/maintenance/drop_view.hpp"
+#include "operators/pqp_utils.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/job_task.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/cardinality_feedback_cache.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Collects the inputs of join operators that were not executed yet and whose subplans do not contain other such inputs
+ * into @param join_inputs. Returns whether the subplan of @param op contains an input of a join that was not executed.
+ */
+bool collect_lowest_join_inputs(const std::shared_ptr<AbstractOperator>& op,
+                                std::vector<std::shared_ptr<AbstractOperator>>& join_inputs,
+                                std::unordered_map<std::shared_ptr<AbstractOperator>, bool>& visited_operators) {
+  if (op->performance_data->executed) return false;
+
+  const auto visited_operator_iter = visited_operators.find(op);
+  if (visited_operator_iter != visited_operators.end()) return visited_operator_iter->second;
+
+  const auto is_join = static_cast<bool>(std::dynamic_pointer_cast<AbstractJoinOperator>(op));
+
+  auto contains_join_input = false;
+  for (const auto& input : {op->mutable_left_input(), op->mutable_right_input()}) {
+    if (!input) continue;
+
+    const auto input_contains_join_input = collect_lowest_join_inputs(input, join_inputs, visited_operators);
+    if (is_join && !input_contains_join_input && !input->performance_data->executed &&
+        std::find(join_inputs.begin(), join_inputs.end(), input) == join_inputs.end()) {
+      join_inputs.emplace_back(input);
+    }
+    contains_join_input |= input_contains_join_input || (is_join && !input->performance_data->executed);
+  }
+
+  visited_operators.emplace(op, contains_join_input);
+  return contains_join_input;
+}
+
+}  // namespace
+
 namespace opossum {
 
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                                            const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                                           const bool adaptive_execution)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
+      _adaptive_execution(adaptive_execution),
       _optimizer(optimizer),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()) {
@@ -265,10 +310,15 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
     return {SQLPipelineStatus::Success, _result_table};
   }
 
-  const auto& tasks = get_tasks();
+  // Create the plan before measuring the execution time
+  if (!_is_transaction_statement()) get_physical_plan();
 
   const auto started = std::chrono::high_resolution_clock::now();
 
+  if (_use_adaptive_execution()) _execute_adaptively();
+
+  const auto& tasks = get_tasks();
+
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
                 reinterpret_cast<uintptr_t>(this));
 
@@ -292,6 +342,12 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->plan_execution_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
 
+  // Feed the actual cardinalities of the operators back to the CardinalityEstimator
+  const auto& cardinality_feedback_cache = Hyrise::get().cardinality_feedback_cache;
+  if (cardinality_feedback_cache && !_is_transaction_statement()) {
+    cardinality_feedback_cache->record(get_physical_plan());
+  }
+
   // Get output from the last task if the task was an actual operator and not a transaction statement
   if (!_is_transaction_statement()) {
     _result_table = static_cast<const OperatorTask&>(*tasks.back()).get_operator()->get_output();
@@ -362,6 +418,75 @@ void SQLPipelineStatement::_precheck_ddl_operators(const std::shared_ptr<Abstrac
   }
 }
 
+bool SQLPipelineStatement::_use_adaptive_execution() {
+  // Re-optimizing requires the observed cardinalities to be fed back to the CardinalityEstimator. Statements that
+  // modify data are not re-optimized, as their operators must not be executed partially. If the tasks were already
+  // requested, they might be executed by the caller. Plans from the PQP cache are copies without LQP nodes, so their
+  // cardinalities cannot be compared to the estimates (they were re-optimized before being cached, though).
+  return _adaptive_execution && Hyrise::get().cardinality_feedback_cache && _tasks.empty() &&
+         !_metrics->query_plan_cache_hit &&
+         get_parsed_sql_statement()->getStatements().front()->isType(hsql::kStmtSelect);
+}
+
+void SQLPipelineStatement::_execute_adaptively() {
+  const auto estimator = CardinalityEstimator{};
+
+  while (_metrics->reoptimization_count < MAX_REOPTIMIZATION_COUNT) {
+    auto join_inputs = std::vector<std::shared_ptr<AbstractOperator>>{};
+    auto visited_operators = std::unordered_map<std::shared_ptr<AbstractOperator>, bool>{};
+    collect_lowest_join_inputs(_physical_plan, join_inputs, visited_operators);
+    if (join_inputs.empty()) return;
+
+    // The subplans of the join inputs may overlap. Scheduling them together ensures that shared operators are executed
+    // only once and that their outputs are only cleared once all of their consumers are done.
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operators(join_inputs));
+
+    if (_transaction_context && _transaction_context->aborted()) return;
+
+    const auto is_misestimated = [&](const auto& join_input) {
+      if (!join_input->lqp_node || !join_input->get_output()) return false;
+
+      const auto actual_cardinality = static_cast<Cardinality>(join_input->get_output()->row_count());
+      const auto estimated_cardinality = estimator.estimate_cardinality(join_input->lqp_node);
+      const auto larger_cardinality = std::max(actual_cardinality, estimated_cardinality);
+      const auto smaller_cardinality = std::max(std::min(actual_cardinality, estimated_cardinality), 1.0f);
+      return larger_cardinality / smaller_cardinality > ADAPTIVE_REOPTIMIZATION_THRESHOLD;
+    };
+    if (std::none_of(join_inputs.begin(), join_inputs.end(), is_misestimated)) continue;
+
+    Hyrise::get().cardinality_feedback_cache->record(_physical_plan);
+    _reoptimize();
+    ++_metrics->reoptimization_count;
+  }
+}
+
+void SQLPipelineStatement::_reoptimize() {
+  // Optimize the statement from scratch, so that all optimizer rules can take the observed cardinalities into account
+  _unoptimized_logical_plan = nullptr;
+  auto unoptimized_lqp = get_unoptimized_logical_plan();
+  _unoptimized_logical_plan = nullptr;
+  _optimized_logical_plan = _optimizer->optimize(std::move(unoptimized_lqp));
+
+  // Reuse the executed operators. The translator compares LQP nodes by value, so that subplans of the new LQP that are
+  // equal to executed ones are not executed again. As the PQP is visited top-down, the largest subplans are found.
+  // Operators whose output was already cleared by their consumers (see OperatorTask) cannot be reused.
+  auto lqp_translator = LQPTranslator{};
+  visit_pqp(_physical_plan, [&](const auto& op) {
+    if (op->lqp_node && op->performance_data->executed && op->get_output()) {
+      lqp_translator.register_operator(op);
+    }
+    return PQPVisitation::VisitInputs;
+  });
+  _physical_plan = lqp_translator.translate_node(_optimized_logical_plan);
+
+  if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
+
+  // Later executions of the statement start with the re-optimized plan
+  if (pqp_cache && _translation_info.cacheable) {
+    pqp_cache->set(_sql_string, _physical_plan);
+  }
+}
+
 bool SQLPipelineStatement::_is_transaction_statement() {
   return get_parsed_sql_statement()->getStatements().front()->isType(hsql::kStmtTransaction);
 }
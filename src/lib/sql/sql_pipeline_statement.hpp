@@ -26,6 +26,9 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds plan_execution_duration{};
 
   bool query_plan_cache_hit = false;
+
+  // Number of times the plan was re-optimized during its execution
+  size_t reoptimization_count = 0;
 };
 
 enum class SQLPipelineStatus {
@@ -53,11 +56,22 @@ enum class SQLPipelineStatus {
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
+  /**
+   * Adaptive execution: SELECT statements are executed in stages, each ending with the inputs of joins. If the output
+   * of such an input is more than ADAPTIVE_REOPTIMIZATION_THRESHOLD times smaller or larger than estimated, its
+   * cardinality (and those of the other executed operators) is stored in the CardinalityFeedbackCache, the statement is
+   * optimized again, and execution continues with the new plan. Operators that were already executed are reused for
+   * equal subplans of the new plan. Adaptive execution is opt-in (see SQLPipelineBuilder::enable_adaptive_execution)
+   * and requires the CardinalityFeedbackCache.
+   */
+  static constexpr auto ADAPTIVE_REOPTIMIZATION_THRESHOLD = 100.0f;
+  static constexpr auto MAX_REOPTIMIZATION_COUNT = size_t{3};
+
   // Prefer using the SQLPipelineBuilder for constructing SQLPipelineStatements conveniently
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache, const bool adaptive_execution);
 
   // Set the transaction context if this SQLPipelineStatement should not auto-commit.
   void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
@@ -109,6 +123,12 @@ class SQLPipelineStatement : public Noncopyable {
   // Returns the tasks that execute transaction statements
   std::vector<std::shared_ptr<AbstractTask>> _get_transaction_tasks();
 
+  // Executes the plan in stages and re-optimizes it if an intermediate cardinality was misestimated (see above). The
+  // remaining operators are executed by get_result_table().
+  bool _use_adaptive_execution();
+  void _execute_adaptively();
+  void _reoptimize();
+
   // Performs a sanity check in order to prevent an execution of a predictably failing DDL operator (e.g., creating a
   // table that already exists).
   // Throws an InvalidInputException if an invalid PQP is detected.
@@ -116,6 +136,7 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
+  const bool _adaptive_execution;
 
   const std::shared_ptr<Optimizer> _optimizer;
 
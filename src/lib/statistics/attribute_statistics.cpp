@@ -4,9 +4,11 @@
 
 #include "resolve_type.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/bloom_filter.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
+#include "statistics/statistics_objects/zone_map.hpp"
 
 namespace opossum {
 
@@ -25,6 +27,10 @@ void AttributeStatistics<T>::set_statistics_object(const std::shared_ptr<Abstrac
     histogram = histogram_object;
   } else if (const auto min_max_object = std::dynamic_pointer_cast<MinMaxFilter<T>>(statistics_object)) {
     min_max_filter = min_max_object;
+  } else if (const auto bloom_object = std::dynamic_pointer_cast<BloomFilter<T>>(statistics_object)) {
+    bloom_filter = bloom_object;
+  } else if (const auto zone_map_object = std::dynamic_pointer_cast<ZoneMap<T>>(statistics_object)) {
+    zone_map = zone_map_object;
   } else if (const auto null_value_ratio_object =
                  std::dynamic_pointer_cast<NullValueRatioStatistics>(statistics_object)) {
     null_value_ratio = null_value_ratio_object;
@@ -57,6 +63,10 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::scaled(const Se
     statistics->set_statistics_object(min_max_filter->scaled(selectivity));
   }
 
+  if (bloom_filter) {
+    statistics->set_statistics_object(bloom_filter->scaled(selectivity));
+  }
+
   // NOLINTNEXTLINE clang-tidy is crazy and sees a "potentially unintended semicolon" here...
   if constexpr (std::is_arithmetic_v<T>) {
     if (range_filter) {
@@ -85,6 +95,10 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::sliced(
     statistics->set_statistics_object(min_max_filter->sliced(predicate_condition, variant_value, variant_value2));
   }
 
+  if (bloom_filter) {
+    statistics->set_statistics_object(bloom_filter->sliced(predicate_condition, variant_value, variant_value2));
+  }
+
   // NOLINTNEXTLINE clang-tidy is crazy and sees a "potentially unintended semicolon" here...
   if constexpr (std::is_arithmetic_v<T>) {
     if (range_filter) {
@@ -118,6 +132,14 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::pruned(
     Fail("Pruning not implemented for min/max filters");
   }
 
+  if (bloom_filter) {
+    Fail("Pruning not implemented for bloom filters");
+  }
+
+  if (zone_map) {
+    Fail("Pruning not implemented for zone maps");
+  }
+
   // NOLINTNEXTLINE clang-tidy is crazy and sees a "potentially unintended semicolon" here...
   if constexpr (std::is_arithmetic_v<T>) {
     if (range_filter) {
@@ -128,6 +150,32 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::pruned(
   return statistics;
 }
 
+template <typename T>
+bool AttributeStatistics<T>::does_not_contain(const PredicateCondition predicate_condition,
+                                              const AllTypeVariant& variant_value,
+                                              const std::optional<AllTypeVariant>& variant_value2) const {
+  if (min_max_filter && min_max_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
+    return true;
+  }
+
+  if (bloom_filter && bloom_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
+    return true;
+  }
+
+  // Range filters are only available for arithmetic (non-string) types.
+  if constexpr (std::is_arithmetic_v<T>) {
+    // RangeFilters contain all the information stored in a MinMaxFilter. There is no point in having both.
+    DebugAssert(!range_filter || !min_max_filter,
+                "Segment should not have a MinMaxFilter and a RangeFilter at the same time");
+
+    if (range_filter && range_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(AttributeStatistics);
 
 }  // namespace opossum
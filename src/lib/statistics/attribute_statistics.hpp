@@ -19,7 +19,9 @@ class MinMaxFilter;
 template <typename T>
 class RangeFilter;
 template <typename T>
-class CountingQuotientFilter;
+class BloomFilter;
+template <typename T>
+class ZoneMap;
 
 /**
  * For docs, see BaseAttributeStatistics
@@ -41,10 +43,20 @@ class AttributeStatistics : public BaseAttributeStatistics {
       const size_t num_values_pruned, const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
       const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
 
+  bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                        const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
   std::shared_ptr<AbstractHistogram<T>> histogram;
   std::shared_ptr<MinMaxFilter<T>> min_max_filter;
   std::shared_ptr<RangeFilter<T>> range_filter;
+  std::shared_ptr<BloomFilter<T>> bloom_filter;
+  std::shared_ptr<ZoneMap<T>> zone_map;
   std::shared_ptr<NullValueRatioStatistics> null_value_ratio;
+
+  // Set by generate_chunk_pruning_statistics if the bounds of the min_max_filter and the range_filter are the exact
+  // minimum and maximum of the segment. This allows AggregateFromMetadata to answer MIN and MAX without a scan.
+  // Statistics that are derived, e.g., by slicing, are not exact.
+  bool has_exact_bounds{false};
 };
 
 template <typename T>
@@ -65,6 +77,14 @@ std::ostream& operator<<(std::ostream& stream, const AttributeStatistics<T>& att
     stream << "Has RangeFilter" << std::endl;
   }
 
+  if (attribute_statistics.bloom_filter) {
+    stream << "Has BloomFilter" << std::endl;
+  }
+
+  if (attribute_statistics.zone_map) {
+    stream << "Has ZoneMap" << std::endl;
+  }
+
   if (attribute_statistics.null_value_ratio) {
     stream << "NullValueRatio: " << attribute_statistics.null_value_ratio->ratio << std::endl;
   }
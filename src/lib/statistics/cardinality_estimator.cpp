@@ -1,13 +1,21 @@
 #include "cardinality_estimator.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "attribute_statistics.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
@@ -30,6 +38,7 @@
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
+#include "statistics/column_group_statistics.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram_builder.hpp"
@@ -65,6 +74,264 @@ std::optional<float> estimate_null_value_ratio_of_column(const TableStatistics&
   return std::nullopt;
 }
 
+// Scales the statistics of all columns so that they describe @param row_count rows
+std::shared_ptr<TableStatistics> scale_table_statistics(const TableStatistics& table_statistics,
+                                                        const Cardinality row_count) {
+  const auto selectivity = table_statistics.row_count > 0.0f ? row_count / table_statistics.row_count : 1.0f;
+
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>{};
+  column_statistics.reserve(table_statistics.column_statistics.size());
+  for (const auto& input_column_statistics : table_statistics.column_statistics) {
+    column_statistics.emplace_back(input_column_statistics->scaled(selectivity));
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+}
+
+// Scales the statistics of the inputs of a join so that they describe @param row_count output rows
+std::shared_ptr<TableStatistics> scale_join_table_statistics(const TableStatistics& left_input_table_statistics,
+                                                             const TableStatistics& right_input_table_statistics,
+                                                             const Cardinality row_count) {
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>{};
+  column_statistics.reserve(left_input_table_statistics.column_statistics.size() +
+                            right_input_table_statistics.column_statistics.size());
+  for (const auto* input_table_statistics : {&left_input_table_statistics, &right_input_table_statistics}) {
+    const auto selectivity =
+        input_table_statistics->row_count > 0.0f ? row_count / input_table_statistics->row_count : 0.0f;
+    for (const auto& input_column_statistics : input_table_statistics->column_statistics) {
+      column_statistics.emplace_back(input_column_statistics->scaled(selectivity));
+    }
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+}
+
+// Returns whether the foreign key constraints of @param table contain one that consists of exactly the columns
+// @param column_ids and references the columns @param referenced_column_ids (in the same order) of
+// @param referenced_table_name. The referenced columns need to contain a key of the referenced table.
+bool is_foreign_key(const Table& table, const std::vector<ColumnID>& column_ids,
+                    const std::string& referenced_table_name, const std::vector<ColumnID>& referenced_column_ids) {
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  if (!storage_manager.has_table(referenced_table_name)) return false;
+
+  const auto matches = [&](const ForeignKeyConstraint& foreign_key_constraint) {
+    if (foreign_key_constraint.referenced_table_name() != referenced_table_name ||
+        foreign_key_constraint.ordered_columns().size() != column_ids.size()) {
+      return false;
+    }
+
+    for (auto column_idx = size_t{0}; column_idx < column_ids.size(); ++column_idx) {
+      const auto& ordered_columns = foreign_key_constraint.ordered_columns();
+      const auto constraint_column_idx = static_cast<size_t>(
+          std::find(ordered_columns.begin(), ordered_columns.end(), column_ids[column_idx]) - ordered_columns.begin());
+      if (constraint_column_idx == ordered_columns.size() ||
+          foreign_key_constraint.referenced_columns()[constraint_column_idx] != referenced_column_ids[column_idx]) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  const auto& foreign_key_constraints = table.soft_foreign_key_constraints();
+  if (std::none_of(foreign_key_constraints.begin(), foreign_key_constraints.end(), matches)) return false;
+
+  const auto referenced_table = storage_manager.get_table(referenced_table_name);
+  const auto& key_constraints = referenced_table->soft_key_constraints();
+  return std::any_of(key_constraints.begin(), key_constraints.end(), [&](const auto& key_constraint) {
+    return std::all_of(key_constraint.columns().begin(), key_constraint.columns().end(), [&](const auto column_id) {
+      return std::find(referenced_column_ids.begin(), referenced_column_ids.end(), column_id) !=
+             referenced_column_ids.end();
+    });
+  });
+}
+
+/**
+ * If the predicates of an inner @param join_node equate the columns of a foreign key with the key they reference (both
+ * taken from stored tables), every row on the foreign key side that has no NULL in these columns finds exactly one
+ * join partner in the referenced table. Predicates on the referenced table remove join partners with the same
+ * selectivity. Thus, the join yields the non-NULL rows on the foreign key side, scaled by the share of the referenced
+ * table's rows that are left on the other side. Histograms cannot express this, as they lose track of which keys were
+ * filtered out. Returns nullopt if the join is not such a foreign key join.
+ */
+std::optional<Cardinality> estimate_foreign_key_join_cardinality(const JoinNode& join_node,
+                                                                 const TableStatistics& left_input_table_statistics,
+                                                                 const TableStatistics& right_input_table_statistics) {
+  if (join_node.join_mode != JoinMode::Inner) return std::nullopt;
+
+  // Collect the equated columns. All predicates have to equate a column of a stored table on the left with one of a
+  // stored table on the right.
+  auto left_column_expressions = std::vector<std::shared_ptr<LQPColumnExpression>>{};
+  auto right_column_expressions = std::vector<std::shared_ptr<LQPColumnExpression>>{};
+  for (const auto& join_predicate : join_node.join_predicates()) {
+    const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_predicate);
+    if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) return std::nullopt;
+
+    auto left_column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->left_operand());
+    auto right_column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->right_operand());
+    if (!left_column_expression || !right_column_expression) return std::nullopt;
+
+    if (!join_node.left_input()->find_column_id(*left_column_expression)) {
+      std::swap(left_column_expression, right_column_expression);
+    }
+    if (!join_node.left_input()->find_column_id(*left_column_expression) ||
+        !join_node.right_input()->find_column_id(*right_column_expression)) {
+      return std::nullopt;
+    }
+
+    left_column_expressions.emplace_back(left_column_expression);
+    right_column_expressions.emplace_back(right_column_expression);
+  }
+
+  // Returns the StoredTableNode all columns originate from and their ColumnIDs in the stored table
+  const auto original_columns = [](const std::vector<std::shared_ptr<LQPColumnExpression>>& column_expressions) {
+    const auto stored_table_node =
+        std::dynamic_pointer_cast<const StoredTableNode>(column_expressions.front()->original_node.lock());
+    auto column_ids = std::vector<ColumnID>{};
+    for (const auto& column_expression : column_expressions) {
+      if (!stored_table_node || column_expression->original_node.lock() != stored_table_node) {
+        return std::make_pair(std::shared_ptr<const StoredTableNode>{}, std::vector<ColumnID>{});
+      }
+      column_ids.emplace_back(column_expression->original_column_id);
+    }
+    return std::make_pair(stored_table_node, column_ids);
+  };
+
+  const auto [left_stored_table_node, left_column_ids] = original_columns(left_column_expressions);
+  const auto [right_stored_table_node, right_column_ids] = original_columns(right_column_expressions);
+  if (!left_stored_table_node || !right_stored_table_node) return std::nullopt;
+
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  if (!storage_manager.has_table(left_stored_table_node->table_name) ||
+      !storage_manager.has_table(right_stored_table_node->table_name)) {
+    return std::nullopt;
+  }
+  const auto left_table = storage_manager.get_table(left_stored_table_node->table_name);
+  const auto right_table = storage_manager.get_table(right_stored_table_node->table_name);
+
+  const auto left_is_foreign_key =
+      is_foreign_key(*left_table, left_column_ids, right_stored_table_node->table_name, right_column_ids);
+  if (!left_is_foreign_key &&
+      !is_foreign_key(*right_table, right_column_ids, left_stored_table_node->table_name, left_column_ids)) {
+    return std::nullopt;
+  }
+
+  const auto& foreign_key_input_node = left_is_foreign_key ? *join_node.left_input() : *join_node.right_input();
+  const auto& foreign_key_table_statistics =
+      left_is_foreign_key ? left_input_table_statistics : right_input_table_statistics;
+  const auto& foreign_key_column_expressions = left_is_foreign_key ? left_column_expressions : right_column_expressions;
+  const auto& referenced_table = left_is_foreign_key ? *right_table : *left_table;
+  const auto& referenced_table_statistics =
+      left_is_foreign_key ? right_input_table_statistics : left_input_table_statistics;
+
+  // Each row of the foreign key side finds at most one join partner only if the referenced keys are still unique in the
+  // referenced input. Joins below the referenced side (e.g., with another table referencing it) may duplicate them.
+  const auto& referenced_input_node = left_is_foreign_key ? *join_node.right_input() : *join_node.left_input();
+  const auto& referenced_column_expressions = left_is_foreign_key ? right_column_expressions : left_column_expressions;
+  if (!referenced_input_node.has_matching_unique_constraint(
+          ExpressionUnorderedSet{referenced_column_expressions.cbegin(), referenced_column_expressions.cend()})) {
+    return std::nullopt;
+  }
+
+  const auto referenced_table_row_count = referenced_table.table_statistics()
+                                              ? referenced_table.table_statistics()->row_count
+                                              : static_cast<Cardinality>(referenced_table.row_count());
+  if (referenced_table_row_count == 0.0f) return std::nullopt;
+
+  // Rows with NULL in any of the foreign key columns do not find a join partner. The columns are assumed to be
+  // independent.
+  auto non_null_ratio = 1.0f;
+  for (const auto& column_expression : foreign_key_column_expressions) {
+    const auto column_id = foreign_key_input_node.get_column_id(*column_expression);
+    const auto& column_statistics = foreign_key_table_statistics.column_statistics[column_id];
+    resolve_data_type(column_statistics->data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto null_value_ratio = estimate_null_value_ratio_of_column(
+          foreign_key_table_statistics, static_cast<const AttributeStatistics<ColumnDataType>&>(*column_statistics));
+      if (null_value_ratio) non_null_ratio *= 1.0f - std::clamp(*null_value_ratio, 0.0f, 1.0f);
+    });
+  }
+
+  const auto referenced_table_selectivity =
+      std::min(1.0f, referenced_table_statistics.row_count / referenced_table_row_count);
+  return foreign_key_table_statistics.row_count * non_null_ratio * referenced_table_selectivity;
+}
+
+// If @param predicate has the form `<column> = <value>` and the column belongs to a StoredTableNode, returns the node,
+// the column's ID in the stored table, and the value
+std::optional<std::tuple<std::shared_ptr<const StoredTableNode>, ColumnID, AllTypeVariant>> stored_column_equals_value(
+    const AbstractExpression& predicate) {
+  const auto* binary_predicate = dynamic_cast<const BinaryPredicateExpression*>(&predicate);
+  if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) return std::nullopt;
+
+  auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->left_operand());
+  auto value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->right_operand());
+  if (!column_expression) {
+    column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->right_operand());
+    value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->left_operand());
+  }
+  if (!column_expression || !value_expression || variant_is_null(value_expression->value)) return std::nullopt;
+
+  const auto stored_table_node =
+      std::dynamic_pointer_cast<const StoredTableNode>(column_expression->original_node.lock());
+  if (!stored_table_node) return std::nullopt;
+
+  return std::make_tuple(stored_table_node, column_expression->original_column_id, value_expression->value);
+}
+
+/**
+ * Estimates the selectivity of a `<column> = <value>` predicate on a stored table if the predicates below it (up to
+ * the StoredTableNode) compare other columns of the same table to values. Multiplying the selectivities of these
+ * predicates would assume that the columns are independent. Instead, the selectivity is determined from the
+ * ColumnGroupStatistics of the compared columns as P(all predicates) / P(predicates below).
+ */
+std::optional<Selectivity> estimate_correlated_equals_selectivity(const PredicateNode& predicate_node) {
+  const auto predicate = stored_column_equals_value(*predicate_node.predicate());
+  if (!predicate) return std::nullopt;
+
+  const auto& stored_table_node = std::get<0>(*predicate);
+  const auto column_id = std::get<1>(*predicate);
+
+  // Collect the columns compared to values by the predicates below. Other PredicateNodes and ValidateNodes do not
+  // change the correlation between the columns and are skipped.
+  auto values_by_column_id = std::map<ColumnID, AllTypeVariant>{};
+  auto node = predicate_node.left_input();
+  while (node && (node->type == LQPNodeType::Predicate || node->type == LQPNodeType::Validate)) {
+    if (node->type == LQPNodeType::Predicate) {
+      const auto lower_predicate =
+          stored_column_equals_value(*static_cast<const PredicateNode&>(*node).predicate());
+      if (lower_predicate && std::get<0>(*lower_predicate) == stored_table_node) {
+        values_by_column_id.emplace(std::get<1>(*lower_predicate), std::get<2>(*lower_predicate));
+      }
+    }
+    node = node->left_input();
+  }
+
+  if (node != stored_table_node || values_by_column_id.empty() || values_by_column_id.count(column_id)) {
+    return std::nullopt;
+  }
+
+  const auto estimate_equals = [&](const std::map<ColumnID, AllTypeVariant>& column_values) {
+    auto column_ids = std::vector<ColumnID>{};
+    auto values = std::vector<AllTypeVariant>{};
+    for (const auto& [group_column_id, group_value] : column_values) {
+      column_ids.emplace_back(group_column_id);
+      values.emplace_back(group_value);
+    }
+
+    const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+    return table->column_group_statistics(column_ids)->estimate_equals(values);
+  };
+
+  const auto lower_selectivity = estimate_equals(values_by_column_id);
+  if (lower_selectivity == 0.0f) return std::nullopt;
+
+  // Both estimates might be extrapolated differently (e.g., if only the combination is a most common value), so that
+  // the ratio is not necessarily a valid selectivity
+  values_by_column_id.emplace(column_id, std::get<2>(*predicate));
+  return std::clamp(estimate_equals(values_by_column_id) / lower_selectivity, 0.0f, 1.0f);
+}
+
 }  // namespace
 
 namespace opossum {
@@ -82,6 +349,15 @@ Cardinality CardinalityEstimator::estimate_cardinality(const std::shared_ptr<con
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
     const std::shared_ptr<const AbstractLQPNode>& lqp) const {
+  /**
+   * 0. Look up the cardinality that was observed when the LQP was executed before. If there is one, it replaces the
+   * estimated row count in step 3. As the join_graph_statistics_cache is keyed by the predicates and vertices of the
+   * LQP, its entries might have been created for an LQP without feedback and are not used.
+   */
+  const auto& cardinality_feedback_cache = Hyrise::get().cardinality_feedback_cache;
+  const auto observed_cardinality =
+      cardinality_feedback_cache ? cardinality_feedback_cache->get(lqp) : std::optional<Cardinality>{};
+
   /**
    * 1. Try a cache lookup for requested LQP.
    *
@@ -92,7 +368,7 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
    * multiple LQPs) than `statistics_by_lqp`. Thus lookup in `join_graph_statistics_cache` is performed first.
    */
   auto join_graph_bitmask = std::optional<JoinGraphStatisticsCache::Bitmask>{};
-  if (cardinality_estimation_cache.join_graph_statistics_cache) {
+  if (cardinality_estimation_cache.join_graph_statistics_cache && !observed_cardinality) {
     join_graph_bitmask = cardinality_estimation_cache.join_graph_statistics_cache->bitmask(lqp);
     if (join_graph_bitmask) {
       auto cached_statistics =
@@ -227,7 +503,14 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
   }
 
   /**
-   * 3. Store output_table_statistics in cache
+   * 3. Scale the estimated statistics to the observed cardinality
+   */
+  if (observed_cardinality && output_table_statistics->row_count != *observed_cardinality) {
+    output_table_statistics = scale_table_statistics(*output_table_statistics, *observed_cardinality);
+  }
+
+  /**
+   * 4. Store output_table_statistics in cache
    */
   if (join_graph_bitmask) {
     cardinality_estimation_cache.join_graph_statistics_cache->set(*join_graph_bitmask, lqp->output_expressions(),
@@ -414,6 +697,14 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_predicate_node(
       output_table_statistics = estimate_operator_scan_predicate(output_table_statistics, operator_scan_predicate);
     }
 
+    // The statistics of the scanned column were already scaled by the predicates below. If these compare correlated
+    // columns to values, the estimated row count is corrected with the statistics of the column group.
+    const auto correlated_selectivity = estimate_correlated_equals_selectivity(predicate_node);
+    if (correlated_selectivity) {
+      return scale_table_statistics(*output_table_statistics,
+                                    input_table_statistics->row_count * *correlated_selectivity);
+    }
+
     return output_table_statistics;
   }
 }
@@ -441,10 +732,18 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_join_node(
         case JoinMode::FullOuter:
         case JoinMode::Inner:
           switch (primary_operator_join_predicate->predicate_condition) {
-            case PredicateCondition::Equals:
+            case PredicateCondition::Equals: {
+              const auto foreign_key_join_cardinality = estimate_foreign_key_join_cardinality(
+                  join_node, *left_input_table_statistics, *right_input_table_statistics);
+              if (foreign_key_join_cardinality) {
+                return scale_join_table_statistics(*left_input_table_statistics, *right_input_table_statistics,
+                                                   *foreign_key_join_cardinality);
+              }
+
               return estimate_inner_equi_join(primary_operator_join_predicate->column_ids.first,
                                               primary_operator_join_predicate->column_ids.second,
                                               *left_input_table_statistics, *right_input_table_statistics);
+            }
 
             // TODO(anybody) Implement estimation for non-equi joins. #1830
             case PredicateCondition::NotEquals:
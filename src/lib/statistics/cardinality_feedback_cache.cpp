@@ -0,0 +1,119 @@
+#include "cardinality_feedback_cache.hpp"
+
+#include <unordered_set>
+
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/pqp_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+CardinalityFeedbackCache::CardinalityFeedbackCache(const size_t capacity) : _observations(capacity) {}
+
+void CardinalityFeedbackCache::record(const std::shared_ptr<const AbstractOperator>& pqp) {
+  // Some LQP nodes are translated into multiple operators (e.g., an IndexScan, a TableScan, and a UnionAll for a
+  // PredicateNode). Only the topmost of these operators outputs the node's result. As the PQP is visited from the top,
+  // the first operator visited for a node is used.
+  auto recorded_nodes = std::unordered_set<std::shared_ptr<const AbstractLQPNode>>{};
+
+  visit_pqp(pqp, [&](const auto& op) {
+    const auto& performance_data = *op->performance_data;
+    if (op->lqp_node && performance_data.executed && performance_data.has_output &&
+        recorded_nodes.emplace(op->lqp_node).second) {
+      store(op->lqp_node, static_cast<Cardinality>(performance_data.output_row_count));
+    }
+    return PQPVisitation::VisitInputs;
+  });
+}
+
+void CardinalityFeedbackCache::store(const std::shared_ptr<const AbstractLQPNode>& lqp, const Cardinality cardinality) {
+  if (!is_cacheable(lqp)) return;
+
+  _observations.set(lqp->hash(), Observation{lqp, cardinality, _table_sizes(lqp)});
+}
+
+std::optional<Cardinality> CardinalityFeedbackCache::get(const std::shared_ptr<const AbstractLQPNode>& lqp) {
+  // Hashing the subplan is not free. Avoid it in the common case of an empty cache.
+  if (_observations.size() == 0) return std::nullopt;
+
+  // Subplans that are not cacheable are never stored. Thus, they cannot be equal to a stored one and need not be
+  // checked here.
+  const auto observation = _observations.try_get(lqp->hash());
+  if (!observation || _is_stale(*observation)) return std::nullopt;
+  if (observation->lqp != lqp && *observation->lqp != *lqp) return std::nullopt;
+
+  return observation->cardinality;
+}
+
+size_t CardinalityFeedbackCache::size() const { return _observations.size(); }
+
+void CardinalityFeedbackCache::clear() { _observations.clear(); }
+
+bool CardinalityFeedbackCache::is_cacheable(const std::shared_ptr<const AbstractLQPNode>& lqp) {
+  auto cacheable = true;
+
+  visit_lqp(lqp, [&](const auto& node) {
+    // The content of MockNodes and StaticTableNodes is not part of their hash
+    if (node->type == LQPNodeType::Mock || node->type == LQPNodeType::StaticTable) {
+      cacheable = false;
+    }
+
+    // The cardinality of subplans with parameters depends on the parameter values. The result of subqueries is not
+    // tracked by the staleness check.
+    for (const auto& node_expression : node->node_expressions) {
+      visit_expression(node_expression, [&](const auto& expression) {
+        if (expression->type == ExpressionType::CorrelatedParameter ||
+            expression->type == ExpressionType::Placeholder || expression->type == ExpressionType::LQPSubquery) {
+          cacheable = false;
+        }
+        return cacheable ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+      });
+    }
+
+    return cacheable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+
+  return cacheable;
+}
+
+std::vector<CardinalityFeedbackCache::TableSize> CardinalityFeedbackCache::_table_sizes(
+    const std::shared_ptr<const AbstractLQPNode>& lqp) {
+  auto table_sizes = std::vector<TableSize>{};
+
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) {
+      const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+      const auto table = Hyrise::get().storage_manager.get_table(table_name);
+      table_sizes.emplace_back(TableSize{table_name, table, table->row_count(), table->inserted_row_count(),
+                                         table->invalidated_row_count()});
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  return table_sizes;
+}
+
+bool CardinalityFeedbackCache::_is_stale(const Observation& observation) {
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  for (const auto& table_size : observation.table_sizes) {
+    // The counters of a table that was replaced cannot be compared
+    if (!storage_manager.has_table(table_size.table_name)) return true;
+    const auto table = storage_manager.get_table(table_size.table_name);
+    if (table != table_size.table.lock()) return true;
+
+    const auto changed_row_count = (table->inserted_row_count() - table_size.inserted_row_count) +
+                                   (table->invalidated_row_count() - table_size.invalidated_row_count);
+    if (static_cast<double>(changed_row_count) > STALENESS_THRESHOLD * static_cast<double>(table_size.row_count)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "cache/gdfs_cache.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractOperator;
+class Table;
+
+/**
+ * Cardinalities observed during the execution of query plans. After a PQP was executed, record() stores the
+ * output_row_count of each operator (see AbstractOperatorPerformanceData) for the LQP node the operator was translated
+ * from. The CardinalityEstimator consults the cache before estimating a node, so that the estimation errors of a query
+ * are corrected when the same subplans are optimized again (e.g., for the next execution of a query that is not in the
+ * plan cache, or for other queries sharing the subplan).
+ *
+ * Subplans are compared by value (see AbstractLQPNode::hash() and AbstractLQPNode::operator==()), so that equal
+ * subplans of different LQPs share an entry. As the cached subplans are compared to the ones being estimated, they must
+ * not be modified after they were stored, which holds for the LQPs of executed PQPs. Only subplans that read from
+ * stored tables exclusively and do not contain subqueries or parameters are cached, as the cardinality of other
+ * subplans cannot be reproduced.
+ *
+ * Along with the cardinality, the size of each table read by the subplan is stored. Once a table changed by more than
+ * STALENESS_THRESHOLD (inserted and deleted rows relative to the table's row count at the time of the observation, see
+ * Table::inserted_row_count()), the observation is considered stale and no longer returned. It is replaced by the next
+ * observation. All methods are thread-safe.
+ *
+ * The cache is opt-in: it is only used if it is set in Hyrise::cardinality_feedback_cache.
+ */
+class CardinalityFeedbackCache : private Noncopyable {
+ public:
+  static constexpr auto STALENESS_THRESHOLD = 0.1;
+
+  explicit CardinalityFeedbackCache(const size_t capacity = DEFAULT_CACHE_CAPACITY);
+
+  // Stores the output cardinalities of all executed operators of the PQP
+  void record(const std::shared_ptr<const AbstractOperator>& pqp);
+
+  void store(const std::shared_ptr<const AbstractLQPNode>& lqp, const Cardinality cardinality);
+
+  // Returns the observed cardinality of the subplan, if there is one that is not stale
+  std::optional<Cardinality> get(const std::shared_ptr<const AbstractLQPNode>& lqp);
+
+  size_t size() const;
+  void clear();
+
+  // Returns false for subplans whose cardinality cannot be reproduced
+  static bool is_cacheable(const std::shared_ptr<const AbstractLQPNode>& lqp);
+
+ protected:
+  struct TableSize {
+    std::string table_name;
+    std::weak_ptr<const Table> table;
+    uint64_t row_count;
+    uint64_t inserted_row_count;
+    uint64_t invalidated_row_count;
+  };
+
+  struct Observation {
+    // Entries are keyed by the hash of the subplan. Hash collisions are resolved by comparing the subplans.
+    std::shared_ptr<const AbstractLQPNode> lqp;
+    Cardinality cardinality;
+    std::vector<TableSize> table_sizes;
+  };
+
+  static std::vector<TableSize> _table_sizes(const std::shared_ptr<const AbstractLQPNode>& lqp);
+  static bool _is_stale(const Observation& observation);
+
+  GDFSCache<size_t, Observation> _observations;
+};
+
+}  // namespace opossum
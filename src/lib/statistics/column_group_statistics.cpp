@@ -0,0 +1,169 @@
+#include "column_group_statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+
+#include "boost/functional/hash.hpp"
+
+#include "lossless_cast.hpp"
+#include "resolve_type.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using Combination = std::vector<AllTypeVariant>;
+
+struct CombinationHash {
+  size_t operator()(const Combination& combination) const {
+    auto hash = size_t{0};
+    for (const auto& value : combination) {
+      boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+    }
+    return hash;
+  }
+};
+
+// NULLs are never equal to anything (see null_value.hpp). Combinations containing NULLs are still grouped, so that the
+// number of distinct combinations is not overestimated.
+struct CombinationEqual {
+  bool operator()(const Combination& lhs, const Combination& rhs) const {
+    for (auto value_idx = size_t{0}; value_idx < lhs.size(); ++value_idx) {
+      const auto lhs_is_null = variant_is_null(lhs[value_idx]);
+      if (lhs_is_null != variant_is_null(rhs[value_idx])) return false;
+      if (!lhs_is_null && lhs[value_idx] != rhs[value_idx]) return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<ColumnGroupStatistics> ColumnGroupStatistics::from_table(const Table& table,
+                                                                         const std::vector<ColumnID>& column_ids,
+                                                                         const size_t most_common_value_count,
+                                                                         const size_t sample_row_count) {
+  Assert(!column_ids.empty(), "Expected at least one column");
+  Assert(sample_row_count > 0, "Expected a non-empty sample");
+
+  // The statistics are requested while a query is optimized. Thus, like TableStatistics, they are built from a block
+  // sample of large tables so that building them takes a bounded amount of time.
+  auto combination_counts = std::unordered_map<Combination, size_t, CombinationHash, CombinationEqual>{};
+  auto sampled_row_count = size_t{0};
+
+  auto chunk_combinations = std::vector<Combination>{};
+  for (const auto chunk_id : TableStatistics::sample_chunk_ids(table, sample_row_count)) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    // Rows appended to a mutable chunk while it is processed are ignored
+    const auto chunk_size = chunk->size();
+    chunk_combinations.assign(chunk_size, Combination{});
+
+    for (const auto column_id : column_ids) {
+      resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          if (position.chunk_offset() >= chunk_size) return;
+
+          chunk_combinations[position.chunk_offset()].emplace_back(
+              position.is_null() ? NULL_VALUE : AllTypeVariant{position.value()});
+        });
+      });
+    }
+
+    for (auto& combination : chunk_combinations) {
+      ++combination_counts[std::move(combination)];
+    }
+    sampled_row_count += chunk_size;
+  }
+
+  const auto row_count = std::max(table.row_count(), sampled_row_count);
+  const auto scale = sampled_row_count == 0 ? 1.0f
+                                            : static_cast<Cardinality>(row_count) /
+                                                  static_cast<Cardinality>(sampled_row_count);
+
+  // Extrapolate the number of distinct combinations with the Guaranteed-Error Estimator, as done for the histograms of
+  // TableStatistics: combinations that occur once in the sample stand for sqrt(scale) combinations.
+  auto singleton_count = size_t{0};
+  auto combinations = std::vector<std::pair<Combination, size_t>>{};
+  combinations.reserve(combination_counts.size());
+  for (const auto& [combination, count] : combination_counts) {
+    if (count == 1) ++singleton_count;
+    combinations.emplace_back(combination, count);
+  }
+  const auto distinct_count = std::min(
+      static_cast<Cardinality>(row_count),
+      std::sqrt(scale) * static_cast<Cardinality>(singleton_count) +
+          static_cast<Cardinality>(combinations.size() - singleton_count));
+
+  const auto most_common_combination_count = std::min(most_common_value_count, combinations.size());
+  std::partial_sort(combinations.begin(), combinations.begin() + most_common_combination_count, combinations.end(),
+                    [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+
+  auto most_common_values = std::vector<std::pair<std::vector<AllTypeVariant>, Cardinality>>{};
+  most_common_values.reserve(most_common_combination_count);
+  for (auto combination_idx = size_t{0}; combination_idx < most_common_combination_count; ++combination_idx) {
+    auto& [combination, count] = combinations[combination_idx];
+    most_common_values.emplace_back(std::move(combination), static_cast<Cardinality>(count) * scale);
+  }
+
+  auto data_types = std::vector<DataType>{};
+  data_types.reserve(column_ids.size());
+  for (const auto column_id : column_ids) {
+    data_types.emplace_back(table.column_data_type(column_id));
+  }
+
+  return std::make_shared<ColumnGroupStatistics>(column_ids, data_types, static_cast<Cardinality>(row_count),
+                                                 distinct_count, std::move(most_common_values));
+}
+
+ColumnGroupStatistics::ColumnGroupStatistics(
+    const std::vector<ColumnID>& init_column_ids, const std::vector<DataType>& init_data_types,
+    const Cardinality init_row_count, const Cardinality init_distinct_count,
+    std::vector<std::pair<std::vector<AllTypeVariant>, Cardinality>>&& init_most_common_values)
+    : column_ids(init_column_ids),
+      data_types(init_data_types),
+      row_count(init_row_count),
+      distinct_count(init_distinct_count),
+      most_common_values(std::move(init_most_common_values)) {
+  Assert(column_ids.size() == data_types.size(), "Expected one DataType per column");
+}
+
+Selectivity ColumnGroupStatistics::estimate_equals(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() == column_ids.size(), "Expected one value per column");
+  if (row_count == 0.0f) return 0.0f;
+
+  // Cast the values to the types of the columns so that they can be compared to the most common values. Values that
+  // cannot be represented by the column's type (and NULLs) do not match any row.
+  auto column_values = std::vector<AllTypeVariant>{};
+  column_values.reserve(values.size());
+  for (auto column_idx = size_t{0}; column_idx < values.size(); ++column_idx) {
+    const auto column_value = lossless_variant_cast(values[column_idx], data_types[column_idx]);
+    if (!column_value) return 0.0f;
+    column_values.emplace_back(*column_value);
+  }
+
+  auto most_common_value_count = Cardinality{0};
+  for (const auto& [most_common_value, count] : most_common_values) {
+    if (most_common_value == column_values) return count / row_count;
+    most_common_value_count += count;
+  }
+
+  // Assume that the remaining rows are uniformly distributed over the remaining combinations
+  const auto remaining_distinct_count = distinct_count - static_cast<Cardinality>(most_common_values.size());
+  if (remaining_distinct_count < 1.0f) return 0.0f;
+
+  return (row_count - most_common_value_count) / remaining_distinct_count / row_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Statistics on the combinations of values in a group of columns. The per-column statistics of TableStatistics cannot
+ * express correlations between columns, so the CardinalityEstimator has to assume independence for conjunctions of
+ * predicates. For correlated columns (e.g., `city = 'Berlin' AND country = 'DE'`), this underestimates the result by
+ * orders of magnitude. Thus, the estimator requests ColumnGroupStatistics for the columns of stored tables that are
+ * compared to values in consecutive predicates (see Table::column_group_statistics).
+ *
+ * The statistics consist of the number of distinct value combinations and the most common combinations with their
+ * number of occurrences. Other combinations are assumed to be uniformly distributed. Combinations containing NULL are
+ * counted, but never match an equality predicate. As they are built while a query is optimized, the statistics of
+ * tables with more than sample_row_count rows are extrapolated from a block sample (see
+ * TableStatistics::sample_chunk_ids).
+ */
+class ColumnGroupStatistics {
+ public:
+  static constexpr auto DEFAULT_MOST_COMMON_VALUE_COUNT = size_t{100};
+  static constexpr auto DEFAULT_SAMPLE_ROW_COUNT = size_t{100'000};
+
+  static std::shared_ptr<ColumnGroupStatistics> from_table(
+      const Table& table, const std::vector<ColumnID>& column_ids,
+      const size_t most_common_value_count = DEFAULT_MOST_COMMON_VALUE_COUNT,
+      const size_t sample_row_count = DEFAULT_SAMPLE_ROW_COUNT);
+
+  ColumnGroupStatistics(const std::vector<ColumnID>& init_column_ids, const std::vector<DataType>& init_data_types,
+                        const Cardinality init_row_count, const Cardinality init_distinct_count,
+                        std::vector<std::pair<std::vector<AllTypeVariant>, Cardinality>>&& init_most_common_values);
+
+  // Estimates the share of rows in which the columns are equal to the given values (in the order of column_ids)
+  Selectivity estimate_equals(const std::vector<AllTypeVariant>& values) const;
+
+  const std::vector<ColumnID> column_ids;
+  const std::vector<DataType> data_types;
+  const Cardinality row_count;
+  const Cardinality distinct_count;
+
+  // Most common value combinations and their number of occurrences, ordered by descending number of occurrences
+  const std::vector<std::pair<std::vector<AllTypeVariant>, Cardinality>> most_common_values;
+};
+
+}  // namespace opossum
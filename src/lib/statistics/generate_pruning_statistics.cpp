@@ -1,5 +1,6 @@
 #include "generate_pruning_statistics.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
 #include <thread>
@@ -8,22 +9,29 @@
 #include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/bloom_filter.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram_builder.hpp"
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
+#include "statistics/statistics_objects/zone_map.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/table.hpp"
 
 namespace {
 
 using namespace opossum;  // NOLINT
 
+// BloomFilters are only worth their memory (two bytes per distinct value) for high-cardinality segments, where the
+// value ranges of the other filters are too coarse to prune equality predicates
+constexpr auto BLOOM_FILTER_MIN_DISTINCT_RATIO = 0.1;
+
 template <typename T>
-void create_pruning_statistics_for_segment(AttributeStatistics<T>& segment_statistics,
-                                           const pmr_vector<T>& dictionary) {
+void create_pruning_statistics_for_segment(AttributeStatistics<T>& segment_statistics, const pmr_vector<T>& dictionary,
+                                           const ChunkOffset row_count) {
   std::shared_ptr<AbstractStatisticsObject> pruning_statistics;
   if constexpr (std::is_arithmetic_v<T>) {
     pruning_statistics = RangeFilter<T>::build_filter(dictionary);
@@ -36,6 +44,56 @@ void create_pruning_statistics_for_segment(AttributeStatistics<T>& segment_stati
   if (pruning_statistics) {
     segment_statistics.set_statistics_object(pruning_statistics);
   }
+
+  if (dictionary.size() > DEFAULT_MAX_RANGES_COUNT &&
+      static_cast<double>(dictionary.size()) >= BLOOM_FILTER_MIN_DISTINCT_RATIO * row_count) {
+    segment_statistics.set_statistics_object(BloomFilter<T>::build_filter(dictionary));
+  }
+}
+
+// ZoneMaps only pay off if a segment has multiple blocks. Otherwise, the segment-wide filters hold the same
+// information.
+template <typename T, typename Iterable>
+std::shared_ptr<ZoneMap<T>> create_zone_map(const Iterable& iterable, const ChunkOffset row_count) {
+  const auto block_size = DEFAULT_ZONE_MAP_BLOCK_SIZE;
+  if (row_count <= block_size) return nullptr;
+
+  auto blocks = std::vector<typename ZoneMap<T>::Block>((row_count + block_size - 1) / block_size);
+  iterable.for_each([&](const auto& position) {
+    auto& block = blocks[position.chunk_offset() / block_size];
+    ++block.row_count;
+
+    if (position.is_null()) {
+      ++block.null_count;
+      return;
+    }
+
+    const auto& value = position.value();
+    if (block.row_count - 1 == block.null_count) {
+      // First non-NULL value of the block
+      block.min = value;
+      block.max = value;
+    } else if (value < block.min) {
+      block.min = value;
+    } else if (block.max < value) {
+      block.max = value;
+    }
+  });
+
+  return std::make_shared<ZoneMap<T>>(block_size, std::move(blocks));
+}
+
+// Besides its use for cardinality estimations, the NullValueRatioStatistics allow answering COUNT(column) from the
+// chunk metadata (see AggregateFromMetadata)
+template <typename Iterable>
+std::shared_ptr<NullValueRatioStatistics> create_null_value_ratio(const Iterable& iterable,
+                                                                  const ChunkOffset row_count) {
+  if (row_count == 0) return nullptr;
+
+  auto null_count = ChunkOffset{0};
+  iterable.for_each([&](const auto& position) { null_count += position.is_null(); });
+
+  return std::make_shared<NullValueRatioStatistics>(static_cast<float>(null_count) / static_cast<float>(row_count));
 }
 
 }  // namespace
@@ -45,7 +103,8 @@ namespace opossum {
 void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk) {
   if (chunk->pruning_statistics()) {
     // Pruning statistics should be stable no matter what encoding or sort order is used. Hence, when they are present
-    // they are up to date and we can skip the recreation.
+    // they are up to date and we can skip the recreation. ZoneMaps depend on the positions of the values, which are
+    // not changed by the encoding.
     return;
   }
 
@@ -63,7 +122,35 @@ void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk) {
       if constexpr (std::is_same_v<SegmentType, DictionarySegment<ColumnDataType>>) {
         // we can use the fact that dictionary segments have an accessor for the dictionary
         const auto& dictionary = *typed_segment.dictionary();
-        create_pruning_statistics_for_segment(*segment_statistics, dictionary);
+
+        // A shared dictionary (see ChunkEncoder::encode_column_with_shared_dictionary) also contains the values of
+        // other chunks. In this case, we build the filters from the range of ValueIDs that the segment uses, so that
+        // their bounds are those of the segment.
+        const auto null_value_id = static_cast<ValueID::base_type>(dictionary.size());
+        auto min_value_id = null_value_id;
+        auto max_value_id = ValueID::base_type{0};
+        create_iterable_from_attribute_vector(typed_segment).for_each([&](const auto& position) {
+          const auto value_id = static_cast<ValueID::base_type>(position.value());
+          if (value_id == null_value_id) return;
+          min_value_id = std::min(min_value_id, value_id);
+          max_value_id = std::max(max_value_id, value_id);
+        });
+
+        if (min_value_id == 0 && max_value_id + 1 == null_value_id) {
+          create_pruning_statistics_for_segment(*segment_statistics, dictionary, chunk->size());
+        } else {
+          const auto used_dictionary =
+              min_value_id == null_value_id
+                  ? pmr_vector<ColumnDataType>{}
+                  : pmr_vector<ColumnDataType>{dictionary.cbegin() + min_value_id,
+                                               dictionary.cbegin() + max_value_id + 1};
+          create_pruning_statistics_for_segment(*segment_statistics, used_dictionary, chunk->size());
+        }
+        segment_statistics->has_exact_bounds = true;
+
+        const auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
+        segment_statistics->set_statistics_object(create_zone_map<ColumnDataType>(iterable, chunk->size()));
+        segment_statistics->set_statistics_object(create_null_value_ratio(iterable, chunk->size()));
       } else {
         // if we have a generic segment we create the dictionary ourselves
         auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
@@ -76,7 +163,10 @@ void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk) {
         });
         pmr_vector<ColumnDataType> dictionary{values.cbegin(), values.cend()};
         std::sort(dictionary.begin(), dictionary.end());
-        create_pruning_statistics_for_segment(*segment_statistics, dictionary);
+        create_pruning_statistics_for_segment(*segment_statistics, dictionary, chunk->size());
+        segment_statistics->has_exact_bounds = true;
+        segment_statistics->set_statistics_object(create_zone_map<ColumnDataType>(iterable, chunk->size()));
+        segment_statistics->set_statistics_object(create_null_value_ratio(iterable, chunk->size()));
       }
 
       chunk_statistics[column_id] = segment_statistics;
@@ -0,0 +1,141 @@
+#include "bloom_filter.hpp"
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "abstract_statistics_object.hpp"
+#include "resolve_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename T>
+BloomFilter<T>::BloomFilter(std::vector<Block> init_blocks)
+    : AbstractStatisticsObject(data_type_from_type<T>()), blocks(std::move(init_blocks)) {
+  DebugAssert(!blocks.empty(), "Cannot construct empty BloomFilter");
+}
+
+template <typename T>
+std::unique_ptr<BloomFilter<T>> BloomFilter<T>::build_filter(const pmr_vector<T>& dictionary,
+                                                             uint32_t bits_per_value) {
+  DebugAssert(bits_per_value > 0, "Number of bits per value needs to be larger zero.");
+
+  if (dictionary.empty()) {
+    // Empty dictionaries will, e.g., occur in segments with only NULLs - or empty segments.
+    return nullptr;
+  }
+
+  constexpr auto BITS_PER_BLOCK = sizeof(Block) * 8;
+  const auto block_count = (dictionary.size() * bits_per_value + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK;
+
+  auto blocks = std::vector<Block>(block_count, Block{});
+  for (const auto& value : dictionary) {
+    const auto hash = _hash(value);
+    const auto mask = _mask(hash);
+    // Maps the upper 32 bits of the hash to [0, block_count) without a division
+    auto& block = blocks[((hash >> 32) * block_count) >> 32];
+    for (auto word_index = size_t{0}; word_index < block.size(); ++word_index) {
+      block[word_index] |= mask[word_index];
+    }
+  }
+
+  return std::make_unique<BloomFilter<T>>(std::move(blocks));
+}
+
+template <typename T>
+Cardinality BloomFilter<T>::estimate_cardinality(const PredicateCondition predicate_condition,
+                                                 const AllTypeVariant& variant_value,
+                                                 const std::optional<AllTypeVariant>& variant_value2) const {
+  // As for the other filters, BloomFilters are on a per-segment basis and estimate_cardinality is called for an entire
+  // column. Also, the BloomFilter does not store the number of values.
+  Fail("Currently, BloomFilters cannot be used to estimate cardinalities");
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> BloomFilter<T>::sliced(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& variant_value2) const {
+  if (does_not_contain(predicate_condition, variant_value, variant_value2)) {
+    return nullptr;
+  }
+
+  // The remaining values are a subset of the original values. Thus, the filter still does not yield false negatives.
+  return std::make_shared<BloomFilter<T>>(blocks);
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> BloomFilter<T>::scaled(const Selectivity /*selectivity*/) const {
+  return std::make_shared<BloomFilter<T>>(blocks);
+}
+
+template <typename T>
+bool BloomFilter<T>::does_not_contain(const PredicateCondition predicate_condition,
+                                      const AllTypeVariant& variant_value,
+                                      const std::optional<AllTypeVariant>& variant_value2) const {
+  // Early exit for NULL variants.
+  if (variant_is_null(variant_value)) {
+    return false;
+  }
+
+  // We expect the caller (e.g., the ChunkPruningRule) to handle type-safe conversions. Boost will throw an exception
+  // if this was not done.
+  const auto value = boost::get<T>(variant_value);
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return !may_contain(value);
+    case PredicateCondition::BetweenInclusive: {
+      Assert(variant_value2, "Between operator needs two values.");
+      if (variant_is_null(*variant_value2) || boost::get<T>(*variant_value2) != value) return false;
+      return !may_contain(value);
+    }
+    default:
+      return false;
+  }
+}
+
+template <typename T>
+bool BloomFilter<T>::may_contain(const T& value) const {
+  const auto hash = _hash(value);
+  const auto mask = _mask(hash);
+  const auto& block = blocks[((hash >> 32) * blocks.size()) >> 32];
+
+  auto contained = true;
+  for (auto word_index = size_t{0}; word_index < block.size(); ++word_index) {
+    contained &= (block[word_index] & mask[word_index]) != 0;
+  }
+  return contained;
+}
+
+template <typename T>
+uint64_t BloomFilter<T>::_hash(const T& value) {
+  // std::hash is the identity for integers on common platforms, so we mix the bits (finalizer of MurmurHash3).
+  auto hash = static_cast<uint64_t>(std::hash<T>{}(value));
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+template <typename T>
+typename BloomFilter<T>::Block BloomFilter<T>::_mask(const uint64_t hash) {
+  // Odd constants that spread the lower 32 bits of the hash across the words (taken from the Parquet specification)
+  static constexpr auto SALTS = Block{0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                      0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+  auto mask = Block{};
+  const auto key = static_cast<uint32_t>(hash);
+  for (auto word_index = size_t{0}; word_index < mask.size(); ++word_index) {
+    mask[word_index] = uint32_t{1} << ((key * SALTS[word_index]) >> 27);
+  }
+  return mask;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(BloomFilter);
+
+}  // namespace opossum
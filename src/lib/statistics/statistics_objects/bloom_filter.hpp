@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "abstract_statistics_object.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+static constexpr uint32_t DEFAULT_BLOOM_FILTER_BITS_PER_VALUE = 16;
+
+/**
+ * Filters are data structures that are primarily used for probabilistic membership queries. In Hyrise, they are
+ * typically created on a single segment. They can then be used to check whether a certain value exists in the segment.
+ * While histograms also support does_not_contain, their main purpose is not to answer membership queries, but to
+ * provide statistics estimations.
+ *
+ * MinMaxFilters and RangeFilters cannot prune equality predicates on high-cardinality columns with randomly
+ * distributed values (e.g., `WHERE order_uuid = '...'`), as the value range of every segment covers the searched
+ * value. The BloomFilter answers whether a value may be contained in the segment. It never yields false negatives, and
+ * with the default of 16 bits per distinct value, the rate of false positives is below 0.5%.
+ *
+ * This is a split block Bloom filter: The bits are divided into blocks of 256 bits (eight 32-bit words), and each
+ * value is mapped to a single block, in which it sets one bit per word. Thus, a lookup touches a single cache line
+ * and the bit positions within the block can be computed without branches.
+ */
+template <typename T>
+class BloomFilter : public AbstractStatisticsObject {
+ public:
+  using Block = std::array<uint32_t, 8>;
+
+  explicit BloomFilter(std::vector<Block> init_blocks);
+
+  // Returns nullptr for empty dictionaries
+  static std::unique_ptr<BloomFilter<T>> build_filter(const pmr_vector<T>& dictionary,
+                                                      uint32_t bits_per_value = DEFAULT_BLOOM_FILTER_BITS_PER_VALUE);
+
+  Cardinality estimate_cardinality(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                                   const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
+
+  std::shared_ptr<AbstractStatisticsObject> sliced(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+  std::shared_ptr<AbstractStatisticsObject> scaled(const Selectivity selectivity) const override;
+
+  // Only equality predicates (including BETWEEN predicates with equal bounds) can be pruned
+  bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                        const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
+
+  bool may_contain(const T& value) const;
+
+  const std::vector<Block> blocks;
+
+ private:
+  static uint64_t _hash(const T& value);
+
+  // Returns the bits that the hash sets in each word of its block
+  static Block _mask(const uint64_t hash);
+};
+
+template <typename T>
+std::ostream& operator<<(std::ostream& stream, const BloomFilter<T>& filter) {
+  stream << "{" << filter.blocks.size() << " block(s)}";
+  return stream;
+}
+
+EXPLICITLY_DECLARE_DATA_TYPES(BloomFilter);
+
+}  // namespace opossum
@@ -45,29 +45,6 @@ void add_segment_to_value_distribution(const AbstractSegment& segment, ValueDist
   });
 }
 
-template <typename T>
-std::vector<std::pair<T, HistogramCountType>> value_distribution_from_column(const Table& table,
-                                                                             const ColumnID column_id,
-                                                                             const HistogramDomain<T>& domain) {
-  // TODO(anybody) If you want to look into performance, this would probably benefit greatly from monotonic buffer
-  //               resources.
-  ValueDistributionMap<T> value_distribution_map;
-
-  const auto chunk_count = table.chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk = table.get_chunk(chunk_id);
-    if (!chunk) continue;
-
-    add_segment_to_value_distribution<T>(*chunk->get_segment(column_id), value_distribution_map, domain);
-  }
-
-  auto value_distribution =
-      std::vector<std::pair<T, HistogramCountType>>{value_distribution_map.begin(), value_distribution_map.end()};
-  std::sort(value_distribution.begin(), value_distribution.end(),
-            [&](const auto& l, const auto& r) { return l.first < r.first; });
-
-  return value_distribution;
-}
 }  // namespace
 
 namespace opossum {
@@ -99,9 +76,41 @@ EqualDistinctCountHistogram<T>::EqualDistinctCountHistogram(std::vector<T>&& bin
 template <typename T>
 std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_column(
     const Table& table, const ColumnID column_id, const BinID max_bin_count, const HistogramDomain<T>& domain) {
-  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
+  auto chunk_ids = std::vector<ChunkID>(table.chunk_count());
+  std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0});
+
+  return from_distribution(value_distribution_from_column(table, column_id, chunk_ids, domain), max_bin_count,
+                           domain);
+}
 
-  const auto value_distribution = value_distribution_from_column(table, column_id, domain);
+template <typename T>
+std::vector<std::pair<T, HistogramCountType>> EqualDistinctCountHistogram<T>::value_distribution_from_column(
+    const Table& table, const ColumnID column_id, const std::vector<ChunkID>& chunk_ids,
+    const HistogramDomain<T>& domain) {
+  // TODO(anybody) If you want to look into performance, this would probably benefit greatly from monotonic buffer
+  //               resources.
+  ValueDistributionMap<T> value_distribution_map;
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    add_segment_to_value_distribution<T>(*chunk->get_segment(column_id), value_distribution_map, domain);
+  }
+
+  auto value_distribution =
+      std::vector<std::pair<T, HistogramCountType>>{value_distribution_map.begin(), value_distribution_map.end()};
+  std::sort(value_distribution.begin(), value_distribution.end(),
+            [&](const auto& l, const auto& r) { return l.first < r.first; });
+
+  return value_distribution;
+}
+
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_distribution(
+    std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count,
+    const HistogramDomain<T>& domain) {
+  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
 
   if (value_distribution.empty()) {
     return nullptr;
@@ -36,6 +36,22 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
                                                                      const BinID max_bin_count,
                                                                      const HistogramDomain<T>& domain = {});
 
+  /**
+   * Returns the number of occurrences of each non-NULL value in the given chunks of a column, sorted by value.
+   * Building a histogram from the distribution of a subset of the chunks allows sampling (see TableStatistics).
+   */
+  static std::vector<std::pair<T, HistogramCountType>> value_distribution_from_column(
+      const Table& table, const ColumnID column_id, const std::vector<ChunkID>& chunk_ids,
+      const HistogramDomain<T>& domain = {});
+
+  /**
+   * Create an EqualDistinctCountHistogram from a value distribution as returned by value_distribution_from_column().
+   * Returns nullptr for an empty distribution.
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_distribution(
+      std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count,
+      const HistogramDomain<T>& domain = {});
+
   std::string name() const override;
   std::shared_ptr<AbstractHistogram<T>> clone() const override;
   HistogramCountType total_distinct_count() const override;
@@ -0,0 +1,112 @@
+#include "zone_map.hpp"
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "abstract_statistics_object.hpp"
+#include "resolve_type.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+ZoneMap<T>::ZoneMap(const ChunkOffset init_block_size, std::vector<Block> init_blocks)
+    : AbstractStatisticsObject(data_type_from_type<T>()), block_size(init_block_size), blocks(std::move(init_blocks)) {
+  DebugAssert(block_size > 0, "Block size needs to be larger than zero");
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> ZoneMap<T>::sliced(
+    const PredicateCondition /*predicate_condition*/, const AllTypeVariant& /*variant_value*/,
+    const std::optional<AllTypeVariant>& /*variant_value2*/) const {
+  return nullptr;
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> ZoneMap<T>::scaled(const Selectivity /*selectivity*/) const {
+  return nullptr;
+}
+
+template <typename T>
+std::vector<ZoneMapBlockMatch> ZoneMap<T>::match_blocks(const PredicateCondition predicate_condition,
+                                                        const AllTypeVariant& variant_value,
+                                                        const std::optional<AllTypeVariant>& variant_value2) const {
+  auto block_matches = std::vector<ZoneMapBlockMatch>(blocks.size(), ZoneMapBlockMatch::Some);
+
+  const auto is_between = is_between_predicate_condition(predicate_condition);
+  if ((!is_binary_numeric_predicate_condition(predicate_condition) && !is_between) || variant_is_null(variant_value) ||
+      (is_between && (!variant_value2 || variant_is_null(*variant_value2)))) {
+    return block_matches;
+  }
+
+  // We expect the caller (e.g., the TableScan) to handle type-safe conversions. Boost will throw an exception if this
+  // was not done.
+  const auto value = boost::get<T>(variant_value);
+  const auto value2 = is_between ? boost::get<T>(*variant_value2) : T{};
+
+  for (auto block_id = size_t{0}; block_id < blocks.size(); ++block_id) {
+    const auto& block = blocks[block_id];
+    if (block.null_count == block.row_count) {
+      block_matches[block_id] = ZoneMapBlockMatch::None;
+      continue;
+    }
+
+    const auto& min = block.min;
+    const auto& max = block.max;
+
+    // The predicate matches no row if it matches neither min nor max nor any value in between. It matches all rows if
+    // it matches both min and max (and everything in between, which holds for all supported predicates but !=).
+    auto matches_none = false;
+    auto matches_all = false;
+    switch (predicate_condition) {
+      case PredicateCondition::Equals:
+        matches_none = value < min || max < value;
+        matches_all = min == value && max == value;
+        break;
+      case PredicateCondition::NotEquals:
+        matches_none = min == value && max == value;
+        matches_all = value < min || max < value;
+        break;
+      case PredicateCondition::LessThan:
+        matches_none = !(min < value);
+        matches_all = max < value;
+        break;
+      case PredicateCondition::LessThanEquals:
+        matches_none = value < min;
+        matches_all = !(value < max);
+        break;
+      case PredicateCondition::GreaterThan:
+        matches_none = !(value < max);
+        matches_all = value < min;
+        break;
+      case PredicateCondition::GreaterThanEquals:
+        matches_none = max < value;
+        matches_all = !(min < value);
+        break;
+      default: {
+        const auto lower_inclusive = is_lower_inclusive_between(predicate_condition);
+        const auto upper_inclusive = is_upper_inclusive_between(predicate_condition);
+        const auto below_lower_bound = lower_inclusive ? max < value : !(value < max);
+        const auto above_upper_bound = upper_inclusive ? value2 < min : !(min < value2);
+        matches_none = below_lower_bound || above_upper_bound;
+        matches_all = (lower_inclusive ? !(min < value) : value < min) &&
+                      (upper_inclusive ? !(value2 < max) : max < value2);
+      }
+    }
+
+    if (matches_none) {
+      block_matches[block_id] = ZoneMapBlockMatch::None;
+    } else if (matches_all && block.null_count == 0) {
+      block_matches[block_id] = ZoneMapBlockMatch::All;
+    }
+  }
+
+  return block_matches;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ZoneMap);
+
+}  // namespace opossum
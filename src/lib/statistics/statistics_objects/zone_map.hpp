@@ -0,0 +1,71 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "abstract_statistics_object.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+static constexpr auto DEFAULT_ZONE_MAP_BLOCK_SIZE = ChunkOffset{4096};
+
+// Result of checking a block of a ZoneMap against a predicate. Rows that are NULL never match.
+enum class ZoneMapBlockMatch : uint8_t { None, Some, All };
+
+/**
+ * Filters such as the MinMaxFilter prune entire segments. Within a segment, matching values are often clustered in a
+ * few blocks of rows (e.g., for data that was inserted in the order of a date column). A ZoneMap (also known as small
+ * materialized aggregate) splits a segment into blocks of a fixed number of rows and stores the minimum, the maximum,
+ * and the number of NULLs of each block. Scans use it to skip blocks in which no row can match and to emit blocks in
+ * which all rows match without looking at the values.
+ *
+ * In contrast to the other statistics objects, a ZoneMap refers to the positions of the values in its segment. Thus,
+ * it is only valid for exactly this segment and cannot be sliced or scaled.
+ */
+template <typename T>
+class ZoneMap : public AbstractStatisticsObject {
+ public:
+  struct Block {
+    T min{};
+    T max{};
+    ChunkOffset null_count{0};
+    ChunkOffset row_count{0};
+  };
+
+  ZoneMap(const ChunkOffset init_block_size, std::vector<Block> init_blocks);
+
+  // Returns nullptr, see class comment
+  std::shared_ptr<AbstractStatisticsObject> sliced(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+  // Returns nullptr, see class comment
+  std::shared_ptr<AbstractStatisticsObject> scaled(const Selectivity selectivity) const override;
+
+  // Returns for each block whether none, some, or all of its rows match the predicate. Predicates other than
+  // comparisons and BETWEEN result in ZoneMapBlockMatch::Some for all blocks.
+  std::vector<ZoneMapBlockMatch> match_blocks(const PredicateCondition predicate_condition,
+                                              const AllTypeVariant& variant_value,
+                                              const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
+
+  const ChunkOffset block_size;
+  const std::vector<Block> blocks;
+};
+
+template <typename T>
+std::ostream& operator<<(std::ostream& stream, const ZoneMap<T>& zone_map) {
+  stream << "{";
+  for (const auto& block : zone_map.blocks) {
+    stream << "[" << block.min << " " << block.max << " " << block.null_count << "/" << block.row_count << "]";
+  }
+  stream << "}";
+  return stream;
+}
+
+EXPLICITLY_DECLARE_DATA_TYPES(ZoneMap);
+
+}  // namespace opossum
@@ -1,83 +1,398 @@
 #include "table_statistics.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
+#include <optional>
 #include <thread>
+#include <unordered_map>
+#include <utility>
 
 #include "attribute_statistics.hpp"
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram_builder.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
+ * (for tables with >= 200m rows) are created.
+ */
+BinID histogram_bin_count(const Cardinality row_count) {
+  return std::min<BinID>(100, std::max<BinID>(5, static_cast<BinID>(row_count / 2'000)));
+}
+
+/**
+ * Creates a histogram from the value distribution of a sample, of which each row represents @param scale rows of the
+ * table. The bins are formed like those of an EqualDistinctCountHistogram. Their heights are scaled, and their distinct
+ * counts are extrapolated using the Guaranteed-Error Estimator (GEE, Charikar et al., "Towards Estimation Error
+ * Guarantees for Distinct Values", PODS 2000): values that occur once in the sample are assumed to stand for
+ * sqrt(scale) distinct values, values that occur more often are assumed to be all there is.
+ */
+template <typename T>
+std::shared_ptr<AbstractHistogram<T>> histogram_from_sample(
+    std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const float scale, const BinID max_bin_count,
+    const HistogramDomain<T>& domain) {
+  if (scale == 1.0f) {
+    return EqualDistinctCountHistogram<T>::from_distribution(std::move(value_distribution), max_bin_count, domain);
+  }
+
+  if (value_distribution.empty()) return nullptr;
+
+  const auto bin_count = std::min<BinID>(max_bin_count, value_distribution.size());
+  const auto distinct_count_per_bin = value_distribution.size() / bin_count;
+  const auto bin_count_with_extra_value = value_distribution.size() % bin_count;
+  const auto singleton_scale = std::sqrt(scale);
+
+  auto builder = GenericHistogramBuilder<T>{bin_count, domain};
+  auto min_value_idx = size_t{0};
+  for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+    const auto bin_distinct_count = distinct_count_per_bin + (bin_id < bin_count_with_extra_value ? 1 : 0);
+    const auto max_value_idx = min_value_idx + bin_distinct_count - 1;
+
+    auto height = HistogramCountType{0};
+    auto singleton_count = HistogramCountType{0};
+    for (auto value_idx = min_value_idx; value_idx <= max_value_idx; ++value_idx) {
+      height += value_distribution[value_idx].second;
+      if (value_distribution[value_idx].second == 1) ++singleton_count;
+    }
+
+    const auto scaled_height = height * scale;
+    const auto distinct_count =
+        singleton_scale * singleton_count + (static_cast<HistogramCountType>(bin_distinct_count) - singleton_count);
+    builder.add_bin(value_distribution[min_value_idx].first, value_distribution[max_value_idx].first, scaled_height,
+                    std::min(scaled_height, distinct_count));
+
+    min_value_idx = max_value_idx + 1;
+  }
+
+  return builder.build();
+}
+
+/**
+ * Merges the value distribution of added rows into @param histogram. Values within a bin add to its height. Values
+ * between two bins extend the preceding bin, values below or above the histogram form a new bin. As the histogram does
+ * not tell which values it contains, we assume that values within a bin are the same values as the existing ones
+ * unless there are more of them.
+ */
+template <typename T>
+std::shared_ptr<AbstractHistogram<T>> merged_histogram(
+    const AbstractHistogram<T>& histogram, const std::vector<std::pair<T, HistogramCountType>>& value_distribution) {
+  const auto bin_count = histogram.bin_count();
+  const auto value_count = value_distribution.size();
+  auto value_idx = size_t{0};
+
+  auto builder = GenericHistogramBuilder<T>{bin_count + 2, histogram.domain()};
+
+  // Adds a bin for all remaining values smaller than @param bound (or all remaining values if no bound is given)
+  const auto add_bin_for_values = [&](const std::optional<T>& bound) {
+    const auto first_value_idx = value_idx;
+    auto height = HistogramCountType{0};
+    while (value_idx < value_count && (!bound || value_distribution[value_idx].first < *bound)) {
+      height += value_distribution[value_idx].second;
+      ++value_idx;
+    }
+
+    if (value_idx == first_value_idx) return;
+    builder.add_bin(value_distribution[first_value_idx].first, value_distribution[value_idx - 1].first, height,
+                    static_cast<HistogramCountType>(value_idx - first_value_idx));
+  };
+
+  add_bin_for_values(histogram.bin_minimum(BinID{0}));
+
+  for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+    auto bin_maximum = histogram.bin_maximum(bin_id);
+    auto height = histogram.bin_height(bin_id);
+    auto contained_distinct_count = HistogramCountType{0};
+    auto added_distinct_count = HistogramCountType{0};
+
+    for (; value_idx < value_count && value_distribution[value_idx].first <= bin_maximum; ++value_idx) {
+      height += value_distribution[value_idx].second;
+      ++contained_distinct_count;
+    }
+
+    if (bin_id + 1 < bin_count) {
+      const auto& next_bin_minimum = histogram.bin_minimum(bin_id + 1);
+      for (; value_idx < value_count && value_distribution[value_idx].first < next_bin_minimum; ++value_idx) {
+        height += value_distribution[value_idx].second;
+        ++added_distinct_count;
+        bin_maximum = value_distribution[value_idx].first;
+      }
+    }
+
+    const auto distinct_count =
+        std::max(histogram.bin_distinct_count(bin_id), contained_distinct_count) + added_distinct_count;
+    builder.add_bin(histogram.bin_minimum(bin_id), bin_maximum, height, std::min(height, distinct_count));
+  }
+
+  add_bin_for_values(std::nullopt);
+
+  return builder.build();
+}
+
+/**
+ * Merges two value distributions as returned by value_distribution_from_column(). The result is sorted by value, and
+ * the counts of values contained in both distributions are added.
+ */
+template <typename T>
+std::vector<std::pair<T, HistogramCountType>> merged_value_distribution(
+    const std::vector<std::pair<T, HistogramCountType>>& lhs,
+    const std::vector<std::pair<T, HistogramCountType>>& rhs) {
+  auto value_distribution = std::vector<std::pair<T, HistogramCountType>>{};
+  value_distribution.reserve(lhs.size() + rhs.size());
+
+  auto lhs_idx = size_t{0};
+  auto rhs_idx = size_t{0};
+  while (lhs_idx < lhs.size() || rhs_idx < rhs.size()) {
+    if (rhs_idx == rhs.size() || (lhs_idx < lhs.size() && lhs[lhs_idx].first < rhs[rhs_idx].first)) {
+      value_distribution.emplace_back(lhs[lhs_idx]);
+      ++lhs_idx;
+    } else if (lhs_idx == lhs.size() || rhs[rhs_idx].first < lhs[lhs_idx].first) {
+      value_distribution.emplace_back(rhs[rhs_idx]);
+      ++rhs_idx;
+    } else {
+      value_distribution.emplace_back(lhs[lhs_idx].first, lhs[lhs_idx].second + rhs[rhs_idx].second);
+      ++lhs_idx;
+      ++rhs_idx;
+    }
+  }
+
+  return value_distribution;
+}
+
+}  // namespace
+
 namespace opossum {
 
-std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table) {
+std::vector<ChunkID> TableStatistics::sample_chunk_ids(const Table& table, const size_t sample_row_count) {
+  const auto row_count = table.row_count();
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+
+  auto chunk_ids = std::vector<ChunkID>{};
+  if (row_count > sample_row_count) {
+    const auto sample_chunk_count = std::min<size_t>(
+        chunk_count, static_cast<size_t>(std::ceil(static_cast<double>(sample_row_count) * chunk_count / row_count)));
+    for (auto sample_idx = size_t{0}; sample_idx < sample_chunk_count; ++sample_idx) {
+      const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(sample_idx * chunk_count / sample_chunk_count)};
+      if (table.get_chunk(chunk_id)) chunk_ids.emplace_back(chunk_id);
+    }
+  } else {
+    chunk_ids.resize(chunk_count);
+    std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0});
+  }
+
+  return chunk_ids;
+}
+
+std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table, const size_t sample_row_count) {
+  Assert(sample_row_count > 0, "Expected a non-empty sample");
+
   std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics(table.column_count());
 
-  /**
-   * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
-   * (for tables with >= 200m rows) are created.
-   */
-  const auto histogram_bin_count = std::min<size_t>(100, std::max<size_t>(5, table.row_count() / 2'000));
-
-  auto next_column_id = std::atomic<size_t>{0u};
-  auto threads = std::vector<std::thread>{};
-
-  /**
-   * Parallely create statistics objects for the Table's columns. Do not use JobTask as we want this to be parallel
-   * even if Hyrise is running without a scheduler.
-   */
-  for (auto thread_id = 0u;
-       thread_id < std::min(static_cast<uint>(table.column_count()), std::thread::hardware_concurrency() + 1);
-       ++thread_id) {
-    threads.emplace_back([&] {
-      while (true) {
-        auto my_column_id = ColumnID{static_cast<ColumnID::base_type>(next_column_id++)};
-        if (static_cast<ColumnCount>(my_column_id) >= table.column_count()) return;
-
-        const auto column_data_type = table.column_data_type(my_column_id);
-
-        resolve_data_type(column_data_type, [&](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
-
-          const auto histogram =
-              EqualDistinctCountHistogram<ColumnDataType>::from_column(table, my_column_id, histogram_bin_count);
-
-          if (histogram) {
-            output_column_statistics->set_statistics_object(histogram);
-
-            // Use the insight that the histogram will only contain non-null values to generate the NullValueRatio
-            // property
-            const auto null_value_ratio =
-                table.row_count() == 0
-                    ? 0.0f
-                    : 1.0f - (static_cast<float>(histogram->total_count()) / static_cast<float>(table.row_count()));
-            output_column_statistics->set_statistics_object(
-                std::make_shared<NullValueRatioStatistics>(null_value_ratio));
-          } else {
-            // Failure to generate a histogram currently only stems from all-null segments.
-            // TODO(anybody) this is a slippery assumption. But the alternative would be a full segment scan...
-            output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(1.0f));
-          }
+  const auto row_count = table.row_count();
+  const auto bin_count = histogram_bin_count(static_cast<Cardinality>(row_count));
+
+  // Rows are still appended to mutable chunks. Remember how many of them are covered so that updated() does not add
+  // them again once the chunks are finalized.
+  auto mutable_chunk_sizes = std::unordered_map<ChunkID, ChunkOffset>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk && chunk->is_mutable()) mutable_chunk_sizes.emplace(chunk_id, chunk->size());
+  }
+  const auto chunk_ids = sample_chunk_ids(table, sample_row_count);
+
+  auto sampled_row_count = size_t{0};
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk) sampled_row_count += chunk->size();
+  }
+  const auto scale = sampled_row_count == 0 || sampled_row_count >= row_count
+                         ? 1.0f
+                         : static_cast<float>(row_count) / static_cast<float>(sampled_row_count);
+
+  const auto create_column_statistics = [&](const ColumnID column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
 
-          column_statistics[my_column_id] = output_column_statistics;
-        });
+      auto value_distribution =
+          EqualDistinctCountHistogram<ColumnDataType>::value_distribution_from_column(table, column_id, chunk_ids);
+      const auto histogram = histogram_from_sample(std::move(value_distribution), scale, bin_count, {});
+
+      if (histogram) {
+        output_column_statistics->set_statistics_object(histogram);
+
+        // Use the insight that the histogram will only contain non-null values to generate the NullValueRatio
+        // property
+        const auto null_value_ratio =
+            row_count == 0 ? 0.0f
+                           : std::max(0.0f, 1.0f - (static_cast<float>(histogram->total_count()) /
+                                                    static_cast<float>(row_count)));
+        output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+      } else {
+        // Failure to generate a histogram currently only stems from all-null segments.
+        // TODO(anybody) this is a slippery assumption. But the alternative would be a full segment scan...
+        output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(1.0f));
       }
+
+      column_statistics[column_id] = output_column_statistics;
     });
-  }
+  };
+
+  const auto column_count = table.column_count();
+  if (Hyrise::get().is_multi_threaded()) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, column_id] { create_column_statistics(column_id); }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  } else {
+    /**
+     * Without a scheduler, JobTasks would be executed sequentially. As creating the statistics of large tables takes a
+     * while, we still want this to be parallel and use threads instead.
+     */
+    auto next_column_id = std::atomic<size_t>{0u};
+    auto threads = std::vector<std::thread>{};
 
-  for (auto& thread : threads) {
-    thread.join();
+    for (auto thread_id = 0u;
+         thread_id < std::min(static_cast<uint>(column_count), std::thread::hardware_concurrency() + 1); ++thread_id) {
+      threads.emplace_back([&] {
+        while (true) {
+          auto my_column_id = ColumnID{static_cast<ColumnID::base_type>(next_column_id++)};
+          if (static_cast<ColumnCount>(my_column_id) >= column_count) return;
+
+          create_column_statistics(my_column_id);
+        }
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
   }
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
+  const auto table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+  table_statistics->mutable_chunk_sizes = std::move(mutable_chunk_sizes);
+  return table_statistics;
 }
 
 TableStatistics::TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
-                                 const Cardinality init_row_count)
-    : column_statistics(std::move(init_column_statistics)), row_count(init_row_count) {}
+                                 const Cardinality init_row_count, const Cardinality init_added_row_count)
+    : column_statistics(std::move(init_column_statistics)),
+      row_count(init_row_count),
+      added_row_count(init_added_row_count) {}
+
+std::shared_ptr<TableStatistics> TableStatistics::updated(const Table& table,
+                                                          const std::vector<ChunkID>& chunk_ids) const {
+  DebugAssert(column_statistics.size() == table.column_count(), "Statistics do not belong to the table");
+
+  // Chunks that were mutable when the statistics were created are partly covered already. Only the rows appended since
+  // are added, assuming that they are distributed like the chunk's other rows.
+  auto new_chunk_ids = std::vector<ChunkID>{};
+  auto partly_covered_chunks = std::vector<std::pair<ChunkID, HistogramCountType>>{};
+  auto remaining_mutable_chunk_sizes = mutable_chunk_sizes;
+  auto chunk_row_count = size_t{0};
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto chunk_size = chunk->size();
+    const auto mutable_chunk_size_iter = remaining_mutable_chunk_sizes.find(chunk_id);
+    if (mutable_chunk_size_iter == remaining_mutable_chunk_sizes.end()) {
+      new_chunk_ids.emplace_back(chunk_id);
+      chunk_row_count += chunk_size;
+      continue;
+    }
+
+    const auto covered_row_count = mutable_chunk_size_iter->second;
+    remaining_mutable_chunk_sizes.erase(mutable_chunk_size_iter);
+    if (chunk_size <= covered_row_count) continue;
+
+    const auto appended_row_count = chunk_size - covered_row_count;
+    partly_covered_chunks.emplace_back(chunk_id, static_cast<HistogramCountType>(appended_row_count) /
+                                                     static_cast<HistogramCountType>(chunk_size));
+    chunk_row_count += appended_row_count;
+  }
+  const auto new_row_count = static_cast<Cardinality>(chunk_row_count);
+
+  // Merging keeps the bin count and the bin boundaries of the original histograms and assumes that the added values
+  // are distributed like the existing ones. The more rows were added, the less this holds.
+  const auto new_added_row_count = added_row_count + new_row_count;
+  if (new_added_row_count > STALENESS_THRESHOLD * (row_count - added_row_count)) {
+    return from_table(table);
+  }
+
+  auto new_column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(column_statistics.size());
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(column_statistics[column_id]->data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto& old_column_statistics =
+          static_cast<const AttributeStatistics<ColumnDataType>&>(*column_statistics[column_id]);
+      const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
+
+      const auto added_value_distribution = [&](const HistogramDomain<ColumnDataType>& domain) {
+        auto value_distribution = EqualDistinctCountHistogram<ColumnDataType>::value_distribution_from_column(
+            table, column_id, new_chunk_ids, domain);
+        for (const auto& [chunk_id, added_share] : partly_covered_chunks) {
+          auto chunk_value_distribution =
+              EqualDistinctCountHistogram<ColumnDataType>::value_distribution_from_column(table, column_id,
+                                                                                          {chunk_id}, domain);
+          for (auto& value_and_count : chunk_value_distribution) {
+            value_and_count.second *= added_share;
+          }
+          value_distribution = merged_value_distribution(value_distribution, chunk_value_distribution);
+        }
+        return value_distribution;
+      };
+
+      auto histogram = std::shared_ptr<AbstractHistogram<ColumnDataType>>{};
+      auto non_null_row_count = HistogramCountType{0};
+      if (old_column_statistics.histogram) {
+        const auto value_distribution = added_value_distribution(old_column_statistics.histogram->domain());
+        for (const auto& value_and_count : value_distribution) {
+          non_null_row_count += value_and_count.second;
+        }
+        histogram = merged_histogram(*old_column_statistics.histogram, value_distribution);
+      } else {
+        auto value_distribution = added_value_distribution({});
+        for (const auto& value_and_count : value_distribution) {
+          non_null_row_count += value_and_count.second;
+        }
+        histogram = EqualDistinctCountHistogram<ColumnDataType>::from_distribution(
+            std::move(value_distribution), histogram_bin_count(row_count + new_row_count));
+      }
+
+      if (histogram) output_column_statistics->set_statistics_object(histogram);
+
+      const auto old_null_value_ratio =
+          old_column_statistics.null_value_ratio ? old_column_statistics.null_value_ratio->ratio : 0.0f;
+      const auto null_row_count = old_null_value_ratio * row_count + (new_row_count - non_null_row_count);
+      const auto null_value_ratio =
+          row_count + new_row_count == 0.0f ? 0.0f : null_row_count / (row_count + new_row_count);
+      output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+
+      new_column_statistics[column_id] = output_column_statistics;
+    });
+  }
+
+  const auto table_statistics = std::make_shared<TableStatistics>(std::move(new_column_statistics),
+                                                                  row_count + new_row_count, new_added_row_count);
+  table_statistics->mutable_chunk_sizes = std::move(remaining_mutable_chunk_sizes);
+  return table_statistics;
+}
 
 DataType TableStatistics::column_data_type(const ColumnID column_id) const {
   DebugAssert(column_id < column_statistics.size(), "ColumnID out of bounds");
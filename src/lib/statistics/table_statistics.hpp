@@ -20,14 +20,39 @@ class Table;
  */
 class TableStatistics {
  public:
+  // Tables with more rows are sampled when creating statistics
+  static constexpr auto DEFAULT_SAMPLE_ROW_COUNT = size_t{1'000'000};
+
+  // Share of rows that can be added to a table before its statistics are created anew instead of being updated
+  static constexpr auto STALENESS_THRESHOLD = 0.2f;
+
   /**
    * Creates statistics objects for cardinality estimation for all Columns in @param table. See implementation for
-   * which statistics objects are created.
+   * which statistics objects are created. If the table has more than @param sample_row_count rows, the statistics are
+   * created from a block sample of its chunks.
+   */
+  static std::shared_ptr<TableStatistics> from_table(const Table& table,
+                                                     const size_t sample_row_count = DEFAULT_SAMPLE_ROW_COUNT);
+
+  /**
+   * Returns the chunks to build statistics from. For tables with more than @param sample_row_count rows, these are
+   * evenly spaced chunks that together contain about sample_row_count rows (a block sample). Sampling whole chunks is
+   * much cheaper than sampling individual rows, as entire segments are processed sequentially. It assumes, however,
+   * that the values are not clustered by chunk. For smaller tables, all chunks are returned.
    */
-  static std::shared_ptr<TableStatistics> from_table(const Table& table);
+  static std::vector<ChunkID> sample_chunk_ids(const Table& table, const size_t sample_row_count);
 
   TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
-                  const Cardinality init_row_count);
+                  const Cardinality init_row_count, const Cardinality init_added_row_count = 0);
+
+  /**
+   * Returns statistics that additionally cover the rows of the chunks @param chunk_ids of @param table, which were
+   * appended after these statistics were created (e.g., when they were finalized). Their values are merged into the
+   * existing histograms. Once more than STALENESS_THRESHOLD of the rows were added this way, the statistics are
+   * created anew using from_table(). Rows that were deleted are not considered. Chunks that were still mutable when
+   * the statistics were created are only counted with the rows appended since (see mutable_chunk_sizes).
+   */
+  std::shared_ptr<TableStatistics> updated(const Table& table, const std::vector<ChunkID>& chunk_ids) const;
 
   /**
    * @return column_statistics[column_id]->data_type
@@ -36,6 +61,13 @@ class TableStatistics {
 
   const std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics;
   Cardinality row_count;
+
+  // Number of rows that were added using updated() since the statistics were created using from_table()
+  Cardinality added_row_count;
+
+  // Sizes of the chunks that were still mutable when the statistics were created using from_table(). Their rows up to
+  // that size are already covered and must not be added again once the chunks are finalized.
+  std::unordered_map<ChunkID, ChunkOffset> mutable_chunk_sizes;
 };
 
 std::ostream& operator<<(std::ostream& stream, const TableStatistics& table_statistics);
@@ -1,19 +1,26 @@
 #include "chunk.hpp"
 
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "abstract_encoded_segment.hpp"
 #include "abstract_segment.hpp"
+#include "dictionary_segment.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
 #include "index/abstract_index.hpp"
 #include "reference_segment.hpp"
 #include "resolve_type.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/compressed_vector_type.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -41,9 +48,27 @@ Chunk::Chunk(Segments segments, const std::shared_ptr<MvccData>& mvcc_data,
   if (alloc) _alloc = *alloc;
 }
 
+Chunk::~Chunk() {
+  // Remove the files of evicted segments. Errors are ignored, as destructors must not throw.
+  for (const auto& tiering_state : _tiering_states) {
+    auto error_code = std::error_code{};
+    if (tiering_state.file_name) std::filesystem::remove(*tiering_state.file_name, error_code);
+  }
+}
+
 bool Chunk::is_mutable() const { return _is_mutable; }
 
 void Chunk::replace_segment(size_t column_id, const std::shared_ptr<AbstractSegment>& segment) {
+  const auto lock = std::lock_guard<std::mutex>{_tiering_mutex};
+
+  // An evicted segment is replaced as a whole, its file is not needed anymore
+  if (!_tiering_states.empty() && _tiering_states[column_id].file_name) {
+    // Failing to remove the file only leaks disk space, the segment is replaced nonetheless
+    auto error_code = std::error_code{};
+    std::filesystem::remove(*_tiering_states[column_id].file_name, error_code);
+    _tiering_states[column_id].file_name.reset();
+  }
+
   std::atomic_store(&_segments.at(column_id), segment);
 }
 
@@ -70,14 +95,124 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
 }
 
 std::shared_ptr<AbstractSegment> Chunk::get_segment(ColumnID column_id) const {
+  auto segment = std::atomic_load(&_segments.at(column_id));
+  if (!segment) segment = _load_evicted_segment(column_id);
+  return segment;
+}
+
+void Chunk::evict_segment(const ColumnID column_id, const std::string& file_name) {
+  Assert(!is_mutable(), "Only segments of immutable chunks can be evicted");
+
+  const auto lock = std::lock_guard<std::mutex>{_tiering_mutex};
+
+  const auto segment = std::atomic_load(&_segments.at(column_id));
+  Assert(segment, "Segment has already been evicted");
+  Assert(is_evictable(*segment), "Only encoded segments with byte-aligned compressed vectors can be evicted");
+
+  // As the segment's type is stored in the file, the nullability of the column does not matter for encoded segments
+  BinaryWriter::write_segment(*segment, true, file_name);
+
+  if (_tiering_states.empty()) _tiering_states.resize(_segments.size());
+  auto& tiering_state = _tiering_states[column_id];
+  tiering_state.file_name = file_name;
+  tiering_state.data_type = segment->data_type();
+  tiering_state.access_counter = segment->access_counter;
+  tiering_state.evicted_segment = segment;
+  tiering_state.dictionary.reset();
+  resolve_data_type(segment->data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<ColumnDataType>>(segment)) {
+      tiering_state.dictionary = dictionary_segment->dictionary();
+    }
+  });
+  ++tiering_state.eviction_count;
+
+  _evicted_chunk_size = static_cast<ChunkOffset>(segment->size());
+  std::atomic_store(&_segments[column_id], std::shared_ptr<AbstractSegment>{});
+}
+
+bool Chunk::is_evictable(const AbstractSegment& segment) {
+  const auto encoded_segment = dynamic_cast<const AbstractEncodedSegment*>(&segment);
+  if (!encoded_segment) return false;
+
+  // The binary segment format does not support SIMD-BP128 (see BinaryWriter::_compressed_vector_width)
+  const auto compressed_vector_type = encoded_segment->compressed_vector_type();
+  return !compressed_vector_type || *compressed_vector_type != CompressedVectorType::SimdBp128;
+}
+
+bool Chunk::is_indexed(const ColumnID column_id) const {
+  const auto segment = std::shared_ptr<const AbstractSegment>{get_resident_segment(column_id)};
+  const auto lock = std::shared_lock<std::shared_mutex>{_indexes_mutex};
+  return std::any_of(_indexes.cbegin(), _indexes.cend(),
+                     [&](const auto& index) { return index->is_index_for_segment(segment); });
+}
+
+std::shared_ptr<AbstractSegment> Chunk::get_resident_segment(ColumnID column_id) const {
   return std::atomic_load(&_segments.at(column_id));
 }
 
+SegmentResidency Chunk::segment_residency(ColumnID column_id) const {
+  const auto lock = std::lock_guard<std::mutex>{_tiering_mutex};
+
+  auto residency = SegmentResidency{};
+  if (_tiering_states.empty()) return residency;
+
+  const auto& tiering_state = _tiering_states.at(column_id);
+  residency.is_resident = !tiering_state.file_name;
+  residency.eviction_count = tiering_state.eviction_count;
+  residency.load_count = tiering_state.load_count;
+  return residency;
+}
+
+std::shared_ptr<AbstractSegment> Chunk::_load_evicted_segment(ColumnID column_id) const {
+  const auto lock = std::lock_guard<std::mutex>{_tiering_mutex};
+
+  // Another thread might have loaded the segment in the meantime
+  auto segment = std::atomic_load(&_segments[column_id]);
+  if (segment) return segment;
+
+  auto& tiering_state = _tiering_states[column_id];
+  DebugAssert(tiering_state.file_name, "Segment is neither resident nor evicted");
+
+  segment = tiering_state.evicted_segment.lock();
+  if (!segment) {
+    segment =
+        BinaryParser::parse_segment(*tiering_state.file_name, _evicted_chunk_size, tiering_state.data_type, true);
+
+    // Attach the segment to the dictionary it shared with other segments before the eviction
+    if (const auto dictionary = tiering_state.dictionary.lock()) {
+      resolve_data_type(tiering_state.data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        if (const auto typed_segment = std::dynamic_pointer_cast<DictionarySegment<ColumnDataType>>(segment)) {
+          const auto typed_dictionary = std::static_pointer_cast<const pmr_vector<ColumnDataType>>(dictionary);
+          segment =
+              std::make_shared<DictionarySegment<ColumnDataType>>(typed_dictionary, typed_segment->attribute_vector());
+        }
+      });
+    }
+    segment->access_counter = tiering_state.access_counter;
+  }
+
+  auto error_code = std::error_code{};
+  std::filesystem::remove(*tiering_state.file_name, error_code);
+  tiering_state.file_name.reset();
+  tiering_state.evicted_segment.reset();
+  tiering_state.dictionary.reset();
+  ++tiering_state.load_count;
+
+  std::atomic_store(&_segments[column_id], segment);
+  return segment;
+}
+
 ColumnCount Chunk::column_count() const { return ColumnCount{static_cast<ColumnCount::base_type>(_segments.size())}; }
 
 ChunkOffset Chunk::size() const {
   if (_segments.empty()) return 0;
-  const auto first_segment = get_segment(ColumnID{0});
+  const auto first_segment = std::atomic_load(&_segments.front());
+
+  // Only segments of immutable chunks are evicted, so the size cannot have changed since the eviction
+  if (!first_segment) return _evicted_chunk_size;
+
   return static_cast<ChunkOffset>(first_segment->size());
 }
 
@@ -88,6 +223,7 @@ std::shared_ptr<MvccData> Chunk::mvcc_data() const { return _mvcc_data; }
 std::vector<std::shared_ptr<AbstractIndex>> Chunk::get_indexes(
     const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const {
   auto result = std::vector<std::shared_ptr<AbstractIndex>>();
+  const auto lock = std::shared_lock<std::shared_mutex>{_indexes_mutex};
   std::copy_if(_indexes.cbegin(), _indexes.cend(), std::back_inserter(result),
                [&](const auto& index) { return index->is_index_for(segments); });
   return result;
@@ -119,6 +255,7 @@ std::vector<std::shared_ptr<AbstractIndex>> Chunk::get_indexes(const std::vector
 
 std::shared_ptr<AbstractIndex> Chunk::get_index(
     const SegmentIndexType index_type, const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_indexes_mutex};
   auto index_it = std::find_if(_indexes.cbegin(), _indexes.cend(), [&](const auto& index) {
     return index->is_index_for(segments) && index->type() == index_type;
   });
@@ -132,7 +269,13 @@ std::shared_ptr<AbstractIndex> Chunk::get_index(const SegmentIndexType index_typ
   return get_index(index_type, segments);
 }
 
+void Chunk::add_index(const std::shared_ptr<AbstractIndex>& index) {
+  const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
+  _indexes.emplace_back(index);
+}
+
 void Chunk::remove_index(const std::shared_ptr<AbstractIndex>& index) {
+  const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
   auto it = std::find(_indexes.cbegin(), _indexes.cend(), index);
   DebugAssert(it != _indexes.cend(), "Trying to remove a non-existing index");
   _indexes.erase(it);
@@ -166,8 +309,8 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
 
   _alloc = PolymorphicAllocator<size_t>(memory_source);
   Segments new_segments(_alloc);
-  for (const auto& segment : _segments) {
-    new_segments.push_back(segment->copy_using_allocator(_alloc));
+  for (auto column_id = ColumnID{0}; column_id < _segments.size(); ++column_id) {
+    new_segments.push_back(get_segment(column_id)->copy_using_allocator(_alloc));
   }
   _segments = std::move(new_segments);
 }
@@ -177,8 +320,10 @@ const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc;
 size_t Chunk::memory_usage(const MemoryUsageCalculationMode mode) const {
   auto bytes = size_t{sizeof(*this)};
 
-  for (const auto& segment : _segments) {
-    bytes += segment->memory_usage(mode);
+  for (auto column_id = ColumnID{0}; column_id < _segments.size(); ++column_id) {
+    // Evicted segments do not occupy memory
+    const auto segment = get_resident_segment(column_id);
+    if (segment) bytes += segment->memory_usage(mode);
   }
 
   // TODO(anybody) Index memory usage missing
@@ -206,14 +351,18 @@ std::vector<std::shared_ptr<const AbstractSegment>> Chunk::_get_segments_for_ids
   return segments;
 }
 
-const std::optional<ChunkPruningStatistics>& Chunk::pruning_statistics() const { return _pruning_statistics; }
+std::shared_ptr<const ChunkPruningStatistics> Chunk::pruning_statistics() const {
+  return std::atomic_load(&_pruning_statistics);
+}
 
 void Chunk::set_pruning_statistics(const std::optional<ChunkPruningStatistics>& pruning_statistics) {
   Assert(!is_mutable(), "Cannot set pruning statistics on mutable chunks.");
   Assert(!pruning_statistics || pruning_statistics->size() == static_cast<size_t>(column_count()),
          "Pruning statistics must have same number of segments as Chunk");
 
-  _pruning_statistics = pruning_statistics;
+  std::atomic_store(&_pruning_statistics,
+                    pruning_statistics ? std::make_shared<const ChunkPruningStatistics>(*pruning_statistics)
+                                       : std::shared_ptr<const ChunkPruningStatistics>{});
 }
 void Chunk::increase_invalid_row_count(const uint32_t count) const { _invalid_row_count += count; }
 
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <string>
@@ -15,6 +16,7 @@
 #include "all_type_variant.hpp"
 #include "index/segment_index_type.hpp"
 #include "mvcc_data.hpp"
+#include "segment_access_counter.hpp"
 #include "table_column_definition.hpp"
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
@@ -29,6 +31,14 @@ using Segments = pmr_vector<std::shared_ptr<AbstractSegment>>;
 using Indexes = pmr_vector<std::shared_ptr<AbstractIndex>>;
 using ChunkPruningStatistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>;
 
+// Describes whether a segment is currently held in memory and how often it has been evicted and loaded again (see
+// Chunk::evict_segment).
+struct SegmentResidency {
+  bool is_resident{true};
+  uint32_t eviction_count{0};
+  uint32_t load_count{0};
+};
+
 /**
  * A Chunk is a horizontal partition of a table.
  * It stores the table's data segment by segment.
@@ -55,6 +65,8 @@ class Chunk : private Noncopyable {
   Chunk(Segments segments, const std::shared_ptr<MvccData>& mvcc_data = nullptr,
         const std::optional<PolymorphicAllocator<Chunk>>& alloc = std::nullopt, Indexes indexes = {});
 
+  ~Chunk();
+
   // Returns whether new rows can be appended to this Chunk. Chunks are set immutable during finalize().
   bool is_mutable() const;
 
@@ -80,9 +92,35 @@ class Chunk : private Noncopyable {
    *       continue to use it without any inconsistencies.
    *       However, if you call get_segment again, be aware that
    *       the return type might have changed.
+   *
+   * If the segment has been evicted, it is loaded from disk first (see evict_segment).
    */
   std::shared_ptr<AbstractSegment> get_segment(ColumnID column_id) const;
 
+  /**
+   * Tiered storage: The encoded segments of an immutable chunk can be evicted to a file in the binary segment format
+   * (see BinaryWriter::write_segment). An evicted segment does not occupy memory and is transparently loaded again
+   * when get_segment() is called. Operators that still hold a pointer to the segment are not affected, the memory is
+   * freed once they release it. If the segment is still held when it is loaded, that object is used again. The access
+   * counters of the segment are preserved.
+   * @{
+   */
+  void evict_segment(ColumnID column_id, const std::string& file_name);
+
+  // Returns whether the segment can be evicted, i.e., whether it is encoded and its compressed vector (if any) is
+  // supported by the binary segment format
+  static bool is_evictable(const AbstractSegment& segment);
+
+  // Returns whether the segment is covered by one of the chunk's indexes, regardless of its position in the index.
+  // Indexes keep their segments in memory, evicting them would not free any memory.
+  bool is_indexed(ColumnID column_id) const;
+
+  // Returns nullptr for evicted segments instead of loading them
+  std::shared_ptr<AbstractSegment> get_resident_segment(ColumnID column_id) const;
+
+  SegmentResidency segment_residency(ColumnID column_id) const;
+  /** @} */
+
   bool has_mvcc_data() const;
 
   std::shared_ptr<MvccData> mvcc_data() const;
@@ -109,6 +147,7 @@ class Chunk : private Noncopyable {
                 "All segments must be part of the chunk.");
 
     auto index = std::make_shared<Index>(segments_to_index);
+    const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
     _indexes.emplace_back(index);
     return index;
   }
@@ -119,6 +158,8 @@ class Chunk : private Noncopyable {
     return create_index<Index>(segments);
   }
 
+  // Adds an index that was created on segments of this chunk
+  void add_index(const std::shared_ptr<AbstractIndex>& index);
   void remove_index(const std::shared_ptr<AbstractIndex>& index);
 
   void migrate(boost::container::pmr::memory_resource* memory_source);
@@ -128,10 +169,11 @@ class Chunk : private Noncopyable {
   const PolymorphicAllocator<Chunk>& get_allocator() const;
 
   /**
-   * To perform Chunk pruning, a Chunk can be associated with statistics.
+   * To perform Chunk pruning, a Chunk can be associated with statistics. As they might be set while the chunk is
+   * used by queries (e.g., by the ChunkMaintenancePlugin), they are swapped atomically.
    * @{
    */
-  const std::optional<ChunkPruningStatistics>& pruning_statistics() const;
+  std::shared_ptr<const ChunkPruningStatistics> pruning_statistics() const;
   void set_pruning_statistics(const std::optional<ChunkPruningStatistics>& pruning_statistics);
   /** @} */
 
@@ -183,6 +225,8 @@ class Chunk : private Noncopyable {
   /**
    * Executes tasks that are connected with finalizing a chunk. Currently, chunks are made immutable, and
    * depending on skip_mvcc_check, the MVCC max_begin_cid is set. Finalizing a chunk is the inserter's responsibility.
+   * For chunks filled by the Insert operator, the ChunkMaintenancePlugin takes over this responsibility (see
+   * MvccData::pending_inserts_count()).
    */
   void finalize();
 
@@ -190,19 +234,47 @@ class Chunk : private Noncopyable {
   std::vector<std::shared_ptr<const AbstractSegment>> _get_segments_for_ids(
       const std::vector<ColumnID>& column_ids) const;
 
+  std::shared_ptr<AbstractSegment> _load_evicted_segment(ColumnID column_id) const;
+
+  struct SegmentTieringState {
+    // Set while the segment is evicted
+    std::optional<std::string> file_name;
+    DataType data_type{};
+    SegmentAccessCounter access_counter;
+
+    // Indexes and operators might still hold the evicted segment, segments of other chunks might share its dictionary
+    // (see get_shared_dictionary). These are re-used when the segment is loaded, so that it stays the same object and
+    // keeps sharing the dictionary.
+    std::weak_ptr<AbstractSegment> evicted_segment;
+    std::weak_ptr<const void> dictionary;
+
+    uint32_t eviction_count{0};
+    uint32_t load_count{0};
+  };
+
  private:
   PolymorphicAllocator<Chunk> _alloc;
-  Segments _segments;
+  // Mutable, as get_segment() places loaded segments here (see evict_segment)
+  mutable Segments _segments;
   std::shared_ptr<MvccData> _mvcc_data;
   Indexes _indexes;
-  std::optional<ChunkPruningStatistics> _pruning_statistics;
-  bool _is_mutable = true;
+  // Indexes may be created and removed while the chunk is used by operators (e.g., by the IndexTuningPlugin)
+  mutable std::shared_mutex _indexes_mutex;
+  // Accessed via std::atomic_load/std::atomic_store (see pruning_statistics())
+  std::shared_ptr<const ChunkPruningStatistics> _pruning_statistics;
+  std::atomic_bool _is_mutable{true};
   std::vector<SortColumnDefinition> _sorted_by;
   mutable std::atomic<ChunkOffset> _invalid_row_count{0};
 
   // Default value of zero means "not set"
   std::atomic<CommitID> _cleanup_commit_id{0};
   static_assert(std::is_same<uint32_t, CommitID>::value, "Type of _cleanup_commit_id does not match type of CommitID.");
+
+  // Tiered storage. The states are empty until the first eviction. They are only accessed while holding the mutex.
+  mutable std::mutex _tiering_mutex;
+  mutable std::vector<SegmentTieringState> _tiering_states;
+  // Size of the (immutable) chunk, used by size() in case the first segment has been evicted
+  ChunkOffset _evicted_chunk_size{0};
 };
 
 }  // namespace opossum
@@ -1,6 +1,8 @@
 #include "chunk_encoder.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -10,14 +12,103 @@
 #include "statistics/generate_pruning_statistics.hpp"
 #include "storage/abstract_encoded_segment.hpp"
 #include "storage/base_segment_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Chunks that take part in shared dictionaries. Chunks that were merged into new chunks (see ChunkMerge) are not
+// encoded anymore, as they are deleted physically once no transaction uses them.
+std::vector<std::shared_ptr<Chunk>> shared_dictionary_chunks(Table& table) {
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable() || chunk->get_cleanup_commit_id()) continue;
+    chunks.emplace_back(chunk);
+  }
+  return chunks;
+}
+
+// Dictionary-encodes the column's segment of the chunk with the given sorted dictionary. If the dictionary does not
+// contain all values of the segment, the segment is left unchanged and false is returned.
+template <typename T>
+bool encode_segment_with_dictionary(Chunk& chunk, const ColumnID column_id,
+                                    const std::shared_ptr<const pmr_vector<T>>& dictionary,
+                                    const VectorCompressionType vector_compression_type) {
+  // As for the DictionaryEncoder, NULL is encoded as the size of the dictionary
+  const auto null_value_id = static_cast<uint32_t>(dictionary->size());
+
+  auto attribute_vector = pmr_vector<uint32_t>{};
+  attribute_vector.reserve(chunk.size());
+  auto contains_all_values = true;
+  segment_iterate<T>(*chunk.get_segment(column_id), [&](const auto& position) {
+    if (!contains_all_values) return;
+
+    if (position.is_null()) {
+      attribute_vector.emplace_back(null_value_id);
+      return;
+    }
+
+    const auto it = std::lower_bound(dictionary->cbegin(), dictionary->cend(), position.value());
+    if (it == dictionary->cend() || *it != position.value()) {
+      contains_all_values = false;
+      return;
+    }
+    attribute_vector.emplace_back(static_cast<uint32_t>(std::distance(dictionary->cbegin(), it)));
+  });
+
+  if (!contains_all_values) return false;
+
+  const auto compressed_attribute_vector = std::shared_ptr<const BaseCompressedVector>{
+      compress_vector(attribute_vector, vector_compression_type, PolymorphicAllocator<size_t>{}, {null_value_id})};
+  chunk.replace_segment(column_id, std::make_shared<DictionarySegment<T>>(dictionary, compressed_attribute_vector));
+  return true;
+}
+
+// Encodes the column's segments of all immutable chunks with a single dictionary of all their values. Requires the
+// table's shared dictionary mutex.
+void build_shared_dictionary(Table& table, const ColumnID column_id,
+                             const VectorCompressionType vector_compression_type) {
+  const auto chunks = shared_dictionary_chunks(table);
+
+  resolve_data_type(table.column_data_type(column_id), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // Build a sorted dictionary of all distinct values of the column
+    auto values = std::vector<ColumnDataType>{};
+    for (const auto& chunk : chunks) {
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (!position.is_null()) values.emplace_back(position.value());
+      });
+    }
+
+    auto dictionary = std::make_shared<pmr_vector<ColumnDataType>>(values.cbegin(), values.cend());
+    values = std::vector<ColumnDataType>{};
+    std::sort(dictionary->begin(), dictionary->end());
+    dictionary->erase(std::unique(dictionary->begin(), dictionary->end()), dictionary->cend());
+    dictionary->shrink_to_fit();
+
+    const auto shared_dictionary = std::shared_ptr<const pmr_vector<ColumnDataType>>{std::move(dictionary)};
+    for (const auto& chunk : chunks) {
+      [[maybe_unused]] const auto encoded =
+          encode_segment_with_dictionary(*chunk, column_id, shared_dictionary, vector_compression_type);
+      DebugAssert(encoded, "Shared dictionary does not contain all values");
+    }
+  });
+}
+
+}  // namespace
+
 namespace opossum {
 
 /**
@@ -124,6 +215,13 @@ void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std:
 
     const auto& chunk_encoding_spec = chunk_encoding_specs.at(chunk_id);
     encode_chunk(chunk, column_data_types, chunk_encoding_spec);
+    attach_to_shared_dictionaries(table, chunk_id);
+  }
+
+  // Indexes are created once the segments are not replaced by a rebuild of the shared dictionaries anymore
+  rebuild_shared_dictionaries(table);
+  for (const auto chunk_id : chunk_ids) {
+    table->create_chunk_indexes(chunk_id);
   }
 }
 
@@ -137,6 +235,13 @@ void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std:
     Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
     encode_chunk(chunk, column_data_types, segment_encoding_spec);
+    attach_to_shared_dictionaries(table, chunk_id);
+  }
+
+  // Indexes are created once the segments are not replaced by a rebuild of the shared dictionaries anymore
+  rebuild_shared_dictionaries(table);
+  for (const auto chunk_id : chunk_ids) {
+    table->create_chunk_indexes(chunk_id);
   }
 }
 
@@ -152,6 +257,13 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
 
     const auto chunk_encoding_spec = chunk_encoding_specs[chunk_id];
     encode_chunk(chunk, column_types, chunk_encoding_spec);
+    attach_to_shared_dictionaries(table, chunk_id);
+  }
+
+  // Indexes are created once the segments are not replaced by a rebuild of the shared dictionaries anymore
+  rebuild_shared_dictionaries(table);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->create_chunk_indexes(chunk_id);
   }
 }
 
@@ -167,6 +279,13 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
     Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
     encode_chunk(chunk, column_types, chunk_encoding_spec);
+    attach_to_shared_dictionaries(table, chunk_id);
+  }
+
+  // Indexes are created once the segments are not replaced by a rebuild of the shared dictionaries anymore
+  rebuild_shared_dictionaries(table);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->create_chunk_indexes(chunk_id);
   }
 }
 
@@ -180,6 +299,90 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
     Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
     encode_chunk(chunk, column_types, segment_encoding_spec);
+    attach_to_shared_dictionaries(table, chunk_id);
+  }
+
+  // Indexes are created once the segments are not replaced by a rebuild of the shared dictionaries anymore
+  rebuild_shared_dictionaries(table);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->create_chunk_indexes(chunk_id);
+  }
+}
+
+void ChunkEncoder::encode_column_with_shared_dictionary(
+    const std::shared_ptr<Table>& table, const ColumnID column_id,
+    const std::optional<VectorCompressionType> vector_compression_type) {
+  Assert(column_id < table->column_count(), "ColumnID out of range.");
+  Assert(table->type() == TableType::Data, "Only data tables can be encoded.");
+
+  const auto lock = table->acquire_shared_dictionary_mutex();
+  build_shared_dictionary(*table, column_id,
+                          vector_compression_type.value_or(VectorCompressionType::FixedSizeByteAligned));
+  table->add_shared_dictionary_column(column_id);
+}
+
+void ChunkEncoder::attach_to_shared_dictionaries(const std::shared_ptr<Table>& table, const ChunkID chunk_id) {
+  const auto shared_dictionary_column_ids = table->shared_dictionary_column_ids();
+  if (shared_dictionary_column_ids.empty()) return;
+
+  const auto chunk = table->get_chunk(chunk_id);
+  Assert(chunk && !chunk->is_mutable(), "Only immutable chunks can use a shared dictionary.");
+
+  const auto lock = table->acquire_shared_dictionary_mutex();
+  const auto chunks = shared_dictionary_chunks(*table);
+  for (const auto column_id : shared_dictionary_column_ids) {
+    resolve_data_type(table->column_data_type(column_id), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      // All other chunks use the shared dictionary (unless it awaits a rebuild), so we take it from the first one
+      auto shared_segment = std::shared_ptr<const DictionarySegment<ColumnDataType>>{};
+      for (const auto& other_chunk : chunks) {
+        if (other_chunk == chunk) continue;
+
+        shared_segment =
+            std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(other_chunk->get_segment(column_id));
+        if (shared_segment) break;
+      }
+      if (!shared_segment) return;
+
+      const auto segment =
+          std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(chunk->get_segment(column_id));
+      if (segment && segment->dictionary() == shared_segment->dictionary()) return;
+
+      // If the chunk contains values that are not part of the shared dictionary, adding them would change the ValueIDs
+      // of all other chunks. Instead of rebuilding the shared dictionary for every such chunk, the chunk keeps its own
+      // encoding until rebuild_shared_dictionaries is called.
+      const auto vector_compression_type = get_segment_encoding_spec(shared_segment).vector_compression_type;
+      encode_segment_with_dictionary(*chunk, column_id, shared_segment->dictionary(),
+                                     vector_compression_type.value_or(VectorCompressionType::FixedSizeByteAligned));
+    });
+  }
+}
+
+void ChunkEncoder::rebuild_shared_dictionaries(const std::shared_ptr<Table>& table) {
+  const auto shared_dictionary_column_ids = table->shared_dictionary_column_ids();
+  if (shared_dictionary_column_ids.empty()) return;
+
+  const auto lock = table->acquire_shared_dictionary_mutex();
+  const auto chunks = shared_dictionary_chunks(*table);
+  for (const auto column_id : shared_dictionary_column_ids) {
+    resolve_data_type(table->column_data_type(column_id), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto shared_segment = std::shared_ptr<const DictionarySegment<ColumnDataType>>{};
+      for (const auto& chunk : chunks) {
+        const auto segment =
+            std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(chunk->get_segment(column_id));
+        if (!shared_segment) shared_segment = segment;
+        if (segment && segment->dictionary() == shared_segment->dictionary()) continue;
+
+        const auto vector_compression_type =
+            shared_segment ? get_segment_encoding_spec(shared_segment).vector_compression_type : std::nullopt;
+        build_shared_dictionary(*table, column_id,
+                                vector_compression_type.value_or(VectorCompressionType::FixedSizeByteAligned));
+        return;
+      }
+    });
   }
 }
 
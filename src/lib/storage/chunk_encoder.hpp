@@ -49,7 +49,8 @@ class ChunkEncoder {
   /**
    * @brief Encodes the specified chunks of the passed table
    *
-   * The encoding is specified per segment (SegmentEncodingSpec) for each chunk.
+   * The encoding is specified per segment (SegmentEncodingSpec) for each chunk. Like the other methods that encode
+   * chunks of a table, it creates the table's indexes on the encoded chunks (see Table::create_chunk_indexes).
    */
   static void encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
                             const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs);
@@ -80,6 +81,35 @@ class ChunkEncoder {
    */
   static void encode_all_chunks(const std::shared_ptr<Table>& table,
                                 const SegmentEncodingSpec& segment_encoding_spec = {});
+
+  /**
+   * @brief Dictionary-encodes all segments of a column in immutable chunks using a single, shared dictionary
+   *
+   * The ValueIDs of segments that share a dictionary are comparable across chunks (see get_shared_dictionary). This
+   * allows, e.g., the AggregateHash operator to group by ValueIDs instead of hashing the values. Mutable chunks are
+   * not encoded. Once they are finalized and encoded, they are attached to the shared dictionary (see
+   * attach_to_shared_dictionaries). Shared dictionaries are most useful for columns with few distinct values.
+   */
+  static void encode_column_with_shared_dictionary(
+      const std::shared_ptr<Table>& table, const ColumnID column_id,
+      const std::optional<VectorCompressionType> vector_compression_type = std::nullopt);
+
+  /**
+   * @brief Encodes the segments of an immutable chunk with the shared dictionaries of their columns
+   *
+   * Used for chunks that are encoded after the shared dictionary was built. If the shared dictionary does not contain
+   * all values of the chunk's segment, the segment keeps its own dictionary and the column does not share a dictionary
+   * until rebuild_shared_dictionaries is called. Thus, a batch of chunks with new values only requires a single
+   * rebuild. The table-wide encoding methods above call this for each chunk.
+   */
+  static void attach_to_shared_dictionaries(const std::shared_ptr<Table>& table, const ChunkID chunk_id);
+
+  /**
+   * @brief Builds new shared dictionaries for the columns whose segments do not share a dictionary anymore
+   *
+   * Called by the table-wide encoding methods above and periodically by the ChunkMaintenancePlugin.
+   */
+  static void rebuild_shared_dictionaries(const std::shared_ptr<Table>& table);
 };
 
 }  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Usually, each DictionarySegment has its own dictionary, so that ValueIDs of different chunks cannot be compared.
+ * ChunkEncoder::encode_column_with_shared_dictionary encodes all segments of a column with a single, table-wide
+ * dictionary. The ValueIDs of these segments are comparable across chunks, i.e., equal ValueIDs refer to equal values
+ * and the order of the ValueIDs is the order of the values.
+ *
+ * Returns the dictionary shared by all segments of the given column or nullptr if the segments do not share a
+ * dictionary. For reference tables, the segments of all referenced tables have to share the same dictionary.
+ * Mutable chunks are not encoded yet (see ChunkEncoder::attach_to_shared_dictionaries) and are ignored. Their values
+ * are not necessarily part of the shared dictionary.
+ */
+template <typename T>
+std::shared_ptr<const pmr_vector<T>> get_shared_dictionary(const Table& table, const ColumnID column_id) {
+  auto shared_dictionary = std::shared_ptr<const pmr_vector<T>>{};
+
+  // Returns false if the segment is not dictionary-encoded or uses a different dictionary than the ones seen before
+  const auto check_dictionary = [&](const std::shared_ptr<AbstractSegment>& segment) {
+    const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment);
+    if (!dictionary_segment) return false;
+
+    if (!shared_dictionary) {
+      shared_dictionary = dictionary_segment->dictionary();
+      return true;
+    }
+    return shared_dictionary == dictionary_segment->dictionary();
+  };
+
+  // Multiple reference segments usually point to the same table. We check each referenced table only once.
+  auto checked_referenced_table = std::shared_ptr<const Table>{};
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto segment = chunk->get_segment(column_id);
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      const auto& referenced_table = reference_segment->referenced_table();
+      if (referenced_table == checked_referenced_table) continue;
+
+      const auto referenced_dictionary =
+          get_shared_dictionary<T>(*referenced_table, reference_segment->referenced_column_id());
+      if (!referenced_dictionary) return nullptr;
+      if (shared_dictionary && shared_dictionary != referenced_dictionary) return nullptr;
+
+      shared_dictionary = referenced_dictionary;
+      checked_referenced_table = referenced_table;
+      continue;
+    }
+
+    if (chunk->is_mutable()) continue;
+    if (!check_dictionary(segment)) return nullptr;
+  }
+
+  return shared_dictionary;
+}
+
+}  // namespace opossum
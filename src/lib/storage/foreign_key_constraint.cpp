@@ -0,0 +1,45 @@
+#include "foreign_key_constraint.hpp"
+
+#include <unordered_set>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ForeignKeyConstraint::ForeignKeyConstraint(const std::vector<ColumnID>& init_columns,
+                                           const std::string& init_referenced_table_name,
+                                           const std::vector<ColumnID>& init_referenced_columns)
+    : AbstractTableConstraint(std::unordered_set<ColumnID>{init_columns.begin(), init_columns.end()}),
+      _ordered_columns(init_columns),
+      _referenced_table_name(init_referenced_table_name),
+      _referenced_columns(init_referenced_columns) {
+  Assert(!_ordered_columns.empty(), "Foreign key constraint requires at least one column");
+  Assert(_ordered_columns.size() == _referenced_columns.size(), "Expected one referenced column per column");
+  Assert(columns().size() == _ordered_columns.size(), "Foreign key constraint contains duplicate columns");
+}
+
+const std::vector<ColumnID>& ForeignKeyConstraint::ordered_columns() const { return _ordered_columns; }
+
+const std::string& ForeignKeyConstraint::referenced_table_name() const { return _referenced_table_name; }
+
+const std::vector<ColumnID>& ForeignKeyConstraint::referenced_columns() const { return _referenced_columns; }
+
+bool ForeignKeyConstraint::_on_equals(const AbstractTableConstraint& table_constraint) const {
+  DebugAssert(dynamic_cast<const ForeignKeyConstraint*>(&table_constraint),
+              "Different table_constraint type should have been caught by AbstractTableConstraint::operator==");
+  const auto& foreign_key_constraint = static_cast<const ForeignKeyConstraint&>(table_constraint);
+  if (referenced_table_name() != foreign_key_constraint.referenced_table_name()) return false;
+
+  // The columns are equal as a set, but may be listed in a different order
+  for (auto column_idx = size_t{0}; column_idx < _ordered_columns.size(); ++column_idx) {
+    for (auto other_column_idx = size_t{0}; other_column_idx < _ordered_columns.size(); ++other_column_idx) {
+      if (_ordered_columns[column_idx] == foreign_key_constraint.ordered_columns()[other_column_idx] &&
+          _referenced_columns[column_idx] != foreign_key_constraint.referenced_columns()[other_column_idx]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace opossum
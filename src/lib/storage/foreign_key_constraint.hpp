@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "abstract_table_constraint.hpp"
+
+namespace opossum {
+
+/**
+ * Container class to define foreign key constraints (or, more generally, inclusion dependencies) for tables: every
+ * combination of values of the constraint's columns that does not contain NULL occurs in the referenced columns of
+ * the referenced table. The referenced columns are expected to be a key of the referenced table.
+ *
+ * The i-th column references the i-th referenced column. As columns() does not preserve this order, it is also
+ * available through ordered_columns().
+ */
+class ForeignKeyConstraint final : public AbstractTableConstraint {
+ public:
+  ForeignKeyConstraint(const std::vector<ColumnID>& init_columns, const std::string& init_referenced_table_name,
+                       const std::vector<ColumnID>& init_referenced_columns);
+
+  const std::vector<ColumnID>& ordered_columns() const;
+  const std::string& referenced_table_name() const;
+  const std::vector<ColumnID>& referenced_columns() const;
+
+ protected:
+  bool _on_equals(const AbstractTableConstraint& table_constraint) const override;
+
+ private:
+  std::vector<ColumnID> _ordered_columns;
+  std::string _referenced_table_name;
+  std::vector<ColumnID> _referenced_columns;
+};
+
+using ForeignKeyConstraints = std::vector<ForeignKeyConstraint>;
+
+}  // namespace opossum
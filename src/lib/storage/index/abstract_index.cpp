@@ -1,5 +1,6 @@
 #include "abstract_index.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -7,6 +8,7 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/trigram/trigram_index.hpp"
 
 namespace opossum {
 
@@ -21,6 +23,11 @@ size_t AbstractIndex::estimate_memory_consumption(SegmentIndexType type, ChunkOf
       return AdaptiveRadixTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
     case SegmentIndexType::BTree:
       return BTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
+    case SegmentIndexType::Trigram:
+      return TrigramIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
+    case SegmentIndexType::TableHash:
+    case SegmentIndexType::TableART:
+      Fail("Table-wide indexes are not segment indexes.");
     case SegmentIndexType::Invalid:
       Fail("SegmentIndexType is invalid.");
   }
@@ -40,6 +47,11 @@ bool AbstractIndex::is_index_for(const std::vector<std::shared_ptr<const Abstrac
   return true;
 }
 
+bool AbstractIndex::is_index_for_segment(const std::shared_ptr<const AbstractSegment>& segment) const {
+  const auto indexed_segments = _get_indexed_segments();
+  return std::find(indexed_segments.cbegin(), indexed_segments.cend(), segment) != indexed_segments.cend();
+}
+
 AbstractIndex::Iterator AbstractIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
   DebugAssert(
       (_get_indexed_segments().size() >= values.size()),
@@ -76,6 +76,9 @@ class AbstractIndex : private Noncopyable {
    */
   bool is_index_for(const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const;
 
+  // Returns true if the given segment is one of the indexed segments, regardless of its position
+  bool is_index_for_segment(const std::shared_ptr<const AbstractSegment>& segment) const;
+
   /**
    * Searches for the first entry within the chunk that is equal or greater than the given values.
    * The number of given values has to be less or equal to the number of indexed segments. Additionally,
@@ -0,0 +1,227 @@
+#include "abstract_table_index.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractTableIndex::AbstractTableIndex(const SegmentIndexType type, const std::vector<ColumnID>& column_ids,
+                                       const std::vector<DataType>& data_types,
+                                       const std::vector<ColumnID>& included_column_ids)
+    : _type{type}, _column_ids{column_ids}, _data_types{data_types}, _included_column_ids{included_column_ids} {
+  Assert(!_column_ids.empty(), "Table-wide indexes require at least one column");
+  Assert(_column_ids.size() == _data_types.size(), "Expected one data type per indexed column");
+  Assert(std::none_of(_included_column_ids.begin(), _included_column_ids.end(),
+                      [&](const auto column_id) {
+                        return std::find(_column_ids.begin(), _column_ids.end(), column_id) != _column_ids.end();
+                      }),
+         "Indexed columns cannot be included columns");
+}
+
+SegmentIndexType AbstractTableIndex::type() const { return _type; }
+
+const std::vector<ColumnID>& AbstractTableIndex::column_ids() const { return _column_ids; }
+
+const std::vector<ColumnID>& AbstractTableIndex::included_column_ids() const { return _included_column_ids; }
+
+std::vector<ColumnID> AbstractTableIndex::stored_column_ids() const {
+  if (_included_column_ids.empty()) return {};
+
+  auto stored_column_ids = _column_ids;
+  stored_column_ids.insert(stored_column_ids.end(), _included_column_ids.begin(), _included_column_ids.end());
+  return stored_column_ids;
+}
+
+std::vector<std::vector<AllTypeVariant>> AbstractTableIndex::stored_values(const std::vector<RowID>& row_ids) const {
+  Assert(!_included_column_ids.empty(), "Only indexes with included columns store values");
+
+  const auto stored_column_count = _column_ids.size() + _included_column_ids.size();
+  auto values = std::vector<std::vector<AllTypeVariant>>(stored_column_count);
+  for (auto& column_values : values) {
+    column_values.reserve(row_ids.size());
+  }
+
+  const auto lock = std::shared_lock{_stored_values_mutex};
+  for (const auto& row_id : row_ids) {
+    DebugAssert(row_id.chunk_id < _stored_values.size() && _stored_values[row_id.chunk_id] &&
+                    row_id.chunk_offset < _stored_values[row_id.chunk_id]->front().size(),
+                "No values stored for row");
+    const auto& chunk_values = *_stored_values[row_id.chunk_id];
+    for (auto column_index = size_t{0}; column_index < stored_column_count; ++column_index) {
+      values[column_index].emplace_back(chunk_values[column_index][row_id.chunk_offset]);
+    }
+  }
+
+  return values;
+}
+
+void AbstractTableIndex::insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                const ChunkOffset end_offset) {
+  if (begin_offset == end_offset) return;
+
+  const auto rows = _make_rows(chunk_id, begin_offset, end_offset);
+  const auto keys = _read_keys(chunk, rows);
+  if (!_included_column_ids.empty()) _store_values(chunk, rows, keys);
+
+  for (auto row_index = size_t{0}; row_index < keys.size(); ++row_index) {
+    if (keys[row_index]) _insert(*keys[row_index], (*rows)[row_index]);
+  }
+}
+
+void AbstractTableIndex::erase(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                               const ChunkOffset end_offset) {
+  const auto rows = _make_rows(chunk_id, begin_offset, end_offset);
+  const auto keys = _read_keys(chunk, rows);
+  for (auto row_index = size_t{0}; row_index < keys.size(); ++row_index) {
+    if (keys[row_index]) _erase(*keys[row_index], (*rows)[row_index]);
+  }
+}
+
+void AbstractTableIndex::remove_chunk(const Chunk& chunk, const ChunkID chunk_id) {
+  erase(chunk, chunk_id, ChunkOffset{0}, chunk.size());
+
+  const auto lock = std::unique_lock{_stored_values_mutex};
+  if (chunk_id < _stored_values.size()) _stored_values[chunk_id].reset();
+}
+
+void AbstractTableIndex::erase_after_commit(const Chunk& chunk, const RowIDPosList& rows, const CommitID commit_id) {
+  auto single_chunk_rows = std::make_shared<RowIDPosList>(rows.begin(), rows.end());
+  single_chunk_rows->guarantee_single_chunk();
+
+  const auto keys = _read_keys(chunk, single_chunk_rows);
+
+  const auto lock = std::lock_guard<std::mutex>{_pending_erasures_mutex};
+  for (auto row_index = size_t{0}; row_index < keys.size(); ++row_index) {
+    if (keys[row_index]) _pending_erasures.emplace_back(PendingErasure{*keys[row_index], rows[row_index], commit_id});
+  }
+}
+
+void AbstractTableIndex::erase_obsolete_entries(const CommitID lowest_snapshot_commit_id) {
+  auto obsolete_erasures = std::vector<PendingErasure>{};
+  {
+    const auto lock = std::lock_guard<std::mutex>{_pending_erasures_mutex};
+
+    // A row deleted with commit id X is invisible to all transactions with a snapshot commit id of X or higher
+    const auto obsolete_begin =
+        std::partition(_pending_erasures.begin(), _pending_erasures.end(), [&](const auto& pending_erasure) {
+          return pending_erasure.commit_id > lowest_snapshot_commit_id;
+        });
+    obsolete_erasures.assign(std::make_move_iterator(obsolete_begin), std::make_move_iterator(_pending_erasures.end()));
+    _pending_erasures.erase(obsolete_begin, _pending_erasures.end());
+  }
+
+  for (const auto& pending_erasure : obsolete_erasures) {
+    _erase(pending_erasure.key, pending_erasure.row_id);
+  }
+}
+
+size_t AbstractTableIndex::pending_erasure_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_pending_erasures_mutex};
+  return _pending_erasures.size();
+}
+
+std::shared_ptr<RowIDPosList> AbstractTableIndex::_make_rows(const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                                             const ChunkOffset end_offset) {
+  auto rows = std::make_shared<RowIDPosList>();
+  rows->reserve(end_offset - begin_offset);
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    rows->emplace_back(chunk_id, chunk_offset);
+  }
+  rows->guarantee_single_chunk();
+  return rows;
+}
+
+void AbstractTableIndex::_store_values(const Chunk& chunk, const std::shared_ptr<const RowIDPosList>& rows,
+                                       const std::vector<std::optional<Key>>& keys) {
+  const auto chunk_id = rows->front().chunk_id;
+  const auto end_offset = static_cast<size_t>(rows->back().chunk_offset) + 1;
+  const auto stored_column_count = _column_ids.size() + _included_column_ids.size();
+
+  auto lock = std::shared_lock{_stored_values_mutex};
+  const auto has_capacity = [&]() {
+    return chunk_id < _stored_values.size() && _stored_values[chunk_id] &&
+           _stored_values[chunk_id]->front().size() >= end_offset;
+  };
+
+  if (!has_capacity()) {
+    lock.unlock();
+    {
+      const auto exclusive_lock = std::unique_lock{_stored_values_mutex};
+      if (_stored_values.size() <= chunk_id) _stored_values.resize(chunk_id + 1);
+      auto& chunk_values = _stored_values[chunk_id];
+      if (!chunk_values) chunk_values = std::make_unique<ChunkValues>(stored_column_count);
+
+      // Mutable chunks grow row by row, so we reserve space for further rows
+      const auto size = std::max(end_offset, size_t{chunk.size()});
+      for (auto& column_values : *chunk_values) {
+        if (column_values.size() < size) column_values.resize(std::max(size, 2 * column_values.size()));
+      }
+    }
+    lock.lock();
+  }
+
+  auto& chunk_values = *_stored_values[chunk_id];
+  for (auto row_index = size_t{0}; row_index < keys.size(); ++row_index) {
+    if (!keys[row_index]) continue;
+    const auto chunk_offset = (*rows)[row_index].chunk_offset;
+    for (auto column_index = size_t{0}; column_index < _column_ids.size(); ++column_index) {
+      chunk_values[column_index][chunk_offset] = (*keys[row_index])[column_index];
+    }
+  }
+
+  for (auto included_index = size_t{0}; included_index < _included_column_ids.size(); ++included_index) {
+    auto& column_values = chunk_values[_column_ids.size() + included_index];
+    auto row_index = size_t{0};
+    segment_iterate_filtered<ResolveDataTypeTag, EraseTypes::Always>(
+        *chunk.get_segment(_included_column_ids[included_index]), rows, [&](const auto& position) {
+          const auto chunk_offset = (*rows)[row_index].chunk_offset;
+          const auto is_indexed = static_cast<bool>(keys[row_index]);
+          ++row_index;
+          if (!is_indexed) return;
+
+          if (position.is_null()) {
+            column_values[chunk_offset] = NullValue{};
+          } else {
+            column_values[chunk_offset] = position.value();
+          }
+        });
+  }
+}
+
+std::vector<std::optional<AbstractTableIndex::Key>> AbstractTableIndex::_read_keys(
+    const Chunk& chunk, const std::shared_ptr<const RowIDPosList>& rows) const {
+  const auto row_count = rows->size();
+  auto keys = std::vector<std::optional<Key>>(row_count, Key{});
+
+  for (auto& key : keys) {
+    key->reserve(_column_ids.size());
+  }
+
+  for (const auto column_id : _column_ids) {
+    auto row_index = size_t{0};
+    // Type erasure keeps the compile time low. Index maintenance only touches the modified rows.
+    segment_iterate_filtered<ResolveDataTypeTag, EraseTypes::Always>(
+        *chunk.get_segment(column_id), rows, [&](const auto& position) {
+          auto& key = keys[row_index];
+          ++row_index;
+          if (!key) return;
+
+          if (position.is_null()) {
+            key = std::nullopt;
+            return;
+          }
+          key->emplace_back(position.value());
+        });
+  }
+
+  return keys;
+}
+
+}  // namespace opossum
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "segment_index_type.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * Base class of the table-wide indexes (TableHashIndex and TableARTIndex). Unlike the segment indexes (e.g.,
+ * GroupKeyIndex), which are created per chunk and only on immutable chunks, a table-wide index maps the values of one
+ * or more columns to the RowIDs of all rows with these values, including those in mutable chunks.
+ *
+ * Table-wide indexes are created using Table::create_table_hash_index or Table::create_table_art_index and are
+ * maintained by the operators that modify the table: Insert adds its rows during execution and removes them on
+ * rollback. As rows that were deleted are still visible to transactions with an older snapshot, Delete does not remove
+ * them right away. Instead, the removal is deferred until no active transaction can see the rows anymore (see
+ * erase_after_commit and erase_obsolete_entries). Consequently, the index may contain RowIDs of rows that are not
+ * visible to a transaction. Similar to the results of other scans, the results of a lookup have to be validated.
+ *
+ * Rows with a NULL value in any of the indexed columns are not indexed.
+ *
+ * A covering index additionally stores the values of further columns (included columns) for each indexed row, so that
+ * queries that only need the indexed and included columns can be answered from the index alone (see IndexOnlyScan).
+ * The values are kept per chunk in column-wise vectors that are indexed by the ChunkOffset. They are written before
+ * the row is added to the index, so that a lookup never yields a row without its values.
+ */
+class AbstractTableIndex : private Noncopyable {
+ public:
+  AbstractTableIndex(const SegmentIndexType type, const std::vector<ColumnID>& column_ids,
+                     const std::vector<DataType>& data_types, const std::vector<ColumnID>& included_column_ids = {});
+  virtual ~AbstractTableIndex() = default;
+
+  SegmentIndexType type() const;
+  const std::vector<ColumnID>& column_ids() const;
+  const std::vector<ColumnID>& included_column_ids() const;
+
+  // The columns whose values are stored in the index, i.e., the indexed columns followed by the included columns.
+  // Empty if the index has no included columns.
+  std::vector<ColumnID> stored_column_ids() const;
+
+  // Returns the values of the stored columns (see stored_column_ids) for the given indexed rows, one vector per column
+  std::vector<std::vector<AllTypeVariant>> stored_values(const std::vector<RowID>& row_ids) const;
+
+  // Adds/removes the rows of the given chunk in the range [begin_offset, end_offset)
+  void insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset);
+  void erase(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset);
+
+  // Removes all rows of a chunk that is physically deleted and releases the values stored for it
+  void remove_chunk(const Chunk& chunk, const ChunkID chunk_id);
+
+  // Registers rows of the given chunk that were deleted by a transaction with the given commit id. They are removed by
+  // erase_obsolete_entries once all active transactions have a snapshot that does not include them anymore.
+  void erase_after_commit(const Chunk& chunk, const RowIDPosList& rows, const CommitID commit_id);
+
+  // Removes the rows registered via erase_after_commit that were deleted at or before the given commit id, which is
+  // expected to be the lowest snapshot commit id of all active (and future) transactions.
+  void erase_obsolete_entries(const CommitID lowest_snapshot_commit_id);
+
+  // Number of indexed rows
+  virtual size_t size() const = 0;
+
+  // Number of rows that were deleted but have not been removed yet
+  size_t pending_erasure_count() const;
+
+ protected:
+  using Key = std::vector<AllTypeVariant>;
+
+  static std::shared_ptr<RowIDPosList> _make_rows(const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                                  const ChunkOffset end_offset);
+
+  // Returns the keys of the given rows, std::nullopt for rows with a NULL value in one of the indexed columns
+  std::vector<std::optional<Key>> _read_keys(const Chunk& chunk, const std::shared_ptr<const RowIDPosList>& rows) const;
+
+  // Stores the values of the indexed and included columns of the given rows (see stored_values)
+  void _store_values(const Chunk& chunk, const std::shared_ptr<const RowIDPosList>& rows,
+                     const std::vector<std::optional<Key>>& keys);
+
+  // Adds/removes a single entry. Have to be safe for concurrent calls.
+  virtual void _insert(const Key& key, const RowID row_id) = 0;
+  virtual void _erase(const Key& key, const RowID row_id) = 0;
+
+  const SegmentIndexType _type;
+  const std::vector<ColumnID> _column_ids;
+  const std::vector<DataType> _data_types;
+  const std::vector<ColumnID> _included_column_ids;
+
+ private:
+  struct PendingErasure {
+    Key key;
+    RowID row_id;
+    CommitID commit_id;
+  };
+
+  mutable std::mutex _pending_erasures_mutex;
+  std::vector<PendingErasure> _pending_erasures;
+
+  // Stored values per chunk, one vector per stored column. Growing the vectors requires an exclusive lock, writing
+  // the values of distinct rows and reading them only requires a shared lock.
+  using ChunkValues = std::vector<std::vector<AllTypeVariant>>;
+  mutable std::shared_mutex _stored_values_mutex;
+  std::vector<std::unique_ptr<ChunkValues>> _stored_values;
+};
+
+}  // namespace opossum
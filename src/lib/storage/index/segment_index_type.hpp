@@ -10,12 +10,29 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
-enum class SegmentIndexType : uint8_t { Invalid, GroupKey, CompositeGroupKey, AdaptiveRadixTree, BTree };
+// TableHash and TableART do not refer to segment indexes but to the table-wide TableHashIndex and TableARTIndex. They
+// are used to select these in the IndexScan operator and the index statistics of a table.
+enum class SegmentIndexType : uint8_t {
+  Invalid,
+  GroupKey,
+  CompositeGroupKey,
+  AdaptiveRadixTree,
+  BTree,
+  Trigram,
+  TableHash,
+  TableART
+};
+
+// Returns whether the type refers to a table-wide index (see AbstractTableIndex)
+inline bool is_table_index_type(const SegmentIndexType type) {
+  return type == SegmentIndexType::TableHash || type == SegmentIndexType::TableART;
+}
 
 class GroupKeyIndex;
 class CompositeGroupKeyIndex;
 class AdaptiveRadixTreeIndex;
 class BTreeIndex;
+class TrigramIndex;
 
 namespace detail {
 
@@ -23,7 +40,8 @@ constexpr auto segment_index_map =
     hana::make_map(hana::make_pair(hana::type_c<GroupKeyIndex>, SegmentIndexType::GroupKey),
                    hana::make_pair(hana::type_c<CompositeGroupKeyIndex>, SegmentIndexType::CompositeGroupKey),
                    hana::make_pair(hana::type_c<AdaptiveRadixTreeIndex>, SegmentIndexType::AdaptiveRadixTree),
-                   hana::make_pair(hana::type_c<BTreeIndex>, SegmentIndexType::BTree));
+                   hana::make_pair(hana::type_c<BTreeIndex>, SegmentIndexType::BTree),
+                   hana::make_pair(hana::type_c<TrigramIndex>, SegmentIndexType::Trigram));
 
 }  // namespace detail
 
@@ -0,0 +1,694 @@
+#include "concurrent_art.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Bit 0 of a node's version marks the node as obsolete, bit 1 as locked. The remaining bits count the modifications.
+constexpr auto OBSOLETE_BIT = uint64_t{0b01};
+constexpr auto LOCKED_BIT = uint64_t{0b10};
+
+}  // namespace
+
+enum class ConcurrentART::NodeType : uint8_t { Node4, Node16, Node48, Node256 };
+
+/**
+ * Readers call await_unlocked, read the node, and call validate to check that the node was not modified meanwhile.
+ * Writers call try_lock with the version they read, so that they only modify the node if they based their decision
+ * on its current state.
+ *
+ * The prefix of a node is set before the node becomes reachable and is never modified. The keys and children are
+ * modified in place, but only under the lock.
+ */
+struct ConcurrentART::Node {
+  explicit Node(const NodeType init_type) : type(init_type) {}
+
+  uint64_t await_unlocked() const {
+    auto current_version = version.load(std::memory_order_acquire);
+    while (current_version & LOCKED_BIT) {
+      std::this_thread::yield();
+      current_version = version.load(std::memory_order_acquire);
+    }
+    return current_version;
+  }
+
+  bool validate(const uint64_t expected_version) const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return version.load(std::memory_order_relaxed) == expected_version;
+  }
+
+  bool try_lock(uint64_t expected_version) {
+    return version.compare_exchange_strong(expected_version, expected_version + LOCKED_BIT, std::memory_order_acquire);
+  }
+
+  void unlock() { version.fetch_add(LOCKED_BIT, std::memory_order_release); }
+
+  // Clears the lock bit and sets the obsolete bit
+  void unlock_obsolete() { version.fetch_add(LOCKED_BIT + OBSOLETE_BIT, std::memory_order_release); }
+
+  size_t capacity() const;
+  bool is_full() const { return count.load(std::memory_order_relaxed) == capacity(); }
+
+  // Returns 0 if there is no child for the byte
+  ChildPointer find_child(const uint8_t byte) const;
+
+  // Appends the children in ascending order of their bytes
+  void collect_children(std::vector<std::pair<uint8_t, ChildPointer>>& children) const;
+
+  // Both require the node to be locked or not to be reachable yet
+  void add_child(const uint8_t byte, const ChildPointer child);
+  void replace_child(const uint8_t byte, const ChildPointer child);
+
+  std::atomic<uint64_t> version{0};
+  const NodeType type;
+  std::atomic<uint16_t> count{0};
+  uint8_t prefix_length{0};
+  std::array<uint8_t, MAX_PREFIX_LENGTH> prefix{};
+};
+
+// Node4 and Node16 keep their keys sorted
+struct ConcurrentART::Node4 : public ConcurrentART::Node {
+  Node4() : Node(NodeType::Node4) {}
+
+  std::array<uint8_t, 4> keys{};
+  std::array<std::atomic<ChildPointer>, 4> children{};
+};
+
+struct ConcurrentART::Node16 : public ConcurrentART::Node {
+  Node16() : Node(NodeType::Node16) {}
+
+  // Returns the position of the given byte among the first child_count keys, child_count if it is not found
+  size_t find_position(const uint8_t byte, const size_t child_count) const {
+#ifdef __SSE2__
+    const auto matches = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(keys.data())),
+                                        _mm_set1_epi8(static_cast<char>(byte)));
+    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches)) & ((uint32_t{1} << child_count) - 1);
+    return mask ? static_cast<size_t>(std::countr_zero(mask)) : child_count;
+#else
+    return static_cast<size_t>(std::find(keys.cbegin(), keys.cbegin() + child_count, byte) - keys.cbegin());
+#endif
+  }
+
+  // Returns the number of keys among the first child_count keys that are smaller than the given byte
+  size_t insert_position(const uint8_t byte, const size_t child_count) const {
+#ifdef __SSE2__
+    // SSE2 only compares signed bytes. Flipping the sign bit of both operands yields the unsigned comparison.
+    const auto sign_bit = _mm_set1_epi8(static_cast<char>(0x80));
+    const auto flipped_keys = _mm_xor_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(keys.data())), sign_bit);
+    const auto flipped_byte = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), sign_bit);
+    const auto smaller = _mm_cmplt_epi8(flipped_keys, flipped_byte);
+    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(smaller)) & ((uint32_t{1} << child_count) - 1);
+    return static_cast<size_t>(std::popcount(mask));
+#else
+    return static_cast<size_t>(std::lower_bound(keys.cbegin(), keys.cbegin() + child_count, byte) - keys.cbegin());
+#endif
+  }
+
+  alignas(16) std::array<uint8_t, 16> keys{};
+  std::array<std::atomic<ChildPointer>, 16> children{};
+};
+
+struct ConcurrentART::Node48 : public ConcurrentART::Node {
+  Node48() : Node(NodeType::Node48) {}
+
+  // 0 if there is no child for the byte, the position of the child in children plus one otherwise
+  std::array<uint8_t, 256> child_indexes{};
+  std::array<std::atomic<ChildPointer>, 48> children{};
+};
+
+struct ConcurrentART::Node256 : public ConcurrentART::Node {
+  Node256() : Node(NodeType::Node256) {}
+
+  std::array<std::atomic<ChildPointer>, 256> children{};
+};
+
+struct ConcurrentART::Leaf {
+  explicit Leaf(const Key& init_key) : key(init_key) {}
+
+  const Key key;
+  std::mutex mutex;
+  std::vector<RowID> row_ids;
+};
+
+size_t ConcurrentART::Node::capacity() const {
+  switch (type) {
+    case NodeType::Node4:
+      return 4;
+    case NodeType::Node16:
+      return 16;
+    case NodeType::Node48:
+      return 48;
+    case NodeType::Node256:
+      return 256;
+  }
+  Fail("Invalid node type");
+}
+
+ConcurrentART::ChildPointer ConcurrentART::Node::find_child(const uint8_t byte) const {
+  // The count is read optimistically and might be outdated, but it must not exceed the capacity
+  const auto child_count = std::min(static_cast<size_t>(count.load(std::memory_order_relaxed)), capacity());
+
+  switch (type) {
+    case NodeType::Node4: {
+      const auto& node = static_cast<const Node4&>(*this);
+      for (auto position = size_t{0}; position < child_count; ++position) {
+        if (node.keys[position] == byte) return node.children[position].load(std::memory_order_acquire);
+      }
+      return 0;
+    }
+    case NodeType::Node16: {
+      const auto& node = static_cast<const Node16&>(*this);
+      const auto position = node.find_position(byte, child_count);
+      return position < child_count ? node.children[position].load(std::memory_order_acquire) : 0;
+    }
+    case NodeType::Node48: {
+      const auto& node = static_cast<const Node48&>(*this);
+      const auto child_index = node.child_indexes[byte];
+      return child_index ? node.children[child_index - 1].load(std::memory_order_acquire) : 0;
+    }
+    case NodeType::Node256: {
+      return static_cast<const Node256&>(*this).children[byte].load(std::memory_order_acquire);
+    }
+  }
+  Fail("Invalid node type");
+}
+
+void ConcurrentART::Node::collect_children(std::vector<std::pair<uint8_t, ChildPointer>>& children) const {
+  const auto child_count = std::min(static_cast<size_t>(count.load(std::memory_order_relaxed)), capacity());
+
+  const auto collect_sorted = [&](const auto& keys, const auto& node_children) {
+    for (auto position = size_t{0}; position < child_count; ++position) {
+      children.emplace_back(keys[position], node_children[position].load(std::memory_order_acquire));
+    }
+  };
+
+  switch (type) {
+    case NodeType::Node4: {
+      const auto& node = static_cast<const Node4&>(*this);
+      collect_sorted(node.keys, node.children);
+      return;
+    }
+    case NodeType::Node16: {
+      const auto& node = static_cast<const Node16&>(*this);
+      collect_sorted(node.keys, node.children);
+      return;
+    }
+    case NodeType::Node48: {
+      const auto& node = static_cast<const Node48&>(*this);
+      for (auto byte = size_t{0}; byte < 256; ++byte) {
+        const auto child_index = node.child_indexes[byte];
+        if (!child_index) continue;
+
+        const auto child = node.children[child_index - 1].load(std::memory_order_acquire);
+        if (child) children.emplace_back(static_cast<uint8_t>(byte), child);
+      }
+      return;
+    }
+    case NodeType::Node256: {
+      const auto& node = static_cast<const Node256&>(*this);
+      for (auto byte = size_t{0}; byte < 256; ++byte) {
+        const auto child = node.children[byte].load(std::memory_order_acquire);
+        if (child) children.emplace_back(static_cast<uint8_t>(byte), child);
+      }
+      return;
+    }
+  }
+}
+
+void ConcurrentART::Node::add_child(const uint8_t byte, const ChildPointer child) {
+  const auto child_count = static_cast<size_t>(count.load(std::memory_order_relaxed));
+  DebugAssert(child_count < capacity(), "Node is full");
+
+  const auto insert_sorted = [&](auto& keys, auto& children, const size_t position) {
+    for (auto moved_position = child_count; moved_position > position; --moved_position) {
+      keys[moved_position] = keys[moved_position - 1];
+      children[moved_position].store(children[moved_position - 1].load(std::memory_order_relaxed),
+                                     std::memory_order_release);
+    }
+    keys[position] = byte;
+    children[position].store(child, std::memory_order_release);
+  };
+
+  switch (type) {
+    case NodeType::Node4: {
+      auto& node = static_cast<Node4&>(*this);
+      const auto position = static_cast<size_t>(
+          std::lower_bound(node.keys.cbegin(), node.keys.cbegin() + child_count, byte) - node.keys.cbegin());
+      insert_sorted(node.keys, node.children, position);
+      break;
+    }
+    case NodeType::Node16: {
+      auto& node = static_cast<Node16&>(*this);
+      insert_sorted(node.keys, node.children, node.insert_position(byte, child_count));
+      break;
+    }
+    case NodeType::Node48: {
+      // Children are never removed, so the first child_count slots are occupied
+      auto& node = static_cast<Node48&>(*this);
+      node.children[child_count].store(child, std::memory_order_release);
+      node.child_indexes[byte] = static_cast<uint8_t>(child_count + 1);
+      break;
+    }
+    case NodeType::Node256: {
+      static_cast<Node256&>(*this).children[byte].store(child, std::memory_order_release);
+      break;
+    }
+  }
+
+  count.store(static_cast<uint16_t>(child_count + 1), std::memory_order_release);
+}
+
+void ConcurrentART::Node::replace_child(const uint8_t byte, const ChildPointer child) {
+  const auto child_count = static_cast<size_t>(count.load(std::memory_order_relaxed));
+
+  switch (type) {
+    case NodeType::Node4: {
+      auto& node = static_cast<Node4&>(*this);
+      const auto position = static_cast<size_t>(
+          std::find(node.keys.cbegin(), node.keys.cbegin() + child_count, byte) - node.keys.cbegin());
+      DebugAssert(position < child_count, "Child to replace not found");
+      node.children[position].store(child, std::memory_order_release);
+      return;
+    }
+    case NodeType::Node16: {
+      auto& node = static_cast<Node16&>(*this);
+      const auto position = node.find_position(byte, child_count);
+      DebugAssert(position < child_count, "Child to replace not found");
+      node.children[position].store(child, std::memory_order_release);
+      return;
+    }
+    case NodeType::Node48: {
+      auto& node = static_cast<Node48&>(*this);
+      DebugAssert(node.child_indexes[byte], "Child to replace not found");
+      node.children[node.child_indexes[byte] - 1].store(child, std::memory_order_release);
+      return;
+    }
+    case NodeType::Node256: {
+      static_cast<Node256&>(*this).children[byte].store(child, std::memory_order_release);
+      return;
+    }
+  }
+}
+
+ConcurrentART::Arena::~Arena() {
+  for (auto destructor_iter = _destructors.rbegin(); destructor_iter != _destructors.rend(); ++destructor_iter) {
+    destructor_iter->second(destructor_iter->first);
+  }
+}
+
+template <typename T, typename... Args>
+T* ConcurrentART::Arena::create(Args&&... args) {
+  auto* object = new (_allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _destructors.emplace_back(object, [](void* pointer) { static_cast<T*>(pointer)->~T(); });
+  }
+  return object;
+}
+
+size_t ConcurrentART::Arena::allocated_bytes() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _allocated_bytes;
+}
+
+void* ConcurrentART::Arena::_allocate(const size_t size, const size_t alignment) {
+  DebugAssert(size <= BLOCK_SIZE && alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Object does not fit into a block");
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  auto offset = (_block_offset + alignment - 1) / alignment * alignment;
+  if (offset + size > BLOCK_SIZE) {
+    _blocks.emplace_back(new std::byte[BLOCK_SIZE]);
+    offset = 0;
+  }
+
+  _block_offset = offset + size;
+  _allocated_bytes += size;
+  return _blocks.back().get() + offset;
+}
+
+ConcurrentART::ConcurrentART() : _root{_arena.create<Node256>()} {}
+
+ConcurrentART::~ConcurrentART() = default;
+
+void ConcurrentART::insert(const Key& key, const RowID row_id) {
+  while (!_try_insert(key, row_id)) {}
+  _size.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool ConcurrentART::erase(const Key& key, const RowID row_id) {
+  const auto leaf = _find_leaf(key);
+  if (!leaf) return false;
+
+  const auto lock = std::lock_guard<std::mutex>{leaf->mutex};
+  auto& row_ids = leaf->row_ids;
+  const auto row_id_iter = std::find(row_ids.begin(), row_ids.end(), row_id);
+  if (row_id_iter == row_ids.end()) return false;
+
+  // The order of the RowIDs is irrelevant, so we can swap the erased RowID with the last one
+  *row_id_iter = row_ids.back();
+  row_ids.pop_back();
+  _size.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+std::vector<RowID> ConcurrentART::lookup(const Key& key) const {
+  const auto leaf = _find_leaf(key);
+  if (!leaf) return {};
+
+  const auto lock = std::lock_guard<std::mutex>{leaf->mutex};
+  return leaf->row_ids;
+}
+
+void ConcurrentART::range_lookup(const std::optional<Bound>& lower_bound, const std::optional<Bound>& upper_bound,
+                                 std::vector<RowID>& result) const {
+  _range_lookup(reinterpret_cast<ChildPointer>(_root), 0, lower_bound.has_value(), upper_bound.has_value(),
+                lower_bound, upper_bound, result);
+}
+
+size_t ConcurrentART::size() const { return _size.load(std::memory_order_relaxed); }
+
+size_t ConcurrentART::allocated_bytes() const { return _arena.allocated_bytes(); }
+
+bool ConcurrentART::_is_leaf(const ChildPointer child) { return child & 1; }
+
+ConcurrentART::Leaf* ConcurrentART::_as_leaf(const ChildPointer child) {
+  return reinterpret_cast<Leaf*>(child & ~ChildPointer{1});
+}
+
+ConcurrentART::Node* ConcurrentART::_as_node(const ChildPointer child) { return reinterpret_cast<Node*>(child); }
+
+bool ConcurrentART::_try_insert(const Key& key, const RowID row_id) {
+  Node* parent = nullptr;
+  auto parent_version = uint64_t{0};
+  auto parent_byte = uint8_t{0};
+
+  auto node = _root;
+  auto depth = size_t{0};
+
+  while (true) {
+    const auto version = node->await_unlocked();
+    if (version & OBSOLETE_BIT) return false;
+
+    const auto prefix_length = size_t{node->prefix_length};
+    for (auto prefix_index = size_t{0}; prefix_index < prefix_length; ++prefix_index) {
+      Assert(depth + prefix_index < key.size(), "Keys must not be prefixes of other keys");
+      if (node->prefix[prefix_index] == key[depth + prefix_index]) continue;
+
+      // The key diverges within the prefix. The node is replaced by a new node with the common part of the prefix,
+      // whose children are the new key and a copy of the node without the common part. The root has no prefix, so
+      // there always is a parent.
+      if (!parent->try_lock(parent_version)) return false;
+      if (!node->try_lock(version)) {
+        parent->unlock();
+        return false;
+      }
+
+      auto split_node = _arena.create<Node4>();
+      split_node->prefix_length = static_cast<uint8_t>(prefix_index);
+      std::copy_n(node->prefix.cbegin(), prefix_index, split_node->prefix.begin());
+      split_node->add_child(node->prefix[prefix_index],
+                            reinterpret_cast<ChildPointer>(_copy_with_shortened_prefix(*node, prefix_index + 1)));
+      split_node->add_child(key[depth + prefix_index], _create_leaf(key, row_id));
+
+      parent->replace_child(parent_byte, reinterpret_cast<ChildPointer>(split_node));
+      node->unlock_obsolete();
+      parent->unlock();
+      return true;
+    }
+
+    depth += prefix_length;
+    Assert(depth < key.size(), "Keys must not be prefixes of other keys");
+    const auto byte = key[depth];
+    const auto child = node->find_child(byte);
+    if (!node->validate(version)) return false;
+
+    if (!child) {
+      if (!node->is_full()) {
+        if (!node->try_lock(version)) return false;
+        node->add_child(byte, _create_leaf(key, row_id));
+        node->unlock();
+        return true;
+      }
+
+      // The root is a Node256, which is never full, so there always is a parent
+      if (!parent->try_lock(parent_version)) return false;
+      if (!node->try_lock(version)) {
+        parent->unlock();
+        return false;
+      }
+
+      const auto grown_node = _grow(*node);
+      grown_node->add_child(byte, _create_leaf(key, row_id));
+
+      parent->replace_child(parent_byte, reinterpret_cast<ChildPointer>(grown_node));
+      node->unlock_obsolete();
+      parent->unlock();
+      return true;
+    }
+
+    if (_is_leaf(child)) {
+      auto& leaf = *_as_leaf(child);
+      if (leaf.key == key) {
+        // Leaves are never replaced, so the leaf does not have to be reachable via this node anymore
+        const auto lock = std::lock_guard<std::mutex>{leaf.mutex};
+        leaf.row_ids.emplace_back(row_id);
+        return true;
+      }
+
+      // Lazy expansion: The leaf is replaced by nodes that distinguish it from the new key
+      auto common_length = size_t{0};
+      while (true) {
+        const auto position = depth + 1 + common_length;
+        Assert(position < key.size() && position < leaf.key.size(), "Keys must not be prefixes of other keys");
+        if (key[position] != leaf.key[position]) break;
+        ++common_length;
+      }
+
+      if (!node->try_lock(version)) return false;
+      const auto split_node = _create_split_nodes(key, depth + 1, common_length, child,
+                                                  leaf.key[depth + 1 + common_length], _create_leaf(key, row_id));
+      node->replace_child(byte, split_node);
+      node->unlock();
+      return true;
+    }
+
+    parent = node;
+    parent_version = version;
+    parent_byte = byte;
+    node = _as_node(child);
+    depth += 1;
+  }
+}
+
+ConcurrentART::Leaf* ConcurrentART::_find_leaf(const Key& key) const {
+  const Node* node = _root;
+  auto depth = size_t{0};
+
+  while (true) {
+    const auto prefix_length = size_t{node->prefix_length};
+    if (depth + prefix_length >= key.size()) return nullptr;
+    if (!std::equal(node->prefix.cbegin(), node->prefix.cbegin() + prefix_length, key.cbegin() + depth)) {
+      return nullptr;
+    }
+    depth += prefix_length;
+
+    // Obsolete nodes are not modified anymore and still contain all keys that were inserted before they became
+    // obsolete. Thus, they do not require a restart from the root.
+    auto child = ChildPointer{0};
+    while (true) {
+      const auto version = node->await_unlocked();
+      child = node->find_child(key[depth]);
+      if (node->validate(version)) break;
+    }
+
+    if (!child) return nullptr;
+    if (_is_leaf(child)) {
+      const auto leaf = _as_leaf(child);
+      return leaf->key == key ? leaf : nullptr;
+    }
+
+    node = _as_node(child);
+    depth += 1;
+  }
+}
+
+void ConcurrentART::_range_lookup(const ChildPointer child, const size_t depth, bool lower_edge, bool upper_edge,
+                                  const std::optional<Bound>& lower_bound, const std::optional<Bound>& upper_bound,
+                                  std::vector<RowID>& result) const {
+  if (_is_leaf(child)) {
+    auto& leaf = *_as_leaf(child);
+    if (lower_bound && (leaf.key < lower_bound->key || (!lower_bound->inclusive && leaf.key == lower_bound->key))) {
+      return;
+    }
+    if (upper_bound && (upper_bound->key < leaf.key || (!upper_bound->inclusive && leaf.key == upper_bound->key))) {
+      return;
+    }
+
+    const auto lock = std::lock_guard<std::mutex>{leaf.mutex};
+    result.insert(result.end(), leaf.row_ids.cbegin(), leaf.row_ids.cend());
+    return;
+  }
+
+  // Returns false if all keys with the given byte at the given position are outside of the bounds. Otherwise, updates
+  // whether the path still equals the prefix of the bounds.
+  const auto within_bounds = [&](const uint8_t byte, const size_t position, bool& on_lower_edge, bool& on_upper_edge) {
+    if (on_lower_edge) {
+      if (position >= lower_bound->key.size() || byte > lower_bound->key[position]) {
+        on_lower_edge = false;
+      } else if (byte < lower_bound->key[position]) {
+        return false;
+      }
+    }
+    if (on_upper_edge) {
+      if (position >= upper_bound->key.size() || byte > upper_bound->key[position]) return false;
+      if (byte < upper_bound->key[position]) on_upper_edge = false;
+    }
+    return true;
+  };
+
+  const auto& node = *_as_node(child);
+  const auto prefix_length = size_t{node.prefix_length};
+  for (auto prefix_index = size_t{0}; prefix_index < prefix_length; ++prefix_index) {
+    if (!within_bounds(node.prefix[prefix_index], depth + prefix_index, lower_edge, upper_edge)) return;
+  }
+  const auto child_depth = depth + prefix_length;
+
+  // As in _find_leaf, a consistent state of the node is sufficient
+  auto children = std::vector<std::pair<uint8_t, ChildPointer>>{};
+  while (true) {
+    const auto version = node.await_unlocked();
+    children.clear();
+    node.collect_children(children);
+    if (node.validate(version)) break;
+  }
+
+  for (const auto& [byte, grandchild] : children) {
+    auto child_lower_edge = lower_edge;
+    auto child_upper_edge = upper_edge;
+    if (!within_bounds(byte, child_depth, child_lower_edge, child_upper_edge)) {
+      // The children are sorted. Once a child is above the upper bound, so are all following ones.
+      if (upper_edge && (child_depth >= upper_bound->key.size() || byte > upper_bound->key[child_depth])) break;
+      continue;
+    }
+
+    _range_lookup(grandchild, child_depth + 1, child_lower_edge, child_upper_edge, lower_bound, upper_bound, result);
+  }
+}
+
+ConcurrentART::ChildPointer ConcurrentART::_create_split_nodes(const Key& key, const size_t depth,
+                                                               const size_t common_length,
+                                                               const ChildPointer existing_child,
+                                                               const uint8_t existing_byte,
+                                                               const ChildPointer new_child) {
+  auto first_node = ChildPointer{0};
+  Node4* previous_node = nullptr;
+  auto previous_byte = uint8_t{0};
+
+  const auto link = [&](Node4* node) {
+    if (previous_node) {
+      previous_node->add_child(previous_byte, reinterpret_cast<ChildPointer>(node));
+    } else {
+      first_node = reinterpret_cast<ChildPointer>(node);
+    }
+  };
+
+  // Common prefixes that do not fit into one node are split across a chain of nodes with a single child each
+  auto position = depth;
+  auto remaining_length = common_length;
+  while (remaining_length > MAX_PREFIX_LENGTH) {
+    auto node = _arena.create<Node4>();
+    node->prefix_length = static_cast<uint8_t>(MAX_PREFIX_LENGTH);
+    std::copy_n(key.cbegin() + position, MAX_PREFIX_LENGTH, node->prefix.begin());
+    link(node);
+
+    previous_node = node;
+    previous_byte = key[position + MAX_PREFIX_LENGTH];
+    position += MAX_PREFIX_LENGTH + 1;
+    remaining_length -= MAX_PREFIX_LENGTH + 1;
+  }
+
+  auto node = _arena.create<Node4>();
+  node->prefix_length = static_cast<uint8_t>(remaining_length);
+  std::copy_n(key.cbegin() + position, remaining_length, node->prefix.begin());
+  node->add_child(existing_byte, existing_child);
+  node->add_child(key[position + remaining_length], new_child);
+  link(node);
+
+  return first_node;
+}
+
+ConcurrentART::Node* ConcurrentART::_grow(const Node& node) {
+  auto grown_node = static_cast<Node*>(nullptr);
+  switch (node.type) {
+    case NodeType::Node4:
+      grown_node = _arena.create<Node16>();
+      break;
+    case NodeType::Node16:
+      grown_node = _arena.create<Node48>();
+      break;
+    case NodeType::Node48:
+      grown_node = _arena.create<Node256>();
+      break;
+    case NodeType::Node256:
+      Fail("Node256 cannot grow");
+  }
+
+  grown_node->prefix_length = node.prefix_length;
+  grown_node->prefix = node.prefix;
+  _copy_children(node, *grown_node);
+  return grown_node;
+}
+
+ConcurrentART::Node* ConcurrentART::_copy_with_shortened_prefix(const Node& node, const size_t prefix_offset) {
+  auto copied_node = static_cast<Node*>(nullptr);
+  switch (node.type) {
+    case NodeType::Node4:
+      copied_node = _arena.create<Node4>();
+      break;
+    case NodeType::Node16:
+      copied_node = _arena.create<Node16>();
+      break;
+    case NodeType::Node48:
+      copied_node = _arena.create<Node48>();
+      break;
+    case NodeType::Node256:
+      copied_node = _arena.create<Node256>();
+      break;
+  }
+
+  copied_node->prefix_length = static_cast<uint8_t>(node.prefix_length - prefix_offset);
+  std::copy(node.prefix.cbegin() + prefix_offset, node.prefix.cbegin() + node.prefix_length,
+            copied_node->prefix.begin());
+  _copy_children(node, *copied_node);
+  return copied_node;
+}
+
+void ConcurrentART::_copy_children(const Node& source_node, Node& target_node) {
+  // The source node is locked by the caller
+  auto children = std::vector<std::pair<uint8_t, ChildPointer>>{};
+  source_node.collect_children(children);
+  for (const auto& [byte, child] : children) {
+    target_node.add_child(byte, child);
+  }
+}
+
+ConcurrentART::ChildPointer ConcurrentART::_create_leaf(const Key& key, const RowID row_id) {
+  auto leaf = _arena.create<Leaf>(key);
+  leaf->row_ids.emplace_back(row_id);
+  return reinterpret_cast<ChildPointer>(leaf) | 1;
+}
+
+}  // namespace opossum
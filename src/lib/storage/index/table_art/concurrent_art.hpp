@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * An Adaptive Radix Tree that maps binary-comparable keys to RowIDs and supports concurrent inserts, erasures, and
+ * lookups. Unlike the AdaptiveRadixTreeIndex, which is bulk-loaded once from an immutable dictionary segment and
+ * cannot be modified afterwards, it can be built incrementally. It is the data structure behind the TableARTIndex.
+ *
+ * Keys are compared byte-wise. Thus, the byte sequence of a key has to preserve the order of the values it
+ * represents (see TableARTIndex for the encoding of the column values). Furthermore, no key may be a prefix of
+ * another key. This holds for fixed-size keys and can be achieved for variable-size keys by a terminator.
+ *
+ * The design follows the ART paper (https://db.in.tum.de/~leis/papers/ART.pdf) and its synchronization via optimistic
+ * lock coupling (https://db.in.tum.de/~leis/papers/artsync.pdf):
+ *  - Inner nodes hold 4, 16, 48, or 256 children and a prefix of up to MAX_PREFIX_LENGTH bytes that all keys below
+ *    the node share (path compression). Longer common prefixes are split across multiple nodes. A subtree with a
+ *    single key is represented by its leaf (lazy expansion). Leaves store the full key and the RowIDs of the key.
+ *  - In Node16, the key byte is compared with all 16 keys at once using SSE2 if available.
+ *  - Each inner node has a version counter that doubles as a write lock. Readers do not acquire locks. Instead, they
+ *    read the version before and after reading a node and retry if it changed. Writers lock only the nodes they
+ *    modify. Nodes are never modified in a way that breaks concurrent readers: When a node grows or its prefix has to
+ *    be split, a new node is created and the old one is marked as obsolete. As an obsolete node is not modified
+ *    anymore, readers that still reach it see all keys that were in the tree before it became obsolete.
+ *  - Nodes are allocated from an arena owned by the tree and are only freed together with the tree. This way,
+ *    obsolete nodes remain valid for concurrent readers without the need for epoch-based memory reclamation, at the
+ *    cost of the memory of the replaced nodes.
+ *
+ * Erasing a RowID does not remove the leaf or shrink any nodes, even if the key has no RowIDs anymore.
+ */
+class ConcurrentART : private Noncopyable {
+ public:
+  using Key = std::vector<uint8_t>;
+
+  struct Bound {
+    Key key;
+    bool inclusive;
+  };
+
+  // Inner nodes store up to this many bytes of their prefix
+  static constexpr auto MAX_PREFIX_LENGTH = size_t{8};
+
+  ConcurrentART();
+  ~ConcurrentART();
+
+  void insert(const Key& key, const RowID row_id);
+
+  // Returns false if the key does not have the given RowID
+  bool erase(const Key& key, const RowID row_id);
+
+  // Returns the RowIDs of the given key
+  std::vector<RowID> lookup(const Key& key) const;
+
+  // Appends the RowIDs of all keys between the given bounds to the result. std::nullopt stands for an unbounded side.
+  // Keys are visited in ascending order.
+  void range_lookup(const std::optional<Bound>& lower_bound, const std::optional<Bound>& upper_bound,
+                    std::vector<RowID>& result) const;
+
+  // Number of stored RowIDs
+  size_t size() const;
+
+  // Number of bytes allocated for nodes and leaves, including replaced nodes but excluding the RowID vectors
+  size_t allocated_bytes() const;
+
+ protected:
+  enum class NodeType : uint8_t;
+  struct Node;
+  struct Node4;
+  struct Node16;
+  struct Node48;
+  struct Node256;
+  struct Leaf;
+
+  // Child pointers are tagged: If the lowest bit is set, the child is a leaf
+  using ChildPointer = uintptr_t;
+
+  static bool _is_leaf(const ChildPointer child);
+  static Leaf* _as_leaf(const ChildPointer child);
+  static Node* _as_node(const ChildPointer child);
+
+  // Allocates objects in blocks. Objects are destroyed together with the arena.
+  class Arena : private Noncopyable {
+   public:
+    ~Arena();
+
+    template <typename T, typename... Args>
+    T* create(Args&&... args);
+
+    size_t allocated_bytes() const;
+
+   private:
+    static constexpr auto BLOCK_SIZE = size_t{64 * 1024};
+
+    void* _allocate(const size_t size, const size_t alignment);
+
+    mutable std::mutex _mutex;
+    std::vector<std::unique_ptr<std::byte[]>> _blocks;
+    size_t _block_offset{BLOCK_SIZE};
+    size_t _allocated_bytes{0};
+    std::vector<std::pair<void*, void (*)(void*)>> _destructors;
+  };
+
+  // Returns false if the insert conflicted with a concurrent modification and has to be restarted
+  bool _try_insert(const Key& key, const RowID row_id);
+
+  // Collects the RowIDs of all keys in the subtree of the given child that lie within the bounds. lower_edge and
+  // upper_edge indicate whether the path to the child equals the prefix of the respective bound so far.
+  void _range_lookup(const ChildPointer child, const size_t depth, bool lower_edge, bool upper_edge,
+                     const std::optional<Bound>& lower_bound, const std::optional<Bound>& upper_bound,
+                     std::vector<RowID>& result) const;
+
+  // Returns the leaf of the given key, nullptr if the key is not in the tree
+  Leaf* _find_leaf(const Key& key) const;
+
+  // Creates the nodes that distinguish two keys sharing common_length bytes starting at depth
+  ChildPointer _create_split_nodes(const Key& key, const size_t depth, const size_t common_length,
+                                   const ChildPointer existing_child, const uint8_t existing_byte,
+                                   const ChildPointer new_child);
+
+  // Returns a larger copy of a full node
+  Node* _grow(const Node& node);
+
+  // Returns a copy of the node without the first prefix_offset bytes of its prefix
+  Node* _copy_with_shortened_prefix(const Node& node, const size_t prefix_offset);
+
+  // Adds the children of the source node to the (larger or empty) target node
+  static void _copy_children(const Node& source_node, Node& target_node);
+
+  ChildPointer _create_leaf(const Key& key, const RowID row_id);
+
+  Arena _arena;
+  Node* _root;
+  std::atomic<size_t> _size{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,158 @@
+#include "table_art_index.hpp"
+
+#include <bit>
+#include <type_traits>
+#include <utility>
+
+#include "lossless_cast.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/lossless_predicate_cast.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename UnsignedT>
+void append_big_endian(ConcurrentART::Key& key, const UnsignedT value) {
+  for (auto shift = static_cast<int>(sizeof(UnsignedT) * 8) - 8; shift >= 0; shift -= 8) {
+    key.emplace_back(static_cast<uint8_t>(value >> shift));
+  }
+}
+
+template <typename T>
+ConcurrentART::Key encode_value(const T& value) {
+  auto key = ConcurrentART::Key{};
+
+  if constexpr (std::is_integral_v<T>) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    constexpr auto SIGN_BIT = UnsignedT{1} << (sizeof(UnsignedT) * 8 - 1);
+    append_big_endian(key, static_cast<UnsignedT>(static_cast<UnsignedT>(value) ^ SIGN_BIT));
+  } else if constexpr (std::is_floating_point_v<T>) {
+    using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = Bits{1} << (sizeof(Bits) * 8 - 1);
+
+    // -0.0 and 0.0 are equal, but differ in their sign bit
+    auto bits = std::bit_cast<Bits>(value == T{0} ? T{0} : value);
+    bits = (bits & SIGN_BIT) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | SIGN_BIT);
+    append_big_endian(key, bits);
+  } else {
+    key.reserve(value.size() + 2);
+    for (const auto character : value) {
+      key.emplace_back(static_cast<uint8_t>(character));
+      if (character == '\0') key.emplace_back(uint8_t{1});
+    }
+    key.emplace_back(uint8_t{0});
+    key.emplace_back(uint8_t{0});
+  }
+
+  return key;
+}
+
+}  // namespace
+
+TableARTIndex::TableARTIndex(const ColumnID column_id, const DataType data_type,
+                             const std::vector<ColumnID>& included_column_ids)
+    : AbstractTableIndex{SegmentIndexType::TableART, {column_id}, {data_type}, included_column_ids} {
+  Assert(data_type != DataType::Null, "Cannot index a column of type NULL");
+}
+
+std::vector<RowID> TableARTIndex::lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                         const AllTypeVariant& value2) const {
+  Assert(is_supported(predicate_condition), "Predicate condition not supported by TableARTIndex");
+
+  const auto is_between = is_between_predicate_condition(predicate_condition);
+  if (variant_is_null(value) || (is_between && variant_is_null(value2))) return {};
+
+  const auto key = _encode_search_value(value);
+  if (!key) {
+    Assert(predicate_condition == PredicateCondition::Equals, "Search value cannot be converted without loss");
+    return {};
+  }
+
+  if (predicate_condition == PredicateCondition::Equals) return _tree.lookup(*key);
+
+  using Bound = ConcurrentART::Bound;
+  auto result = std::vector<RowID>{};
+  switch (predicate_condition) {
+    case PredicateCondition::NotEquals:
+      _tree.range_lookup(std::nullopt, Bound{*key, false}, result);
+      _tree.range_lookup(Bound{*key, false}, std::nullopt, result);
+      break;
+    case PredicateCondition::LessThan:
+      _tree.range_lookup(std::nullopt, Bound{*key, false}, result);
+      break;
+    case PredicateCondition::LessThanEquals:
+      _tree.range_lookup(std::nullopt, Bound{*key, true}, result);
+      break;
+    case PredicateCondition::GreaterThan:
+      _tree.range_lookup(Bound{*key, false}, std::nullopt, result);
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      _tree.range_lookup(Bound{*key, true}, std::nullopt, result);
+      break;
+    default: {
+      const auto key2 = _encode_search_value(value2);
+      Assert(key2, "Search value cannot be converted without loss");
+      _tree.range_lookup(Bound{*key, is_lower_inclusive_between(predicate_condition)},
+                         Bound{*key2, is_upper_inclusive_between(predicate_condition)}, result);
+    }
+  }
+
+  return result;
+}
+
+size_t TableARTIndex::size() const { return _tree.size(); }
+
+size_t TableARTIndex::allocated_bytes() const { return _tree.allocated_bytes(); }
+
+bool TableARTIndex::is_supported(const PredicateCondition predicate_condition) {
+  return is_binary_numeric_predicate_condition(predicate_condition) ||
+         is_between_predicate_condition(predicate_condition);
+}
+
+std::optional<TableARTIndex::SearchPredicate> TableARTIndex::cast_search_predicate(
+    const PredicateCondition predicate_condition, const AllTypeVariant& value, const AllTypeVariant& value2,
+    const DataType data_type) {
+  const auto cast_value = [&](const PredicateCondition condition, const AllTypeVariant& search_value)
+      -> std::optional<std::pair<PredicateCondition, AllTypeVariant>> {
+    if (variant_is_null(search_value)) return std::pair{condition, search_value};
+    return lossless_predicate_variant_cast(condition, search_value, data_type);
+  };
+
+  if (!is_between_predicate_condition(predicate_condition)) {
+    const auto cast_predicate = cast_value(predicate_condition, value);
+    if (!cast_predicate) return std::nullopt;
+    return SearchPredicate{cast_predicate->first, cast_predicate->second, value2};
+  }
+
+  const auto [lower_condition, upper_condition] = between_to_conditions(predicate_condition);
+  const auto cast_lower_predicate = cast_value(lower_condition, value);
+  const auto cast_upper_predicate = cast_value(upper_condition, value2);
+  if (!cast_lower_predicate || !cast_upper_predicate) return std::nullopt;
+  return SearchPredicate{conditions_to_between(cast_lower_predicate->first, cast_upper_predicate->first),
+                         cast_lower_predicate->second, cast_upper_predicate->second};
+}
+
+ConcurrentART::Key TableARTIndex::encode(const AllTypeVariant& value) {
+  Assert(!variant_is_null(value), "NULL values cannot be encoded");
+
+  auto key = ConcurrentART::Key{};
+  resolve_data_type(data_type_from_all_type_variant(value), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    key = encode_value(boost::get<ColumnDataType>(value));
+  });
+  return key;
+}
+
+void TableARTIndex::_insert(const Key& key, const RowID row_id) { _tree.insert(encode(key.front()), row_id); }
+
+void TableARTIndex::_erase(const Key& key, const RowID row_id) { _tree.erase(encode(key.front()), row_id); }
+
+std::optional<ConcurrentART::Key> TableARTIndex::_encode_search_value(const AllTypeVariant& value) const {
+  const auto converted_value = lossless_variant_cast(value, _data_types.front());
+  if (!converted_value) return std::nullopt;
+  return encode(*converted_value);
+}
+
+}  // namespace opossum
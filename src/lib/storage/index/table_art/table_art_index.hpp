@@ -0,0 +1,77 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "concurrent_art.hpp"
+#include "storage/index/abstract_table_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A table-wide ordered index (see AbstractTableIndex) on a single column. While the TableHashIndex only answers
+ * equality predicates, the TableARTIndex also answers range predicates (e.g., a < 5 or a BETWEEN 3 AND 7). As it
+ * covers mutable chunks and is kept up to date by Insert, ranges on recently inserted rows are not scanned either.
+ *
+ * The entries are stored in a ConcurrentART, which allows for concurrent inserts and lookups without a global lock.
+ * The values are encoded as binary-comparable keys, i.e., byte sequences whose lexicographical order is the order of
+ * the values:
+ *  - Integers are stored big-endian with the sign bit flipped, so that negative values come first.
+ *  - Floating-point numbers are stored big-endian with the sign bit flipped for positive numbers and all bits flipped
+ *    for negative numbers. -0.0 is stored as 0.0. NaNs are not supported.
+ *  - Strings are stored byte-wise and terminated by 0x00 0x00. A 0x00 within the string is stored as 0x00 0x01, so
+ *    that no key is a prefix of another one.
+ */
+class TableARTIndex : public AbstractTableIndex {
+ public:
+  TableARTIndex(const ColumnID column_id, const DataType data_type,
+                const std::vector<ColumnID>& included_column_ids = {});
+
+  // A predicate whose search values have the data type of the indexed column, see cast_search_predicate
+  struct SearchPredicate {
+    PredicateCondition predicate_condition;
+    AllTypeVariant value;
+    AllTypeVariant value2;
+  };
+
+  // Returns the RowIDs of all indexed rows whose value satisfies the predicate. value2 is the upper bound of between
+  // predicates. Predicates other than the comparison and between predicates are not supported. If the search value is
+  // NULL, no rows are returned. Search values of a different data type are converted to the data type of the column.
+  // For equality predicates, a value that cannot be converted without loss (e.g., 1.5 for an integer column) yields
+  // no rows. For other predicates, this is not supported - use cast_search_predicate first.
+  std::vector<RowID> lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                            const AllTypeVariant& value2 = NullValue{}) const;
+
+  size_t size() const final;
+
+  // Number of bytes allocated for the nodes of the tree, see ConcurrentART::allocated_bytes
+  size_t allocated_bytes() const;
+
+  // Comparison predicates (=, <>, <, <=, >, >=) and between predicates are supported
+  static bool is_supported(const PredicateCondition predicate_condition);
+
+  // Casts the search values of a predicate to the data type of the indexed column, adjusting the predicate condition
+  // where necessary (see lossless_predicate_cast.hpp). For example, `a < 3.1` on a float column becomes
+  // `a <= 3.0999999f`. Returns std::nullopt if the predicate cannot be expressed on values of that data type (e.g.,
+  // `a < 3.5` on an integer column), in which case the index cannot answer it. NULL values are kept.
+  static std::optional<SearchPredicate> cast_search_predicate(const PredicateCondition predicate_condition,
+                                                              const AllTypeVariant& value,
+                                                              const AllTypeVariant& value2, const DataType data_type);
+
+  // Returns the binary-comparable key of a value that is not NULL
+  static ConcurrentART::Key encode(const AllTypeVariant& value);
+
+ protected:
+  void _insert(const Key& key, const RowID row_id) final;
+  void _erase(const Key& key, const RowID row_id) final;
+
+ private:
+  // Returns std::nullopt if the value cannot be converted to the data type of the column without loss
+  std::optional<ConcurrentART::Key> _encode_search_value(const AllTypeVariant& value) const;
+
+  ConcurrentART _tree;
+};
+
+}  // namespace opossum
@@ -0,0 +1,114 @@
+#include "table_hash_index.hpp"
+
+#include <algorithm>
+#include <optional>
+
+#include <boost/functional/hash.hpp>
+
+#include "lossless_cast.hpp"
+#include "storage/chunk.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableHashIndex::TableHashIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types,
+                               const std::vector<ColumnID>& included_column_ids)
+    : AbstractTableIndex{SegmentIndexType::TableHash, column_ids, data_types, included_column_ids} {}
+
+std::vector<RowID> TableHashIndex::lookup(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == _column_ids.size(), "Expected one value per indexed column");
+
+  auto key = Key{};
+  key.reserve(values.size());
+  for (auto value_index = size_t{0}; value_index < values.size(); ++value_index) {
+    if (variant_is_null(values[value_index])) return {};
+
+    const auto value = lossless_variant_cast(values[value_index], _data_types[value_index]);
+    if (!value) return {};
+    key.emplace_back(*value);
+  }
+
+  const auto& shard = _shard(key);
+  const auto lock = std::shared_lock<std::shared_mutex>{shard.mutex};
+
+  const auto entry_iter = shard.entries.find(key);
+  if (entry_iter == shard.entries.end()) return {};
+  return entry_iter->second;
+}
+
+std::vector<std::vector<RowID>> TableHashIndex::lookup(const Chunk& chunk, const ChunkID chunk_id,
+                                                       const ChunkOffset begin_offset,
+                                                       const ChunkOffset end_offset) const {
+  const auto keys = _read_keys(chunk, _make_rows(chunk_id, begin_offset, end_offset));
+  auto results = std::vector<std::vector<RowID>>(keys.size());
+
+  auto row_indexes_by_shard = std::array<std::vector<size_t>, SHARD_COUNT>{};
+  for (auto row_index = size_t{0}; row_index < keys.size(); ++row_index) {
+    if (!keys[row_index]) continue;
+    row_indexes_by_shard[KeyHash{}(*keys[row_index]) % SHARD_COUNT].emplace_back(row_index);
+  }
+
+  for (auto shard_index = size_t{0}; shard_index < SHARD_COUNT; ++shard_index) {
+    const auto& row_indexes = row_indexes_by_shard[shard_index];
+    if (row_indexes.empty()) continue;
+
+    const auto& shard = _shards[shard_index];
+    const auto lock = std::shared_lock<std::shared_mutex>{shard.mutex};
+    for (const auto row_index : row_indexes) {
+      const auto entry_iter = shard.entries.find(*keys[row_index]);
+      if (entry_iter != shard.entries.end()) results[row_index] = entry_iter->second;
+    }
+  }
+
+  return results;
+}
+
+size_t TableHashIndex::size() const {
+  auto size = size_t{0};
+  for (const auto& shard : _shards) {
+    const auto lock = std::shared_lock<std::shared_mutex>{shard.mutex};
+    for (const auto& [key, row_ids] : shard.entries) {
+      size += row_ids.size();
+    }
+  }
+  return size;
+}
+
+size_t TableHashIndex::KeyHash::operator()(const Key& key) const {
+  auto hash = size_t{0};
+  for (const auto& value : key) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+TableHashIndex::Shard& TableHashIndex::_shard(const Key& key) { return _shards[KeyHash{}(key) % SHARD_COUNT]; }
+
+const TableHashIndex::Shard& TableHashIndex::_shard(const Key& key) const {
+  return _shards[KeyHash{}(key) % SHARD_COUNT];
+}
+
+void TableHashIndex::_insert(const Key& key, const RowID row_id) {
+  auto& shard = _shard(key);
+  const auto lock = std::unique_lock<std::shared_mutex>{shard.mutex};
+  shard.entries[key].emplace_back(row_id);
+}
+
+void TableHashIndex::_erase(const Key& key, const RowID row_id) {
+  auto& shard = _shard(key);
+  const auto lock = std::unique_lock<std::shared_mutex>{shard.mutex};
+
+  const auto entry_iter = shard.entries.find(key);
+  if (entry_iter == shard.entries.end()) return;
+
+  auto& row_ids = entry_iter->second;
+  const auto row_id_iter = std::find(row_ids.begin(), row_ids.end(), row_id);
+  if (row_id_iter == row_ids.end()) return;
+
+  // The order of the RowIDs is irrelevant, so we can swap the erased RowID with the last one
+  *row_id_iter = row_ids.back();
+  row_ids.pop_back();
+  if (row_ids.empty()) shard.entries.erase(entry_iter);
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/index/abstract_table_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * The segment indexes (e.g., GroupKeyIndex) are created per chunk and only on immutable chunks. A point lookup, e.g.,
+ * for a primary key, has to probe the index of every chunk and scan all mutable chunks. The TableHashIndex is a
+ * table-wide hash index (see AbstractTableIndex) on one or more columns. Thus, the cost of a lookup does not depend on
+ * the number of chunks.
+ *
+ * To allow for concurrent modifications and lookups, the entries are distributed across a fixed number of shards,
+ * each of which is protected by a reader-writer lock.
+ */
+class TableHashIndex : public AbstractTableIndex {
+ public:
+  TableHashIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types,
+                 const std::vector<ColumnID>& included_column_ids = {});
+
+  // Returns the RowIDs of all indexed rows with the given values. The values are converted to the data types of the
+  // indexed columns. If a value cannot be converted without loss (e.g., 1.5 for an integer column) or is NULL, no
+  // rows are returned.
+  std::vector<RowID> lookup(const std::vector<AllTypeVariant>& values) const;
+
+  // For each row of the given chunk in the range [begin_offset, end_offset), returns the RowIDs of all indexed rows
+  // with the same values (including the row itself if it is indexed). Rows with a NULL value in one of the indexed
+  // columns get an empty result. Compared to calling lookup for each row, the values are read column-wise and every
+  // shard is locked only once.
+  std::vector<std::vector<RowID>> lookup(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                         const ChunkOffset end_offset) const;
+
+  size_t size() const final;
+
+ protected:
+  void _insert(const Key& key, const RowID row_id) final;
+  void _erase(const Key& key, const RowID row_id) final;
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<Key, std::vector<RowID>, KeyHash> entries;
+  };
+
+  static constexpr auto SHARD_COUNT = size_t{64};
+
+  Shard& _shard(const Key& key);
+  const Shard& _shard(const Key& key) const;
+
+  std::array<Shard, SHARD_COUNT> _shards;
+};
+
+}  // namespace opossum
@@ -0,0 +1,152 @@
+#include "trigram_index.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "expression/evaluation/like_matcher.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/index/segment_index_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+size_t TrigramIndex::estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count,
+                                                 uint32_t value_bytes) {
+  // A value of n bytes has up to n - 2 distinct trigrams. There are at most 2^24 different trigrams.
+  const auto trigrams_per_value = size_t{std::max(value_bytes, uint32_t{2}) - 2};
+  const auto distinct_trigrams = std::min(size_t{distinct_count} * trigrams_per_value, size_t{1} << 24);
+  return row_count * trigrams_per_value * sizeof(ChunkOffset) +
+         distinct_trigrams * (sizeof(Trigram) + sizeof(size_t));
+}
+
+bool TrigramIndex::is_pattern_supported(const pmr_string& pattern) { return !_trigrams_of_pattern(pattern).empty(); }
+
+TrigramIndex::TrigramIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : AbstractIndex{get_index_type_of<TrigramIndex>()},
+      // Empty segment list is illegal but range check needed for accessing the first segment
+      _indexed_segment(segments_to_index.empty() ? nullptr : segments_to_index[0]) {
+  Assert(static_cast<bool>(_indexed_segment), "TrigramIndex requires segments_to_index not to be empty.");
+  Assert((segments_to_index.size() == 1), "TrigramIndex only works with a single segment.");
+  Assert(_indexed_segment->data_type() == DataType::String, "TrigramIndex only works with string segments.");
+
+  // 1) Collect the trigrams of all non-NULL values together with their positions
+  auto entries = std::vector<std::pair<Trigram, ChunkOffset>>{};
+  segment_iterate<pmr_string>(*_indexed_segment, [&](const auto& position) {
+    if (position.is_null()) {
+      _null_positions.emplace_back(position.chunk_offset());
+      return;
+    }
+
+    for (const auto trigram : _trigrams_of(position.value())) {
+      entries.emplace_back(trigram, position.chunk_offset());
+    }
+  });
+  _null_positions.shrink_to_fit();
+
+  // 2) Group the positions by trigram. Within a group, the positions are sorted.
+  std::sort(entries.begin(), entries.end());
+
+  // 3) Store the distinct trigrams and the start offsets of their positions
+  _positions.reserve(entries.size());
+  for (const auto& [trigram, chunk_offset] : entries) {
+    if (_trigrams.empty() || _trigrams.back() != trigram) {
+      _trigrams.emplace_back(trigram);
+      _trigram_start_offsets.emplace_back(_positions.size());
+    }
+    _positions.emplace_back(chunk_offset);
+  }
+  _trigram_start_offsets.emplace_back(_positions.size());
+}
+
+std::optional<std::vector<ChunkOffset>> TrigramIndex::candidates(const pmr_string& pattern) const {
+  const auto pattern_trigrams = _trigrams_of_pattern(pattern);
+  if (pattern_trigrams.empty()) return std::nullopt;
+
+  // Look up the positions of each trigram. If a trigram does not occur in the segment, no value matches.
+  auto position_ranges = std::vector<std::pair<Iterator, Iterator>>{};
+  position_ranges.reserve(pattern_trigrams.size());
+  for (const auto trigram : pattern_trigrams) {
+    const auto trigram_iter = std::lower_bound(_trigrams.cbegin(), _trigrams.cend(), trigram);
+    if (trigram_iter == _trigrams.cend() || *trigram_iter != trigram) return std::vector<ChunkOffset>{};
+
+    const auto trigram_id = std::distance(_trigrams.cbegin(), trigram_iter);
+    position_ranges.emplace_back(_positions.cbegin() + _trigram_start_offsets[trigram_id],
+                                 _positions.cbegin() + _trigram_start_offsets[trigram_id + 1]);
+  }
+
+  // Intersect the shortest position lists first so that the intermediate results stay small
+  std::sort(position_ranges.begin(), position_ranges.end(), [](const auto& lhs, const auto& rhs) {
+    return std::distance(lhs.first, lhs.second) < std::distance(rhs.first, rhs.second);
+  });
+
+  auto result = std::vector<ChunkOffset>(position_ranges.front().first, position_ranges.front().second);
+  for (auto range_index = size_t{1}; range_index < position_ranges.size() && !result.empty(); ++range_index) {
+    auto intersection = std::vector<ChunkOffset>{};
+    intersection.reserve(result.size());
+    std::set_intersection(result.cbegin(), result.cend(), position_ranges[range_index].first,
+                          position_ranges[range_index].second, std::back_inserter(intersection));
+    result = std::move(intersection);
+  }
+
+  return result;
+}
+
+std::vector<TrigramIndex::Trigram> TrigramIndex::_trigrams_of(const std::string_view string) {
+  if (string.size() < 3) return {};
+
+  auto trigrams = std::vector<Trigram>{};
+  trigrams.reserve(string.size() - 2);
+  for (auto begin = size_t{0}; begin + 2 < string.size(); ++begin) {
+    trigrams.emplace_back(static_cast<Trigram>(static_cast<uint8_t>(string[begin])) << 16 |
+                          static_cast<Trigram>(static_cast<uint8_t>(string[begin + 1])) << 8 |
+                          static_cast<Trigram>(static_cast<uint8_t>(string[begin + 2])));
+  }
+
+  std::sort(trigrams.begin(), trigrams.end());
+  trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+  return trigrams;
+}
+
+std::vector<TrigramIndex::Trigram> TrigramIndex::_trigrams_of_pattern(const pmr_string& pattern) {
+  auto trigrams = std::vector<Trigram>{};
+  for (const auto& token : LikeMatcher::pattern_string_to_tokens(pattern)) {
+    if (const auto* literal = std::get_if<pmr_string>(&token)) {
+      const auto literal_trigrams = _trigrams_of(*literal);
+      trigrams.insert(trigrams.end(), literal_trigrams.cbegin(), literal_trigrams.cend());
+    }
+  }
+
+  std::sort(trigrams.begin(), trigrams.end());
+  trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+  return trigrams;
+}
+
+TrigramIndex::Iterator TrigramIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  Fail("TrigramIndex does not support range queries, use candidates() instead.");
+}
+
+TrigramIndex::Iterator TrigramIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  Fail("TrigramIndex does not support range queries, use candidates() instead.");
+}
+
+TrigramIndex::Iterator TrigramIndex::_cbegin() const {
+  Fail("TrigramIndex does not support range queries, use candidates() instead.");
+}
+
+TrigramIndex::Iterator TrigramIndex::_cend() const {
+  Fail("TrigramIndex does not support range queries, use candidates() instead.");
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> TrigramIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+size_t TrigramIndex::_memory_consumption() const {
+  return sizeof(std::vector<Trigram>) + sizeof(Trigram) * _trigrams.capacity() + sizeof(std::vector<size_t>) +
+         sizeof(size_t) * _trigram_start_offsets.capacity() + sizeof(std::vector<ChunkOffset>) +
+         sizeof(ChunkOffset) * _positions.capacity();
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "storage/index/abstract_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+/**
+ * The TrigramIndex works on a single string segment of any encoding and speeds up LIKE predicates with a literal part
+ * of at least three characters, e.g., LIKE '%ERR-1234%'. For every trigram (i.e., substring of three bytes) that
+ * occurs in the segment, it stores the sorted offsets of the rows whose value contains it (inverted index):
+ *
+ *   _trigrams:              "ERR"  "R-1"  "RR-"  ...   (sorted)
+ *   _trigram_start_offsets:   0      3      5    ...   (offsets into _positions, one more than _trigrams)
+ *   _positions:             2 7 9  2 9    2 7 9  ...   (ChunkOffsets of the rows containing the trigram)
+ *
+ * A value can only match the pattern if it contains every trigram of the literal parts of the pattern. Thus, the
+ * intersection of their position lists yields the candidates for the pattern. As trigrams do not capture their order
+ * or the wildcards between them, the candidates are a superset of the matches and have to be verified using the
+ * LikeMatcher (see IndexScan).
+ *
+ * Unlike the other segment indexes, the TrigramIndex does not sort the values. Therefore, it does not support the
+ * range queries of the AbstractIndex (lower_bound, upper_bound, cbegin, and cend), but only candidates().
+ */
+class TrigramIndex : public AbstractIndex {
+ public:
+  /**
+   * Predicts the memory consumption in bytes of creating this index.
+   * See AbstractIndex::estimate_memory_consumption()
+   */
+  static size_t estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count, uint32_t value_bytes);
+
+  // Returns whether the pattern has a literal part of at least three characters, i.e., whether the index can narrow
+  // down the rows matching the pattern
+  static bool is_pattern_supported(const pmr_string& pattern);
+
+  TrigramIndex() = delete;
+  explicit TrigramIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+  // Returns the sorted offsets of the non-NULL rows that may match the LIKE pattern. Returns std::nullopt if the
+  // pattern is not supported, i.e., if every row may match.
+  std::optional<std::vector<ChunkOffset>> candidates(const pmr_string& pattern) const;
+
+ private:
+  using Trigram = uint32_t;
+
+  // Returns the sorted and distinct trigrams of the given string
+  static std::vector<Trigram> _trigrams_of(const std::string_view string);
+
+  // Returns the trigrams of the literal parts of the pattern
+  static std::vector<Trigram> _trigrams_of_pattern(const pmr_string& pattern);
+
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+
+  std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const final;
+
+  size_t _memory_consumption() const final;
+
+  const std::shared_ptr<const AbstractSegment> _indexed_segment;
+  std::vector<Trigram> _trigrams;
+  std::vector<size_t> _trigram_start_offsets;
+  std::vector<ChunkOffset> _positions;
+};
+
+}  // namespace opossum
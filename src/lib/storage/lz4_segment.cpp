@@ -6,6 +6,7 @@
 #include <sstream>
 #include <string>
 
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "storage/vector_compression/base_vector_decompressor.hpp"
@@ -267,6 +268,24 @@ void LZ4Segment<T>::_decompress_block_to_bytes(const size_t block_index, std::ve
               "Decompressed LZ4 block has different size than the initial source data.");
 }
 
+template <typename T>
+void LZ4Segment<T>::_load_block(const size_t block_index, std::vector<char>& decompressed_data) const {
+  const auto& block_cache = Hyrise::get().lz4_block_cache;
+  if (!block_cache) {
+    _decompress_block_to_bytes(block_index, decompressed_data);
+    return;
+  }
+
+  const auto key = LZ4BlockCache::Key{_block_cache_id, block_index};
+  if (const auto cached_block = block_cache->try_get(key)) {
+    decompressed_data.assign(cached_block->cbegin(), cached_block->cend());
+    return;
+  }
+
+  _decompress_block_to_bytes(block_index, decompressed_data);
+  block_cache->set(key, std::make_shared<const std::vector<char>>(decompressed_data));
+}
+
 template <typename T>
 std::pair<T, size_t> LZ4Segment<T>::decompress(const ChunkOffset& chunk_offset,
                                                const std::optional<size_t> cached_block_index,
@@ -279,7 +298,7 @@ std::pair<T, size_t> LZ4Segment<T>::decompress(const ChunkOffset& chunk_offset,
    * decompressed block.
    */
   if (!cached_block_index || block_index != *cached_block_index) {
-    _decompress_block_to_bytes(block_index, cached_block);
+    _load_block(block_index, cached_block);
   }
 
   const auto value_offset = (memory_offset % _block_size) / sizeof(T);
@@ -327,7 +346,7 @@ std::pair<pmr_string, size_t> LZ4Segment<pmr_string>::decompress(const ChunkOffs
      * decompressed block.
      */
     if (!cached_block_index || start_block != *cached_block_index) {
-      _decompress_block_to_bytes(start_block, cached_block);
+      _load_block(start_block, cached_block);
     }
 
     // Extract the string from the block via the offsets.
@@ -380,7 +399,7 @@ std::pair<pmr_string, size_t> LZ4Segment<pmr_string>::decompress(const ChunkOffs
     for (size_t block_index = start_block; block_index <= end_block; ++block_index) {
       // Only decompress the current block if it's not cached.
       if (!(use_caching && block_index == *cached_block_index)) {
-        _decompress_block_to_bytes(block_index, cached_block);
+        _load_block(block_index, cached_block);
         new_cached_block_index = block_index;
       }
 
@@ -9,6 +9,7 @@
 #include <boost/hana/type.hpp>
 
 #include "abstract_encoded_segment.hpp"
+#include "storage/lz4_segment/lz4_block_cache.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "storage/vector_compression/base_vector_decompressor.hpp"
@@ -122,8 +123,9 @@ class LZ4Segment : public AbstractEncodedSegment {
   std::vector<T> decompress() const;
 
   /**
-   * Retrieves a single value by only decompressing the block in resides in. Each call of this method causes the
-   * decompression of a block.
+   * Retrieves a single value by only decompressing the block in resides in. Blocks are taken from the shared
+   * LZ4BlockCache (see Hyrise::lz4_block_cache) if possible, so that repeated accesses to the same block do not
+   * decompress it again.
    *
    * @param chunk_offset The chunk offset identifies a single value in the segment.
    * @return The decompressed value.
@@ -134,7 +136,8 @@ class LZ4Segment : public AbstractEncodedSegment {
    * Retrieves a single value by only decompressing the block in resides in. This method also accepts a previously
    * decompressed block (and its block index) to check if the queried value also resides in that block. If that is the
    * case, the value is retrieved directly instead of decompressing the block again.
-   * If the passed block is a different block, it is overwritten with the newly decompressed block.
+   * If the passed block is a different block, it is overwritten with the newly decompressed block (or a copy of the
+   * block held in the LZ4BlockCache).
    * This block is stored (and passed) as char-vector instead of type T to maintain compatibility with string-segments,
    * since those don't compress a string-vector but a char-vector. In the case of non-string-segments, the data will be
    * cast to type T. In the case of string-segments, the char-vector can be used directly.
@@ -179,6 +182,9 @@ class LZ4Segment : public AbstractEncodedSegment {
   const size_t _compressed_size;
   const size_t _num_elements;
 
+  // Identifies the blocks of this segment in the LZ4BlockCache
+  const uint64_t _block_cache_id{LZ4BlockCache::next_segment_id()};
+
   /**
    * Decompress a single block into the provided buffer (the vector). This method writes to the buffer with the given
    * offset, i.e., the buffer can be larger than a single block.
@@ -214,6 +220,15 @@ class LZ4Segment : public AbstractEncodedSegment {
    */
   void _decompress_block_to_bytes(const size_t block_index, std::vector<char>& decompressed_data,
                                   const size_t write_offset) const;
+
+  /**
+   * Writes the decompressed block to the passed vector. If the block is held in the LZ4BlockCache, it is copied from
+   * there. Otherwise, it is decompressed and added to the cache.
+   *
+   * @param block_index Index of the block that is loaded.
+   * @param decompressed_data Vector to which the decompressed data is written (see _decompress_block_to_bytes).
+   */
+  void _load_block(const size_t block_index, std::vector<char>& decompressed_data) const;
 };
 
 template<> std::vector<pmr_string> LZ4Segment<pmr_string>::decompress() const;
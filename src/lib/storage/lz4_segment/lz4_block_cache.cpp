@@ -0,0 +1,95 @@
+#include "lz4_block_cache.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::atomic<uint64_t> LZ4BlockCache::_next_segment_id{0};
+
+bool LZ4BlockCache::Key::operator==(const Key& other) const {
+  return segment_id == other.segment_id && block_index == other.block_index;
+}
+
+size_t LZ4BlockCache::KeyHash::operator()(const Key& key) const {
+  auto hash = size_t{0};
+  boost::hash_combine(hash, key.segment_id);
+  boost::hash_combine(hash, key.block_index);
+  return hash;
+}
+
+LZ4BlockCache::LZ4BlockCache(const size_t capacity) : _capacity(capacity) {}
+
+LZ4BlockCache::Block LZ4BlockCache::try_get(const Key& key) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  const auto map_iter = _map.find(key);
+  if (map_iter == _map.end()) return nullptr;
+
+  // Move the block to the front of the LRU list
+  _lru_list.splice(_lru_list.begin(), _lru_list, map_iter->second);
+  return map_iter->second->second;
+}
+
+void LZ4BlockCache::set(const Key& key, const Block& block) {
+  DebugAssert(block, "Cannot cache nullptr");
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  if (block->size() > _capacity) return;
+
+  const auto map_iter = _map.find(key);
+  if (map_iter != _map.end()) {
+    // Another thread might have decompressed and cached the same block concurrently
+    _memory_usage -= map_iter->second->second->size();
+    _lru_list.erase(map_iter->second);
+    _map.erase(map_iter);
+  }
+
+  _evict(_capacity - block->size());
+
+  _lru_list.emplace_front(key, block);
+  _map.emplace(key, _lru_list.begin());
+  _memory_usage += block->size();
+}
+
+void LZ4BlockCache::resize(const size_t capacity) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _capacity = capacity;
+  _evict(_capacity);
+}
+
+void LZ4BlockCache::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _lru_list.clear();
+  _map.clear();
+  _memory_usage = 0;
+}
+
+size_t LZ4BlockCache::capacity() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _capacity;
+}
+
+size_t LZ4BlockCache::size() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _map.size();
+}
+
+size_t LZ4BlockCache::memory_usage() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _memory_usage;
+}
+
+uint64_t LZ4BlockCache::next_segment_id() { return _next_segment_id++; }
+
+void LZ4BlockCache::_evict(const size_t capacity) {
+  while (_memory_usage > capacity) {
+    const auto& [key, block] = _lru_list.back();
+    _memory_usage -= block->size();
+    _map.erase(key);
+    _lru_list.pop_back();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Accessing single values of an LZ4Segment (e.g., via operator[], SegmentAccessors, or when resolving the position
+ * list of a ReferenceSegment) requires the decompression of the whole block the value resides in. Without caching,
+ * the same blocks are decompressed over and over again, e.g., when multiple reference segments (the output chunks of a
+ * join) point into the same LZ4Segment.
+ *
+ * The LZ4BlockCache is shared by all LZ4Segments (see Hyrise::lz4_block_cache) and holds decompressed blocks. Its
+ * capacity is given in bytes of decompressed data. If it is exceeded, the least recently used blocks are evicted. All
+ * methods are thread-safe.
+ *
+ * Blocks are identified by the id of their segment (see next_segment_id) and their index within the segment. Segment
+ * ids are never reused, so that a segment that is allocated at the address of a deleted segment does not see blocks
+ * of its predecessor. Blocks of deleted segments are not removed explicitly but are eventually evicted.
+ */
+class LZ4BlockCache : private Noncopyable {
+ public:
+  struct Key {
+    uint64_t segment_id;
+    size_t block_index;
+
+    bool operator==(const Key& other) const;
+  };
+
+  using Block = std::shared_ptr<const std::vector<char>>;
+
+  // 64 MB of decompressed data, i.e., 4096 blocks of the default LZ4Encoder block size
+  static constexpr auto DEFAULT_CAPACITY = size_t{64} * 1024 * 1024;
+
+  explicit LZ4BlockCache(const size_t capacity = DEFAULT_CAPACITY);
+
+  // Returns the cached block or nullptr if the block is not cached. Marks the block as recently used.
+  Block try_get(const Key& key);
+
+  // Adds the block to the cache and evicts the least recently used blocks if the capacity is exceeded. Blocks that
+  // are larger than the capacity are not cached.
+  void set(const Key& key, const Block& block);
+
+  // Changes the capacity (in bytes) and evicts blocks if necessary
+  void resize(const size_t capacity);
+
+  void clear();
+
+  size_t capacity() const;
+
+  // Number of cached blocks
+  size_t size() const;
+
+  // Sum of the sizes of all cached blocks in bytes
+  size_t memory_usage() const;
+
+  // Returns a new, unique id that LZ4Segments use to identify their blocks
+  static uint64_t next_segment_id();
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  using LRUList = std::list<std::pair<Key, Block>>;
+
+  // Expects _mutex to be locked
+  void _evict(const size_t capacity);
+
+  mutable std::mutex _mutex;
+  size_t _capacity;
+  size_t _memory_usage{0};
+
+  // Most recently used blocks are at the front
+  LRUList _lru_list;
+  std::unordered_map<Key, LRUList::iterator, KeyHash> _map;
+
+  static std::atomic<uint64_t> _next_segment_id;
+};
+
+}  // namespace opossum
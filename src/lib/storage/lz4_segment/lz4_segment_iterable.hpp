@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 
 #include "storage/segment_iterables.hpp"
 
@@ -49,11 +52,27 @@ class LZ4SegmentIterable : public PointAccessibleSegmentIterable<LZ4SegmentItera
     // vector storing the uncompressed values
     auto decompressed_filtered_segment = std::vector<ValueType>(position_filter_size);
 
+    // Position lists are not necessarily ordered (e.g., the output of a join). To load each block only once, the
+    // positions are resolved in the order of their chunk offsets, which groups them by block. The values are still
+    // written to the index of their position in the position list.
+    const auto chunk_offset_less = [](const auto& lhs, const auto& rhs) { return lhs.chunk_offset < rhs.chunk_offset; };
+    const auto positions_ordered =
+        std::is_sorted(position_filter->cbegin(), position_filter->cend(), chunk_offset_less);
+    auto position_order = std::vector<size_t>{};
+    if (!positions_ordered) {
+      position_order.resize(position_filter_size);
+      std::iota(position_order.begin(), position_order.end(), size_t{0u});
+      std::sort(position_order.begin(), position_order.end(), [&](const auto lhs, const auto rhs) {
+        return chunk_offset_less((*position_filter)[lhs], (*position_filter)[rhs]);
+      });
+    }
+
     // _segment.decompress() takes the currently cached block (reference) and its id in addition to the requested
-    // element. If the requested element is not within that block, the next block will be decompressed and written to
-    // `cached_block` while the value and the new block id are returned. In case the requested element is within the
-    // cached block, the value and the input block id are returned.
-    for (auto index = size_t{0u}; index < position_filter_size; ++index) {
+    // element. If the requested element is not within that block, the next block will be decompressed (or copied from
+    // the LZ4BlockCache) and written to `cached_block` while the value and the new block id are returned. In case the
+    // requested element is within the cached block, the value and the input block id are returned.
+    for (auto order_index = size_t{0u}; order_index < position_filter_size; ++order_index) {
+      const auto index = positions_ordered ? order_index : position_order[order_index];
       const auto& position = (*position_filter)[index];
       // NOLINTNEXTLINE
       auto [value, block_index] = _segment.decompress(position.chunk_offset, cached_block_index, cached_block);
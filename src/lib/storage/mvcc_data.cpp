@@ -68,6 +68,15 @@ bool MvccData::compare_exchange_tid(const ChunkOffset offset, TransactionID expe
   return _tids[offset].compare_exchange_strong(expected_transaction_id, new_transaction_id);
 }
 
+void MvccData::register_insert() { ++_pending_inserts; }
+
+void MvccData::deregister_insert() {
+  DebugAssert(_pending_inserts > 0, "Inserts are not tracked properly.");
+  --_pending_inserts;
+}
+
+uint32_t MvccData::pending_inserts_count() const { return _pending_inserts.load(); }
+
 size_t MvccData::memory_usage() const {
   auto bytes = size_t{0};
   bytes += sizeof(_tids) + sizeof(_begin_cids) + sizeof(_end_cids);  // NOLINT
@@ -45,6 +45,17 @@ struct MvccData {
   bool compare_exchange_tid(const ChunkOffset offset, TransactionID expected_transaction_id,
                             TransactionID new_transaction_id);
 
+  /**
+   * The Insert operator registers itself for each chunk it allocates rows in and deregisters once it has committed or
+   * rolled back. A chunk that has reached its target size and has no pending Inserts will not be modified by Inserts
+   * anymore and can safely be finalized. This replaces reading the (non-atomic) begin_cids to find such chunks.
+   * @{
+   */
+  void register_insert();
+  void deregister_insert();
+  uint32_t pending_inserts_count() const;
+  /** @} */
+
   size_t memory_usage() const;
 
  private:
@@ -52,6 +63,8 @@ struct MvccData {
   pmr_vector<CommitID> _begin_cids;                  // < commit id when record was added
   pmr_vector<CommitID> _end_cids;                    // < commit id when record was deleted
   pmr_vector<copyable_atomic<TransactionID>> _tids;  // < 0 unless locked by a transaction
+
+  std::atomic_uint32_t _pending_inserts{0};
 };
 
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data);
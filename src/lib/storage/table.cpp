@@ -5,18 +5,79 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "concurrency/transaction_manager.hpp"
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/attribute_statistics.hpp"
+#include "statistics/column_group_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_art/table_art_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/index/trigram/trigram_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Each insert lane's tail reserves memory for target_chunk_size rows (see Table::InsertLane)
+constexpr auto MAX_INSERT_LANE_COUNT = 8u;
+
+size_t insert_lane_count(const TableType type, const UseMvcc use_mvcc) {
+  if (type != TableType::Data || use_mvcc != UseMvcc::Yes) return 0;
+  return std::clamp(std::thread::hardware_concurrency(), 1u, MAX_INSERT_LANE_COUNT);
+}
+
+// Builds the index without adding it to the chunk. Returns nullptr if the chunk cannot be indexed (yet).
+std::shared_ptr<AbstractIndex> build_chunk_index(const Chunk& chunk, const IndexStatistics& index_statistics) {
+  if (chunk.is_mutable()) return nullptr;
+
+  auto segments = std::vector<std::shared_ptr<const AbstractSegment>>{};
+  for (const auto column_id : index_statistics.column_ids) {
+    segments.emplace_back(chunk.get_segment(column_id));
+  }
+
+  if (index_statistics.type != SegmentIndexType::BTree && index_statistics.type != SegmentIndexType::Trigram) {
+    for (const auto& segment : segments) {
+      if (!std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)) return nullptr;
+    }
+  }
+
+  switch (index_statistics.type) {
+    case SegmentIndexType::GroupKey:
+      return std::make_shared<GroupKeyIndex>(segments);
+    case SegmentIndexType::CompositeGroupKey:
+      return std::make_shared<CompositeGroupKeyIndex>(segments);
+    case SegmentIndexType::AdaptiveRadixTree:
+      return std::make_shared<AdaptiveRadixTreeIndex>(segments);
+    case SegmentIndexType::BTree:
+      return std::make_shared<BTreeIndex>(segments);
+    case SegmentIndexType::Trigram:
+      return std::make_shared<TrigramIndex>(segments);
+    case SegmentIndexType::TableHash:
+    case SegmentIndexType::TableART:
+      Fail("Table-wide indexes are not segment indexes.");
+    case SegmentIndexType::Invalid:
+      Fail("SegmentIndexType is invalid.");
+  }
+  Fail("GCC thinks this is reachable.");
+}
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<Table> Table::create_dummy_table(const TableColumnDefinitions& column_definitions) {
@@ -29,7 +90,9 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _type(type),
       _use_mvcc(use_mvcc),
       _target_chunk_size(type == TableType::Data ? target_chunk_size.value_or(Chunk::DEFAULT_SIZE) : Chunk::MAX_SIZE),
-      _append_mutex(std::make_unique<std::mutex>()) {
+      _shared_dictionary_mutex(std::make_unique<std::mutex>()),
+      _append_mutex(std::make_unique<std::mutex>()),
+      _insert_lanes(insert_lane_count(type, use_mvcc)) {
   DebugAssert(target_chunk_size <= Chunk::MAX_SIZE, "Chunk size exceeds maximum");
   DebugAssert(type == TableType::Data || !target_chunk_size, "Must not set target_chunk_size for reference tables");
   DebugAssert(!target_chunk_size || *target_chunk_size > 0, "Table must have a chunk size greater than 0.");
@@ -123,6 +186,7 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
     // One chunk reached its capacity and was not finalized before.
     if (last_chunk && last_chunk->is_mutable()) {
       last_chunk->finalize();
+      create_chunk_indexes(ChunkID{chunk_count() - 1});
     }
 
     append_mutable_chunk();
@@ -130,6 +194,14 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
   }
 
   last_chunk->append(values);
+  increase_inserted_row_count(1);
+
+  const auto chunk_id = ChunkID{chunk_count() - 1};
+  const auto chunk_size = last_chunk->size();
+  const auto lock = std::shared_lock<std::shared_mutex>{_indexes_mutex};
+  for (const auto& table_index : _table_indexes) {
+    table_index->insert(*last_chunk, chunk_id, chunk_size - 1, chunk_size);
+  }
 }
 
 void Table::append_mutable_chunk() {
@@ -150,6 +222,93 @@ void Table::append_mutable_chunk() {
   append_chunk(segments, mvcc_data);
 }
 
+Table::InsertLane& Table::insert_lane() {
+  Assert(!_insert_lanes.empty(), "Only data tables with MVCC have insert lanes.");
+  return _insert_lanes[_insert_lane_index()];
+}
+
+ChunkID Table::claim_mutable_tail(InsertLane& insert_lane) {
+  const auto tail_chunk_id = insert_lane.tail_chunk_id.load();
+  if (tail_chunk_id != INVALID_CHUNK_ID) {
+    const auto tail_chunk = get_chunk(tail_chunk_id);
+    if (tail_chunk && tail_chunk->is_mutable() && tail_chunk->size() < _target_chunk_size) return tail_chunk_id;
+  }
+
+  // The tails of all lanes are only changed while holding the append mutex
+  const auto append_lock = acquire_append_mutex();
+
+  const auto chunk_count = this->chunk_count();
+  if (chunk_count > 0) {
+    const auto last_chunk_id = ChunkID{chunk_count - 1};
+    const auto last_chunk = get_chunk(last_chunk_id);
+    const auto is_claimed = std::any_of(_insert_lanes.cbegin(), _insert_lanes.cend(), [&](const auto& other_lane) {
+      return other_lane.tail_chunk_id == last_chunk_id;
+    });
+    if (last_chunk && last_chunk->is_mutable() && last_chunk->size() < _target_chunk_size && !is_claimed) {
+      insert_lane.tail_chunk_id = last_chunk_id;
+      return last_chunk_id;
+    }
+  }
+
+  append_mutable_chunk();
+  insert_lane.tail_chunk_id = ChunkID{this->chunk_count() - 1};
+  return insert_lane.tail_chunk_id;
+}
+
+size_t Table::_insert_lane_index() const {
+  return std::hash<std::thread::id>{}(std::this_thread::get_id()) % _insert_lanes.size();
+}
+
+std::vector<std::unique_lock<std::mutex>> Table::acquire_insert_lane_mutexes() {
+  auto locks = std::vector<std::unique_lock<std::mutex>>{};
+  locks.reserve(_insert_lanes.size());
+  for (auto& insert_lane : _insert_lanes) {
+    locks.emplace_back(insert_lane.mutex);
+  }
+  return locks;
+}
+
+std::optional<ChunkID> Table::mutable_tail_chunk_id() const {
+  if (!_insert_lanes.empty()) {
+    const auto tail_chunk_id = _insert_lanes[_insert_lane_index()].tail_chunk_id.load();
+    if (tail_chunk_id != INVALID_CHUNK_ID) {
+      const auto tail_chunk = get_chunk(tail_chunk_id);
+      if (tail_chunk && tail_chunk->is_mutable()) return tail_chunk_id;
+    }
+  }
+
+  // Mutable chunks appended via append_chunk (e.g., by loaders) are written to as well
+  const auto chunk_count = this->chunk_count();
+  if (chunk_count == 0) return std::nullopt;
+
+  const auto last_chunk_id = ChunkID{chunk_count - 1};
+  const auto last_chunk = get_chunk(last_chunk_id);
+  if (last_chunk && last_chunk->is_mutable()) return last_chunk_id;
+
+  return std::nullopt;
+}
+
+std::vector<ChunkID> Table::mutable_tail_chunk_ids() const {
+  auto chunk_ids = std::vector<ChunkID>{};
+  for (const auto& insert_lane : _insert_lanes) {
+    const auto tail_chunk_id = insert_lane.tail_chunk_id.load();
+    if (tail_chunk_id == INVALID_CHUNK_ID) continue;
+
+    const auto tail_chunk = get_chunk(tail_chunk_id);
+    if (tail_chunk && tail_chunk->is_mutable()) chunk_ids.emplace_back(tail_chunk_id);
+  }
+
+  const auto chunk_count = this->chunk_count();
+  if (chunk_count > 0) {
+    const auto last_chunk = get_chunk(ChunkID{chunk_count - 1});
+    if (last_chunk && last_chunk->is_mutable()) chunk_ids.emplace_back(chunk_count - 1);
+  }
+
+  std::sort(chunk_ids.begin(), chunk_ids.end());
+  chunk_ids.erase(std::unique(chunk_ids.begin(), chunk_ids.end()), chunk_ids.end());
+  return chunk_ids;
+}
+
 uint64_t Table::row_count() const {
   if (_type == TableType::References && _cached_row_count && !HYRISE_DEBUG) {
     return *_cached_row_count;
@@ -174,6 +333,14 @@ uint64_t Table::row_count() const {
   return row_count;
 }
 
+uint64_t Table::inserted_row_count() const { return _inserted_row_count.load(); }
+
+uint64_t Table::invalidated_row_count() const { return _invalidated_row_count.load(); }
+
+void Table::increase_inserted_row_count(const uint64_t count) const { _inserted_row_count += count; }
+
+void Table::increase_invalidated_row_count(const uint64_t count) const { _invalidated_row_count += count; }
+
 bool Table::empty() const { return row_count() == 0u; }
 
 ChunkID Table::chunk_count() const { return ChunkID{static_cast<ChunkID::base_type>(_chunks.size())}; }
@@ -221,13 +388,18 @@ void Table::remove_chunk(ChunkID chunk_id) {
               }()),
               "Physical delete of chunk prevented: Chunk needs to be fully invalidated before.");
   Assert(_type == TableType::Data, "Removing chunks from other tables than data tables is not intended yet.");
+
+  const auto chunk = get_chunk(chunk_id);
+  const auto lock = std::shared_lock<std::shared_mutex>{_indexes_mutex};
+  for (const auto& table_index : _table_indexes) {
+    table_index->remove_chunk(*chunk, chunk_id);
+  }
+
   std::atomic_store(&_chunks[chunk_id], std::shared_ptr<Chunk>(nullptr));
 }
 
 void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data,  // NOLINT
                          const std::optional<PolymorphicAllocator<Chunk>>& alloc) {
-  Assert(_type != TableType::Data || static_cast<bool>(mvcc_data) == (_use_mvcc == UseMvcc::Yes),
-         "Supply MvccData to data Tables if MVCC is enabled.");
   AssertInput(static_cast<ColumnCount::base_type>(segments.size()) == column_count(),
               "Input does not have the same number of columns.");
 
@@ -248,13 +420,20 @@ void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvc
     }
   }
 
+  append_chunk(std::make_shared<Chunk>(segments, mvcc_data, alloc));
+}
+
+void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
+  Assert(_type != TableType::Data || chunk->has_mvcc_data() == (_use_mvcc == UseMvcc::Yes),
+         "Supply MvccData to data Tables if MVCC is enabled.");
+  AssertInput(chunk->column_count() == column_count(), "Input does not have the same number of columns.");
+
   // tbb::concurrent_vector does not guarantee that elements reported by size() are fully initialized yet:
   // https://software.intel.com/en-us/blogs/2009/04/09/delusion-of-tbbconcurrent_vectors-size-or-3-ways-to-traverse-in-parallel-correctly  // NOLINT
   // To avoid someone reading an incomplete shared_ptr<Chunk>, we (1) use the zero_allocator for the concurrent_vector,
   // making sure that an uninitialized entry compares equal to nullptr and (2) insert the desired chunk atomically.
-
   auto new_chunk_iter = _chunks.push_back(nullptr);
-  std::atomic_store(&*new_chunk_iter, std::make_shared<Chunk>(segments, mvcc_data, alloc));
+  std::atomic_store(&*new_chunk_iter, chunk);
 }
 
 std::vector<AllTypeVariant> Table::get_row(size_t row_idx) const {
@@ -313,16 +492,215 @@ std::vector<std::vector<AllTypeVariant>> Table::get_rows() const {
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::shared_ptr<TableStatistics> Table::table_statistics() const { return _table_statistics; }
+std::shared_ptr<TableStatistics> Table::table_statistics() const { return std::atomic_load(&_table_statistics); }
 
 void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics) {
-  _table_statistics = table_statistics;
+  // The statistics are replaced by the ChunkMaintenancePlugin while queries are optimized
+  std::atomic_store(&_table_statistics, table_statistics);
+
+  // Statistics that were updated with the rows of new chunks (see TableStatistics::updated) still describe the rows
+  // the ColumnGroupStatistics were built from, so these are kept. They are only dropped when the statistics are
+  // created anew by TableStatistics::from_table.
+  if (table_statistics && table_statistics->added_row_count > 0.0f) return;
+
+  const auto lock = std::lock_guard<std::mutex>{_column_group_statistics_mutex};
+  _column_group_statistics.clear();
+}
+
+std::shared_ptr<const ColumnGroupStatistics> Table::column_group_statistics(
+    const std::vector<ColumnID>& column_ids) const {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_column_group_statistics_mutex};
+    const auto column_group_statistics_iter = _column_group_statistics.find(column_ids);
+    if (column_group_statistics_iter != _column_group_statistics.end()) return column_group_statistics_iter->second;
+  }
+
+  // Build the statistics without holding the lock, as sampling the table takes a while. If another thread built them
+  // concurrently, its statistics are kept.
+  const auto column_group_statistics = ColumnGroupStatistics::from_table(*this, column_ids);
+
+  const auto lock = std::lock_guard<std::mutex>{_column_group_statistics_mutex};
+  return _column_group_statistics.emplace(column_ids, column_group_statistics).first->second;
+}
+
+std::vector<IndexStatistics> Table::indexes_statistics() const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_indexes_mutex};
+  return _indexes;
+}
+
+void Table::add_index_statistics(const IndexStatistics& index_statistics) {
+  const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
+  _indexes.emplace_back(index_statistics);
+}
+
+void Table::create_chunk_indexes(const ChunkID chunk_id) {
+  auto indexes_statistics = std::vector<IndexStatistics>{};
+  {
+    const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
+
+    // Indexes that are still being built index the chunk themselves before they become visible
+    for (auto& pending_index_build : _pending_index_builds) {
+      pending_index_build.chunk_ids.emplace_back(chunk_id);
+    }
+    indexes_statistics = _indexes;
+  }
+
+  const auto chunk = get_chunk(chunk_id);
+  if (!chunk) return;
+
+  for (const auto& index_statistics : indexes_statistics) {
+    if (is_table_index_type(index_statistics.type)) continue;
+
+    _create_chunk_index(*chunk, index_statistics);
+  }
+}
+
+void Table::drop_index(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type) {
+  Assert(!is_table_index_type(index_type), "Table-wide indexes cannot be dropped");
+
+  // Remove the statistics first, so that new plans do not rely on the index anymore
+  {
+    const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
+    _indexes.erase(std::remove_if(_indexes.begin(), _indexes.end(),
+                                  [&](const auto& index_statistics) {
+                                    return index_statistics.column_ids == column_ids &&
+                                           index_statistics.type == index_type;
+                                  }),
+                   _indexes.end());
+  }
+
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = std::atomic_load(&_chunks[chunk_id]);
+    if (!chunk) continue;
+
+    if (const auto index = chunk->get_index(index_type, column_ids)) {
+      chunk->remove_index(index);
+    }
+  }
 }
 
-std::vector<IndexStatistics> Table::indexes_statistics() const { return _indexes; }
+std::shared_ptr<TableHashIndex> Table::create_table_hash_index(const std::vector<ColumnID>& column_ids,
+                                                               const std::string& name,
+                                                               const std::vector<ColumnID>& included_column_ids) {
+  Assert(!get_table_hash_index(column_ids), "TableHashIndex on these columns already exists");
+
+  const auto table_hash_index = _build_table_hash_index(column_ids, included_column_ids);
+
+  const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
+  Assert(!_find_table_index(SegmentIndexType::TableHash, column_ids), "TableHashIndex was created concurrently");
+  _table_indexes.emplace_back(table_hash_index);
+  _table_index_column_ids.emplace_back(column_ids);
+  _indexes.emplace_back(IndexStatistics{column_ids, name, SegmentIndexType::TableHash});
+  return table_hash_index;
+}
+
+std::shared_ptr<TableARTIndex> Table::create_table_art_index(const ColumnID column_id, const std::string& name,
+                                                             const std::vector<ColumnID>& included_column_ids) {
+  Assert(_type == TableType::Data, "Table-wide indexes can only be created on data tables");
+  Assert(!get_table_art_index(column_id), "TableARTIndex on this column already exists");
+
+  const auto table_art_index =
+      std::make_shared<TableARTIndex>(column_id, column_data_type(column_id), included_column_ids);
+  _insert_all_rows(*table_art_index);
+
+  const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
+  Assert(!_find_table_index(SegmentIndexType::TableART, {column_id}), "TableARTIndex was created concurrently");
+  _table_indexes.emplace_back(table_art_index);
+  _table_index_column_ids.emplace_back(std::vector<ColumnID>{column_id});
+  _indexes.emplace_back(IndexStatistics{{column_id}, name, SegmentIndexType::TableART});
+  return table_art_index;
+}
+
+void Table::add_table_index(const std::shared_ptr<AbstractTableIndex>& table_index,
+                            const std::optional<std::vector<ColumnID>>& column_ids) {
+  DebugAssert(!column_ids || column_ids->size() == table_index->column_ids().size(), "Expected a ColumnID per column");
+
+  const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
+  _table_indexes.emplace_back(table_index);
+  _table_index_column_ids.emplace_back(column_ids.value_or(table_index->column_ids()));
+}
+
+void Table::set_table_index_chunk_ids(std::vector<ChunkID> chunk_ids) { _table_index_chunk_ids = std::move(chunk_ids); }
+
+void Table::map_table_index_row_ids(std::vector<RowID>& row_ids) const {
+  if (!_table_index_chunk_ids) return;
+
+  const auto& chunk_ids = *_table_index_chunk_ids;
+  auto output_iter = row_ids.begin();
+  for (const auto& row_id : row_ids) {
+    if (row_id.chunk_id >= chunk_ids.size() || chunk_ids[row_id.chunk_id] == INVALID_CHUNK_ID) continue;
+    *output_iter = RowID{chunk_ids[row_id.chunk_id], row_id.chunk_offset};
+    ++output_iter;
+  }
+  row_ids.erase(output_iter, row_ids.end());
+}
+
+std::shared_ptr<TableHashIndex> Table::get_table_hash_index(const std::vector<ColumnID>& column_ids) const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_indexes_mutex};
+  return std::static_pointer_cast<TableHashIndex>(_find_table_index(SegmentIndexType::TableHash, column_ids));
+}
+
+std::shared_ptr<TableARTIndex> Table::get_table_art_index(const ColumnID column_id) const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_indexes_mutex};
+  return std::static_pointer_cast<TableARTIndex>(_find_table_index(SegmentIndexType::TableART, {column_id}));
+}
+
+std::vector<std::shared_ptr<AbstractTableIndex>> Table::table_indexes() const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_indexes_mutex};
+  return _table_indexes;
+}
 
 const TableKeyConstraints& Table::soft_key_constraints() const { return _table_key_constraints; }
 
+void Table::add_key_constraint(const TableKeyConstraint& table_key_constraint) {
+  auto column_ids = std::vector<ColumnID>{table_key_constraint.columns().begin(), table_key_constraint.columns().end()};
+  std::sort(column_ids.begin(), column_ids.end());
+
+  auto table_hash_index = get_table_hash_index(column_ids);
+  const auto create_index = !table_hash_index;
+  if (create_index) table_hash_index = _build_table_hash_index(column_ids);
+
+  // Rows that were deleted or rolled back do not violate the constraint
+  const auto is_valid = [&](const Chunk& chunk, const ChunkOffset chunk_offset) {
+    const auto& mvcc_data = chunk.mvcc_data();
+    return !mvcc_data || mvcc_data->get_end_cid(chunk_offset) == MvccData::MAX_COMMIT_ID;
+  };
+
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = std::atomic_load(&_chunks[chunk_id]);
+    if (!chunk) continue;
+
+    const auto matches_per_row = table_hash_index->lookup(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < matches_per_row.size(); ++chunk_offset) {
+      if (!is_valid(*chunk, chunk_offset)) continue;
+
+      const auto& matches = matches_per_row[chunk_offset];
+      const auto valid_match_count = std::count_if(matches.begin(), matches.end(), [&](const auto& row_id) {
+        return is_valid(*get_chunk(row_id.chunk_id), row_id.chunk_offset);
+      });
+      Assert(valid_match_count <= 1, "Existing rows violate the key constraint");
+    }
+  }
+
+  add_soft_key_constraint(table_key_constraint);
+
+  const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
+  if (create_index) {
+    Assert(!_find_table_index(SegmentIndexType::TableHash, column_ids), "TableHashIndex was created concurrently");
+    _table_indexes.emplace_back(table_hash_index);
+    _table_index_column_ids.emplace_back(column_ids);
+    _indexes.emplace_back(IndexStatistics{column_ids, "", SegmentIndexType::TableHash});
+  }
+  _key_constraint_indexes.emplace_back(table_hash_index);
+}
+
+std::vector<std::shared_ptr<TableHashIndex>> Table::key_constraint_indexes() const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_indexes_mutex};
+  return _key_constraint_indexes;
+}
+
 void Table::add_soft_key_constraint(const TableKeyConstraint& table_key_constraint) {
   Assert(_type == TableType::Data, "Key constraints are not tracked for reference tables across the PQP.");
 
@@ -354,6 +732,141 @@ void Table::add_soft_key_constraint(const TableKeyConstraint& table_key_constrai
   }
 }
 
+void Table::add_soft_foreign_key_constraint(const ForeignKeyConstraint& foreign_key_constraint) {
+  Assert(_type == TableType::Data, "Foreign key constraints are not tracked for reference tables across the PQP.");
+
+  for (const auto& column_id : foreign_key_constraint.columns()) {
+    Assert(column_id < column_count(), "ColumnID out of range");
+  }
+
+  {
+    auto scoped_lock = acquire_append_mutex();
+
+    for (const auto& existing_constraint : _foreign_key_constraints) {
+      Assert(foreign_key_constraint != existing_constraint, "The foreign key constraint has already been defined.");
+    }
+
+    _foreign_key_constraints.push_back(foreign_key_constraint);
+  }
+}
+
+const ForeignKeyConstraints& Table::soft_foreign_key_constraints() const { return _foreign_key_constraints; }
+
+void Table::_build_index(const IndexStatistics& index_statistics) {
+  auto pending_index_build = std::list<PendingIndexBuild>::iterator{};
+  {
+    const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
+    pending_index_build =
+        _pending_index_builds.emplace(_pending_index_builds.end(), PendingIndexBuild{index_statistics, {}});
+  }
+
+  // The indexes created by this build. Each job only accesses the entry of its own chunk.
+  auto chunk_indexes = std::vector<std::shared_ptr<AbstractIndex>>{};
+  auto chunk_ids = std::vector<ChunkID>{};
+  auto visited_chunk_count = ChunkID{0};
+
+  while (true) {
+    // Besides the chunks passed to create_chunk_indexes, index the chunks that were added since the last round
+    const auto chunk_count = this->chunk_count();
+    for (auto chunk_id = visited_chunk_count; chunk_id < chunk_count; ++chunk_id) {
+      chunk_ids.emplace_back(chunk_id);
+    }
+    visited_chunk_count = chunk_count;
+    chunk_indexes.resize(chunk_count);
+
+    std::sort(chunk_ids.begin(), chunk_ids.end());
+    chunk_ids.erase(std::unique(chunk_ids.begin(), chunk_ids.end()), chunk_ids.end());
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_ids.size());
+    for (const auto chunk_id : chunk_ids) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        const auto chunk = get_chunk(chunk_id);
+        if (!chunk) return;
+
+        // Only index the chunk again if its segments were replaced (e.g., by encoding it) since we indexed it
+        auto& chunk_index = chunk_indexes[chunk_id];
+        if (chunk_index) {
+          auto segments = std::vector<std::shared_ptr<const AbstractSegment>>{};
+          for (const auto column_id : index_statistics.column_ids) {
+            segments.emplace_back(chunk->get_segment(column_id));
+          }
+          if (chunk_index->is_index_for(segments)) return;
+        }
+
+        if (const auto index = _create_chunk_index(*chunk, index_statistics)) {
+          chunk_index = index;
+        }
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
+    if (pending_index_build->chunk_ids.empty() && this->chunk_count() == visited_chunk_count) {
+      _indexes.emplace_back(index_statistics);
+      _pending_index_builds.erase(pending_index_build);
+      return;
+    }
+    chunk_ids = std::move(pending_index_build->chunk_ids);
+    pending_index_build->chunk_ids.clear();
+  }
+}
+
+std::shared_ptr<AbstractIndex> Table::_create_chunk_index(Chunk& chunk, const IndexStatistics& index_statistics) {
+  {
+    const auto lock = std::shared_lock<std::shared_mutex>{_indexes_mutex};
+    if (const auto index = chunk.get_index(index_statistics.type, index_statistics.column_ids)) return index;
+  }
+
+  // Build the index without holding the lock. Checking for an index created meanwhile (e.g., by a concurrent
+  // create_chunk_indexes and an index build) and adding ours is atomic, so that the chunk gets a single index.
+  const auto index = build_chunk_index(chunk, index_statistics);
+  if (!index) return nullptr;
+
+  const auto lock = std::unique_lock<std::shared_mutex>{_indexes_mutex};
+  if (const auto existing_index = chunk.get_index(index_statistics.type, index_statistics.column_ids)) {
+    return existing_index;
+  }
+  chunk.add_index(index);
+  return index;
+}
+
+std::shared_ptr<AbstractTableIndex> Table::_find_table_index(const SegmentIndexType type,
+                                                             const std::vector<ColumnID>& column_ids) const {
+  const auto table_index_count = _table_indexes.size();
+  for (auto table_index_id = size_t{0}; table_index_id < table_index_count; ++table_index_id) {
+    if (_table_indexes[table_index_id]->type() == type && _table_index_column_ids[table_index_id] == column_ids) {
+      return _table_indexes[table_index_id];
+    }
+  }
+  return nullptr;
+}
+
+std::shared_ptr<TableHashIndex> Table::_build_table_hash_index(const std::vector<ColumnID>& column_ids,
+                                                               const std::vector<ColumnID>& included_column_ids) const {
+  Assert(_type == TableType::Data, "TableHashIndexes can only be created on data tables");
+
+  auto data_types = std::vector<DataType>{};
+  data_types.reserve(column_ids.size());
+  for (const auto column_id : column_ids) {
+    data_types.emplace_back(column_data_type(column_id));
+  }
+
+  const auto table_hash_index = std::make_shared<TableHashIndex>(column_ids, data_types, included_column_ids);
+  _insert_all_rows(*table_hash_index);
+  return table_hash_index;
+}
+
+void Table::_insert_all_rows(AbstractTableIndex& table_index) const {
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = std::atomic_load(&_chunks[chunk_id]);
+    if (!chunk) continue;
+
+    table_index.insert(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+  }
+}
+
 const std::vector<ColumnID>& Table::value_clustered_by() const { return _value_clustered_by; }
 
 void Table::set_value_clustered_by(const std::vector<ColumnID>& value_clustered_by) {
@@ -395,6 +908,24 @@ void Table::set_value_clustered_by(const std::vector<ColumnID>& value_clustered_
   _value_clustered_by = value_clustered_by;
 }
 
+std::vector<ColumnID> Table::shared_dictionary_column_ids() const {
+  const auto lock = std::lock_guard<std::mutex>{_shared_dictionary_column_ids_mutex};
+  return _shared_dictionary_column_ids;
+}
+
+void Table::add_shared_dictionary_column(const ColumnID column_id) {
+  DebugAssert(column_id < column_count(), "ColumnID out of range");
+  const auto lock = std::lock_guard<std::mutex>{_shared_dictionary_column_ids_mutex};
+  if (std::find(_shared_dictionary_column_ids.begin(), _shared_dictionary_column_ids.end(), column_id) ==
+      _shared_dictionary_column_ids.end()) {
+    _shared_dictionary_column_ids.emplace_back(column_id);
+  }
+}
+
+std::unique_lock<std::mutex> Table::acquire_shared_dictionary_mutex() {
+  return std::unique_lock<std::mutex>(*_shared_dictionary_mutex);
+}
+
 size_t Table::memory_usage(const MemoryUsageCalculationMode mode) const {
   auto bytes = size_t{sizeof(*this)};
 
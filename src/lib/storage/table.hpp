@@ -1,7 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <list>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -9,6 +13,7 @@
 #include "abstract_segment.hpp"
 #include "boost/variant.hpp"
 #include "chunk.hpp"
+#include "foreign_key_constraint.hpp"
 #include "storage/index/index_statistics.hpp"
 #include "storage/table_column_definition.hpp"
 #include "table_key_constraint.hpp"
@@ -18,6 +23,10 @@
 
 namespace opossum {
 
+class AbstractTableIndex;
+class ColumnGroupStatistics;
+class TableARTIndex;
+class TableHashIndex;
 class TableStatistics;
 
 /**
@@ -72,6 +81,17 @@ class Table : private Noncopyable {
   // This number includes invalidated (deleted) rows.
   uint64_t row_count() const;
 
+  /**
+   * Number of rows that were appended to the table (by append() or a committed Insert) and number of rows that were
+   * invalidated by a committed Delete. Both counters only grow. Unlike row_count(), they are read in constant time,
+   * so that components like the CardinalityFeedbackCache can cheaply tell by how much a table has changed. Rows added
+   * with append_chunk() or moved by reorganizing chunks (e.g., by the ChunkMerge) are not counted.
+   */
+  uint64_t inserted_row_count() const;
+  uint64_t invalidated_row_count() const;
+  void increase_inserted_row_count(uint64_t count) const;
+  void increase_invalidated_row_count(uint64_t count) const;
+
   /**
    * @return row_count() == 0
    */
@@ -112,8 +132,49 @@ class Table : private Noncopyable {
   void append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data = nullptr,
                     const std::optional<PolymorphicAllocator<Chunk>>& alloc = std::nullopt);
 
+  // Appends a chunk that was built beforehand. This allows callers to finalize the chunk and to set its pruning
+  // statistics and sort order before other threads can see it (see ChunkMerge).
+  void append_chunk(const std::shared_ptr<Chunk>& chunk);
+
   // Create and append a Chunk consisting of ValueSegments.
   void append_mutable_chunk();
+
+  /**
+   * Inserts do not all write to the same chunk. Each thread uses one of the table's insert lanes, which has its own
+   * mutable chunk (the lane's tail) and its own mutex. Thus, Inserts from different threads do not contend for the
+   * allocation of rows and write to different chunks. The number of lanes is limited, as each tail reserves memory for
+   * target_chunk_size rows. Tables without MVCC have no insert lanes.
+   *
+   * A lane's tail is only replaced once it is full: Operators that append immutable chunks (see ChunkMerge) do not end
+   * it. Otherwise, every merge would leave a partially filled chunk behind.
+   */
+  struct InsertLane {
+    std::mutex mutex;
+
+    // Only written while holding the mutex
+    std::atomic<ChunkID> tail_chunk_id{INVALID_CHUNK_ID};
+  };
+
+  // Returns the insert lane of the calling thread
+  InsertLane& insert_lane();
+
+  // Returns the ID of the lane's tail. If the lane has no tail yet or its tail is full, the last chunk is used if it is
+  // a mutable chunk appended via append_chunk (e.g., by a loader) that no other lane writes to. Otherwise, a new
+  // mutable chunk is appended. Requires the lane's mutex.
+  ChunkID claim_mutable_tail(InsertLane& insert_lane);
+
+  // Locks the mutexes of all insert lanes. While they are held, no Insert allocates rows or registers with a chunk.
+  std::vector<std::unique_lock<std::mutex>> acquire_insert_lane_mutexes();
+
+  /**
+   * Returns the ID of the mutable chunk that the calling thread's Inserts write to, if any. Callers that rely on the
+   * result not changing need to hold the lane's mutex.
+   */
+  std::optional<ChunkID> mutable_tail_chunk_id() const;
+
+  // Returns the IDs of the mutable chunks that Inserts write to, i.e., the tails of all lanes and the last chunk if it
+  // is mutable. Sorted by ChunkID.
+  std::vector<ChunkID> mutable_tail_chunk_ids() const;
   /** @} */
 
   /**
@@ -177,32 +238,105 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> table_statistics() const;
 
   void set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics);
+
+  // Statistics on the value combinations of a group of columns (see ColumnGroupStatistics). They are built when first
+  // requested and dropped when the table statistics are created anew, but not when they are updated incrementally.
+  std::shared_ptr<const ColumnGroupStatistics> column_group_statistics(const std::vector<ColumnID>& column_ids) const;
   /** @} */
 
   std::vector<IndexStatistics> indexes_statistics() const;
 
+  /**
+   * Creates an index of the given type on the given columns of each chunk. The chunks are indexed in parallel. Only
+   * immutable chunks are indexed, as rows appended later would be missing from the index. Except for BTreeIndexes
+   * and TrigramIndexes, the segments also have to be dictionary-encoded. Chunks that do not qualify yet are indexed
+   * once they do, i.e., when they are finalized by Table::append or encoded by the ChunkEncoder (see
+   * create_chunk_indexes).
+   *
+   * The index is built online, i.e., the table may be queried and modified meanwhile. Chunks that are added during the
+   * build are indexed as well. The index becomes visible in indexes_statistics() (and thus to the optimizer) only once
+   * the build is complete.
+   */
   template <typename Index>
   void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "") {
-    SegmentIndexType index_type = get_index_type_of<Index>();
+    _build_index(IndexStatistics{column_ids, name, get_index_type_of<Index>()});
+  }
 
-    const auto chunk_count = _chunks.size();
-    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-      auto chunk = std::atomic_load(&_chunks[chunk_id]);
-      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  // Creates the indexes of the table, including those that are currently built, on the given chunk. Has to be called
+  // whenever a chunk was finalized, encoded, or replaced after the indexes were created, unless this happened through
+  // Table::append or the ChunkEncoder, which call it themselves. Indexes for which the chunk already has an index of
+  // the same type on the same columns are skipped.
+  void create_chunk_indexes(const ChunkID chunk_id);
 
-      chunk->create_index<Index>(column_ids);
-    }
-    IndexStatistics index_statistics = {column_ids, name, index_type};
-    _indexes.emplace_back(index_statistics);
-  }
+  // Registers an index that was created on individual chunks (see Chunk::create_index) so that the optimizer
+  // considers it. Unlike create_index, this is safe while the table is used by queries.
+  void add_index_statistics(const IndexStatistics& index_statistics);
+
+  // Removes the statistics and the chunk indexes of the given type on exactly the given columns. Running operators
+  // keep the indexes they already hold alive. IndexScans that do not find an index scan the chunk instead.
+  void drop_index(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type);
 
   /**
-   * NOTE: Key constraints are currently NOT ENFORCED and are only used to develop optimization rules.
-   * We call them "soft" key constraints to draw attention to that.
+   * Table-wide indexes (see AbstractTableIndex) cover all chunks of the table, including mutable ones. Once created,
+   * they are maintained by the operators that modify the table (e.g., Insert and Delete). Unlike for create_index,
+   * the table must not be modified while the index is created. TableHashIndexes answer equality predicates on one or
+   * more columns, TableARTIndexes answer range predicates on a single column. If included columns are given, the
+   * index stores their values as well and is used for index-only scans (see IndexOnlyScan).
+   */
+  std::shared_ptr<TableHashIndex> create_table_hash_index(const std::vector<ColumnID>& column_ids,
+                                                          const std::string& name = "",
+                                                          const std::vector<ColumnID>& included_column_ids = {});
+  std::shared_ptr<TableARTIndex> create_table_art_index(const ColumnID column_id, const std::string& name = "",
+                                                        const std::vector<ColumnID>& included_column_ids = {});
+
+  // Registers an index that was created for a table with the same chunks (e.g., used by GetTable). If columns were
+  // pruned, column_ids are the ColumnIDs of the indexed columns in this table.
+  void add_table_index(const std::shared_ptr<AbstractTableIndex>& table_index,
+                       const std::optional<std::vector<ColumnID>>& column_ids = std::nullopt);
+
+  // If this table only contains some of the chunks of the table the registered indexes were created for, chunk_ids maps
+  // the ChunkIDs of that table to the ChunkIDs of this table (INVALID_CHUNK_ID for chunks that are not part of it).
+  // Has to be set before the table is used.
+  void set_table_index_chunk_ids(std::vector<ChunkID> chunk_ids);
+
+  // Maps the RowIDs returned by a lookup in one of the table-wide indexes to the chunks of this table and removes those
+  // of chunks that are not part of it (see set_table_index_chunk_ids).
+  void map_table_index_row_ids(std::vector<RowID>& row_ids) const;
+
+  // Return nullptr if there is no such index on exactly the given columns (of this table)
+  std::shared_ptr<TableHashIndex> get_table_hash_index(const std::vector<ColumnID>& column_ids) const;
+  std::shared_ptr<TableARTIndex> get_table_art_index(const ColumnID column_id) const;
+
+  std::vector<std::shared_ptr<AbstractTableIndex>> table_indexes() const;
+
+  /**
+   * NOTE: Soft key constraints are NOT ENFORCED and are only used to develop optimization rules.
+   * We call them "soft" key constraints to draw attention to that. For enforced constraints, see add_key_constraint.
    */
   void add_soft_key_constraint(const TableKeyConstraint& table_key_constraint);
   const TableKeyConstraints& soft_key_constraints() const;
 
+  /**
+   * Adds a key constraint that is ENFORCED: Insert (and thus Update) fails if a new row has the same values as another
+   * row that was not deleted, including rows of concurrent transactions that are not committed yet. Each enforced
+   * constraint is backed by a TableHashIndex on its columns, which is created if it does not exist yet. The existing
+   * rows have to satisfy the constraint. As for create_table_hash_index, the table must not be modified meanwhile.
+   *
+   * The constraint is registered as a soft key constraint as well, so that the optimizer can make use of it. Note that
+   * Table::append bypasses the checks.
+   */
+  void add_key_constraint(const TableKeyConstraint& table_key_constraint);
+
+  // The indexes that back the enforced key constraints, one per constraint
+  std::vector<std::shared_ptr<TableHashIndex>> key_constraint_indexes() const;
+
+  /**
+   * NOTE: Like soft key constraints, soft foreign key constraints are NOT ENFORCED. They are used by the
+   * CardinalityEstimator to estimate joins between foreign keys and the keys they reference.
+   */
+  void add_soft_foreign_key_constraint(const ForeignKeyConstraint& foreign_key_constraint);
+  const ForeignKeyConstraints& soft_foreign_key_constraints() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -221,7 +355,46 @@ class Table : private Noncopyable {
   const std::vector<ColumnID>& value_clustered_by() const;
   void set_value_clustered_by(const std::vector<ColumnID>& value_clustered_by);
 
+  /**
+   * Columns whose immutable chunks share a single dictionary (see ChunkEncoder::encode_column_with_shared_dictionary).
+   * Chunks that are encoded later are attached to the shared dictionary (see
+   * ChunkEncoder::attach_to_shared_dictionaries).
+   */
+  std::vector<ColumnID> shared_dictionary_column_ids() const;
+  void add_shared_dictionary_column(const ColumnID column_id);
+
+  // Serializes the maintenance of the table's shared dictionaries. Otherwise, chunks that are encoded concurrently
+  // (e.g., by the ChunkMaintenancePlugin) could build two different shared dictionaries for the same column.
+  std::unique_lock<std::mutex> acquire_shared_dictionary_mutex();
+
  protected:
+  struct PendingIndexBuild {
+    IndexStatistics index_statistics;
+
+    // Chunks passed to create_chunk_indexes during the build
+    std::vector<ChunkID> chunk_ids;
+  };
+
+  // Returns the index of the calling thread's insert lane. Requires the table to have insert lanes.
+  size_t _insert_lane_index() const;
+
+  // Implements create_index
+  void _build_index(const IndexStatistics& index_statistics);
+
+  // Creates the index on the chunk unless it already has an index of the same type on the same segments, which is
+  // returned instead. Returns nullptr if the chunk cannot be indexed (yet).
+  std::shared_ptr<AbstractIndex> _create_chunk_index(Chunk& chunk, const IndexStatistics& index_statistics);
+
+  // Creates a TableHashIndex on the given columns and adds all rows to it, without registering it
+  std::shared_ptr<TableHashIndex> _build_table_hash_index(const std::vector<ColumnID>& column_ids,
+                                                          const std::vector<ColumnID>& included_column_ids = {}) const;
+
+  void _insert_all_rows(AbstractTableIndex& table_index) const;
+
+  // Returns the table index of the given type on exactly the given columns of this table. Requires _indexes_mutex.
+  std::shared_ptr<AbstractTableIndex> _find_table_index(const SegmentIndexType type,
+                                                        const std::vector<ColumnID>& column_ids) const;
+
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
   const UseMvcc _use_mvcc;
@@ -239,11 +412,27 @@ class Table : private Noncopyable {
   tbb::concurrent_vector<std::shared_ptr<Chunk>, tbb::zero_allocator<std::shared_ptr<Chunk>>> _chunks;
 
   TableKeyConstraints _table_key_constraints;
+  ForeignKeyConstraints _foreign_key_constraints;
 
   std::vector<ColumnID> _value_clustered_by;
   std::shared_ptr<TableStatistics> _table_statistics;
+  mutable std::map<std::vector<ColumnID>, std::shared_ptr<const ColumnGroupStatistics>> _column_group_statistics;
+  mutable std::mutex _column_group_statistics_mutex;
+  std::vector<ColumnID> _shared_dictionary_column_ids;
+  mutable std::mutex _shared_dictionary_column_ids_mutex;
+  std::unique_ptr<std::mutex> _shared_dictionary_mutex;
   std::unique_ptr<std::mutex> _append_mutex;
+  std::vector<InsertLane> _insert_lanes;
+  mutable std::atomic<uint64_t> _inserted_row_count{0};
+  mutable std::atomic<uint64_t> _invalidated_row_count{0};
   std::vector<IndexStatistics> _indexes;
+  std::list<PendingIndexBuild> _pending_index_builds;
+  mutable std::shared_mutex _indexes_mutex;
+  std::vector<std::shared_ptr<AbstractTableIndex>> _table_indexes;
+  // For each table index, the ColumnIDs of the indexed columns in this table (see add_table_index)
+  std::vector<std::vector<ColumnID>> _table_index_column_ids;
+  std::optional<std::vector<ChunkID>> _table_index_chunk_ids;
+  std::vector<std::shared_ptr<TableHashIndex>> _key_constraint_indexes;
 
   // For tables with _type==Reference, the row count will not vary. As such, there is no need to iterate over all
   // chunks more than once.
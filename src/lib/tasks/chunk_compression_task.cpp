@@ -42,16 +42,10 @@ void ChunkCompressionTask::_on_execute() {
 bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size) {
   if (chunk->size() != target_chunk_size) return false;
 
+  // Chunks that reached their target size do not receive new rows. Once no Insert operator is pending anymore (i.e.,
+  // all of them committed or rolled back), all begin_cids are final.
   const auto& mvcc_data = chunk->mvcc_data();
-
-  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < target_chunk_size; ++chunk_offset) {
-    // TODO(anybody) Reading the non-atomic begin_cid (which is written to in Insert without a write lock) is likely UB
-    //               When activating the ChunkCompressionTask, please look for a different means of determining whether
-    //               all Inserts to a Chunk finished.
-    if (mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) return false;
-  }
-
-  return true;
+  return !mvcc_data || mvcc_data->pending_inserts_count() == 0;
 }
 
 }  // namespace opossum
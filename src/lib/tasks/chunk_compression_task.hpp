@@ -24,8 +24,8 @@ class Chunk;
  * it does not touch the segments. However, inserting records while simultaneously
  * compressing the chunk leads to inconsistent state. Therefore only chunks where
  * all insertion has been completed may be compressed. In other words, they need to be
- * full and all of their end-cids must be smaller than infinity. This task calls
- * those chunks “completed”.
+ * full and no Insert operator may still be pending (i.e., neither committed nor
+ * rolled back, see MvccData::pending_inserts_count). This task calls those chunks “completed”.
  *
  * Note: Reference segments are not invalidated by this task because the order in which
  *       records are stored does not change.
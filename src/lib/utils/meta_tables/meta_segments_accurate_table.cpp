@@ -19,7 +19,10 @@ MetaSegmentsAccurateTable::MetaSegmentsAccurateTable()
                                                {"sequential_accesses", DataType::Long, false},
                                                {"monotonic_accesses", DataType::Long, false},
                                                {"random_accesses", DataType::Long, false},
-                                               {"dictionary_accesses", DataType::Long, false}}) {}
+                                               {"dictionary_accesses", DataType::Long, false},
+                                               {"is_resident", DataType::Int, false},
+                                               {"eviction_count", DataType::Long, false},
+                                               {"load_count", DataType::Long, false}}) {}
 
 const std::string& MetaSegmentsAccurateTable::name() const {
   static const auto name = std::string{"segments_accurate"};
@@ -16,11 +16,15 @@ void gather_segment_meta_data(const std::shared_ptr<Table>& meta_table, const Me
       if (!chunk) continue;  // Skip physically deleted chunks
 
       for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
-        const auto& segment = chunk->get_segment(column_id);
+        // Evicted segments are not loaded for the sampled meta table (see Chunk::evict_segment). The residency is read
+        // after accessing the segment, which loads it for the accurate meta table.
+        const auto segment = mode == MemoryUsageCalculationMode::Full ? chunk->get_segment(column_id)
+                                                                       : chunk->get_resident_segment(column_id);
+        const auto residency = chunk->segment_residency(column_id);
 
         const auto data_type = pmr_string{data_type_to_string.left.at(table->column_data_type(column_id))};
 
-        const auto estimated_size = segment->memory_usage(mode);
+        const auto estimated_size = segment ? segment->memory_usage(mode) : size_t{0};
         AllTypeVariant encoding = NULL_VALUE;
         AllTypeVariant vector_compression = NULL_VALUE;
         if (const auto& encoded_segment = std::dynamic_pointer_cast<AbstractEncodedSegment>(segment)) {
@@ -33,7 +37,7 @@ void gather_segment_meta_data(const std::shared_ptr<Table>& meta_table, const Me
           }
         }
 
-        const auto& access_counter = segment->access_counter;
+        const auto access_counter = segment ? segment->access_counter : SegmentAccessCounter{};
 
         if (mode == MemoryUsageCalculationMode::Full) {
           const auto distinct_value_count = static_cast<int64_t>(get_distinct_value_count(segment));
@@ -44,7 +48,10 @@ void gather_segment_meta_data(const std::shared_ptr<Table>& meta_table, const Me
                               static_cast<int64_t>(access_counter[SegmentAccessCounter::AccessType::Sequential]),
                               static_cast<int64_t>(access_counter[SegmentAccessCounter::AccessType::Monotonic]),
                               static_cast<int64_t>(access_counter[SegmentAccessCounter::AccessType::Random]),
-                              static_cast<int64_t>(access_counter[SegmentAccessCounter::AccessType::Dictionary])});
+                              static_cast<int64_t>(access_counter[SegmentAccessCounter::AccessType::Dictionary]),
+                              static_cast<int32_t>(residency.is_resident),
+                              static_cast<int64_t>(residency.eviction_count),
+                              static_cast<int64_t>(residency.load_count)});
         } else {
           meta_table->append({pmr_string{table_name}, static_cast<int32_t>(chunk_id), static_cast<int32_t>(column_id),
                               pmr_string{table->column_name(column_id)}, data_type, encoding, vector_compression,
@@ -53,7 +60,10 @@ void gather_segment_meta_data(const std::shared_ptr<Table>& meta_table, const Me
                               static_cast<int64_t>(access_counter[SegmentAccessCounter::AccessType::Sequential]),
                               static_cast<int64_t>(access_counter[SegmentAccessCounter::AccessType::Monotonic]),
                               static_cast<int64_t>(access_counter[SegmentAccessCounter::AccessType::Random]),
-                              static_cast<int64_t>(access_counter[SegmentAccessCounter::AccessType::Dictionary])});
+                              static_cast<int64_t>(access_counter[SegmentAccessCounter::AccessType::Dictionary]),
+                              static_cast<int32_t>(residency.is_resident),
+                              static_cast<int64_t>(residency.eviction_count),
+                              static_cast<int64_t>(residency.load_count)});
         }
       }
     }
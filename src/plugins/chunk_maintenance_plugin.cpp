@@ -0,0 +1,253 @@
+#include "chunk_maintenance_plugin.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include "operators/chunk_merge.hpp"
+#include "operators/get_table.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/abstract_table_index.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::string ChunkMaintenancePlugin::description() const { return "Chunk finalization and encoding plugin"; }
+
+void ChunkMaintenancePlugin::start() {
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY_MAINTENANCE, [&](size_t) { _maintenance_loop(); });
+}
+
+void ChunkMaintenancePlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+  std::queue<TableAndChunkID> empty;
+  std::swap(_physical_delete_queue, empty);
+}
+
+void ChunkMaintenancePlugin::_maintenance_loop() {
+  const auto tables = Hyrise::get().storage_manager.tables();
+
+  for (const auto& [table_name, table] : tables) {
+    if (table->empty() || table->uses_mvcc() != UseMvcc::Yes) continue;
+
+    _erase_obsolete_index_entries(table);
+
+    const auto finalized_chunk_ids = _finalize_completed_chunks(table);
+    if (finalized_chunk_ids.empty()) continue;
+
+    // Merge the finalized chunks into the table's statistics. Merged chunks contain the same rows and are not added.
+    const auto table_statistics = table->table_statistics();
+    if (table_statistics) {
+      table->set_table_statistics(table_statistics->updated(*table, finalized_chunk_ids));
+    }
+
+    std::ostringstream message;
+    if (_merge_chunks(table_name, finalized_chunk_ids)) {
+      std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
+      for (const auto chunk_id : finalized_chunk_ids) {
+        _physical_delete_queue.emplace(table, chunk_id);
+      }
+      message << "Merged " << finalized_chunk_ids.size() << " chunk(s) of " << table_name;
+    } else {
+      // The merge conflicted with a concurrent transaction. We still encode the chunks, so that they do not remain
+      // unencoded until the next run.
+      _encode_chunks(table, finalized_chunk_ids);
+      message << "Finalized and encoded " << finalized_chunk_ids.size() << " chunk(s) of " << table_name;
+    }
+
+    // New chunks whose values are not part of a shared dictionary keep their own dictionaries (see
+    // ChunkEncoder::attach_to_shared_dictionaries). We build new shared dictionaries once per run.
+    ChunkEncoder::rebuild_shared_dictionaries(table);
+    Hyrise::get().log_manager.add_message("ChunkMaintenancePlugin", message.str(), LogLevel::Info);
+  }
+
+  _physical_delete();
+}
+
+std::vector<ChunkID> ChunkMaintenancePlugin::_finalize_completed_chunks(const std::shared_ptr<Table>& table) {
+  auto finalized_chunk_ids = std::vector<ChunkID>{};
+
+  // Inserts allocate their rows while holding the mutex of their insert lane. By holding all of them, we make sure
+  // that no Insert registers itself for one of the chunks between our check and the call to finalize().
+  const auto insert_lane_locks = table->acquire_insert_lane_mutexes();
+
+  // Inserts only write to the tails of the insert lanes, which stay the same when merged chunks are appended. Thus,
+  // other mutable chunks are completed as well, even if they are not full.
+  const auto target_chunk_size = table->target_chunk_size();
+  const auto mutable_tail_chunk_ids = table->mutable_tail_chunk_ids();
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk || !chunk->is_mutable() || chunk->size() == 0) continue;
+    if (chunk->size() < target_chunk_size &&
+        std::binary_search(mutable_tail_chunk_ids.begin(), mutable_tail_chunk_ids.end(), chunk_id)) {
+      continue;
+    }
+
+    if (chunk->mvcc_data()->pending_inserts_count() > 0) continue;
+
+    chunk->finalize();
+    finalized_chunk_ids.emplace_back(chunk_id);
+  }
+
+  return finalized_chunk_ids;
+}
+
+void ChunkMaintenancePlugin::_erase_obsolete_index_entries(const std::shared_ptr<Table>& table) {
+  const auto table_indexes = table->table_indexes();
+  if (table_indexes.empty()) return;
+
+  const auto& transaction_manager = Hyrise::get().transaction_manager;
+  const auto lowest_snapshot_commit_id =
+      transaction_manager.get_lowest_active_snapshot_commit_id().value_or(transaction_manager.last_commit_id());
+  for (const auto& table_index : table_indexes) {
+    table_index->erase_obsolete_entries(lowest_snapshot_commit_id);
+  }
+}
+
+bool ChunkMaintenancePlugin::_merge_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+
+  // Exclude all other chunks of the table from the GetTable operator. chunk_ids is sorted.
+  auto excluded_chunk_ids = std::vector<ChunkID>{};
+  auto chunk_ids_iter = chunk_ids.begin();
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (chunk_ids_iter != chunk_ids.end() && *chunk_ids_iter == chunk_id) {
+      ++chunk_ids_iter;
+      continue;
+    }
+    excluded_chunk_ids.emplace_back(chunk_id);
+  }
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  // An Insert deregisters itself from the chunk before its commit id becomes visible to new transactions. If our
+  // snapshot does not include all rows of the chunks yet, they would be lost by the merge.
+  for (const auto chunk_id : chunk_ids) {
+    if (*table->get_chunk(chunk_id)->mvcc_data()->max_begin_cid > transaction_context->snapshot_commit_id()) {
+      transaction_context->rollback(RollbackReason::Conflict);
+      return false;
+    }
+  }
+
+  auto get_table = std::make_shared<GetTable>(table_name, excluded_chunk_ids, std::vector<ColumnID>());
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+
+  auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  auto chunk_merge = std::make_shared<ChunkMerge>(table_name, validate, _primary_key_sort_definitions(table),
+                                                  _chunk_encoding_spec(table));
+  chunk_merge->set_transaction_context(transaction_context);
+  chunk_merge->execute();
+
+  if (chunk_merge->execute_failed()) {
+    // Transaction conflict. Usually, the OperatorTask would call rollback, but as we executed ChunkMerge directly, that
+    // is our job.
+    transaction_context->rollback(RollbackReason::Conflict);
+    return false;
+  }
+
+  transaction_context->commit();
+
+  // Mark the original chunks as logically deleted. Their rows are not visible for transactions with a snapshot after
+  // the merge anymore.
+  for (const auto chunk_id : chunk_ids) {
+    table->get_chunk(chunk_id)->set_cleanup_commit_id(transaction_context->commit_id());
+  }
+
+  return true;
+}
+
+void ChunkMaintenancePlugin::_physical_delete() {
+  std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
+
+  const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+  while (!_physical_delete_queue.empty()) {
+    const auto& [table, chunk_id] = _physical_delete_queue.front();
+    const auto chunk = table->get_chunk(chunk_id);
+    DebugAssert(chunk && chunk->get_cleanup_commit_id(), "Chunk needs to be merged before deleting it physically.");
+
+    // Check whether there are still active transactions that might use the chunk. The queue is ordered by cleanup
+    // commit id, so we can stop at the first chunk that is still in use.
+    if (lowest_snapshot_commit_id && *chunk->get_cleanup_commit_id() > *lowest_snapshot_commit_id) break;
+
+    table->remove_chunk(chunk_id);
+    _physical_delete_queue.pop();
+  }
+}
+
+void ChunkMaintenancePlugin::_encode_chunks(const std::shared_ptr<Table>& table,
+                                            const std::vector<ChunkID>& chunk_ids) {
+  const auto column_data_types = table->column_data_types();
+  const auto chunk_encoding_spec = _chunk_encoding_spec(table);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_ids.size());
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+      // ChunkEncoder::encode_chunk also generates the chunk's pruning statistics.
+      ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_encoding_spec);
+      ChunkEncoder::attach_to_shared_dictionaries(table, chunk_id);
+
+      // Most indexes require encoded segments, so the chunk could not be indexed before
+      table->create_chunk_indexes(chunk_id);
+    }));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+ChunkEncodingSpec ChunkMaintenancePlugin::_chunk_encoding_spec(const std::shared_ptr<Table>& table) {
+  auto chunk_encoding_spec = ChunkEncodingSpec{table->column_count(), SegmentEncodingSpec{}};
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable()) continue;
+
+    const auto column_count = chunk->column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto segment_encoding_spec = get_segment_encoding_spec(chunk->get_segment(column_id));
+      if (segment_encoding_spec.encoding_type != EncodingType::Unencoded) {
+        chunk_encoding_spec[column_id] = segment_encoding_spec;
+      }
+    }
+    break;
+  }
+
+  return chunk_encoding_spec;
+}
+
+std::vector<SortColumnDefinition> ChunkMaintenancePlugin::_primary_key_sort_definitions(
+    const std::shared_ptr<Table>& table) {
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+
+  for (const auto& key_constraint : table->soft_key_constraints()) {
+    if (key_constraint.key_type() != KeyConstraintType::PRIMARY_KEY) continue;
+
+    auto column_ids = std::vector<ColumnID>(key_constraint.columns().begin(), key_constraint.columns().end());
+    std::sort(column_ids.begin(), column_ids.end());
+    for (const auto column_id : column_ids) {
+      sort_definitions.emplace_back(column_id, SortMode::Ascending);
+    }
+    break;
+  }
+
+  return sort_definitions;
+}
+
+EXPORT_PLUGIN(ChunkMaintenancePlugin)
+
+}  // namespace opossum
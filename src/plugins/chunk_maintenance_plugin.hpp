@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/chunk.hpp"
+#include "storage/encoding_type.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+class Table;
+
+/*
+ * Chunks created by the Insert operator are mutable and store their data in ValueSegments. Without further action,
+ * they stay that way: they are not finalized, have no pruning statistics, do not benefit from the max_begin_cid
+ * shortcut in the Validate operator, and are not encoded. This plugin periodically looks for chunks that have reached
+ * the table's target chunk size (or are not the tail of an insert lane anymore) and whose Inserts have all committed or
+ * rolled back (see MvccData::pending_inserts_count). These chunks are finalized, and, as a second step, processed in
+ * the background:
+ *
+ *  - The finalized chunks form the write-optimized delta of the table. Their visible rows are merged into the
+ *    read-optimized main part of the table using the ChunkMerge operator, i.e., they are sorted by the primary key (if
+ *    the table has one), written to new chunks of the target chunk size, and encoded. Once no transaction can see the
+ *    original chunks anymore, they are removed physically (as done by the MvccDeletePlugin). The partially filled
+ *    tails of the insert lanes are left alone until they are full (see Table::InsertLane).
+ *  - If the merge conflicts with a concurrent transaction, the chunks are encoded in place and equipped with pruning
+ *    statistics instead. Encoding atomically replaces the segments of a chunk (see ChunkCompressionTask). Thus,
+ *    concurrent readers are not blocked and can continue to use the segments they already hold.
+ *
+ * Furthermore, rows that were deleted are removed from the table-wide indexes once no transaction can see them anymore
+ * (see AbstractTableIndex::erase_obsolete_entries). Otherwise, they would stay in the indexes until the next Delete.
+ *
+ * Each thread inserts into the tail of its own insert lane, so concurrent Inserts do not contend for the same chunk.
+ * The rows are stored in ValueSegments, which scans read together with the main part.
+ */
+class ChunkMaintenancePlugin : public AbstractPlugin {
+  friend class ChunkMaintenancePluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * IDLE_DELAY_MAINTENANCE: sleep after each run over all tables
+   */
+  constexpr static std::chrono::milliseconds IDLE_DELAY_MAINTENANCE = std::chrono::milliseconds(1000);
+
+ private:
+  void _maintenance_loop();
+
+  using TableAndChunkID = std::pair<const std::shared_ptr<Table>, ChunkID>;
+
+  // Finalizes all chunks of the table that are not written to by Inserts anymore. Returns their IDs.
+  static std::vector<ChunkID> _finalize_completed_chunks(const std::shared_ptr<Table>& table);
+
+  // Removes the rows that no active transaction can see anymore from the table-wide indexes of the table
+  static void _erase_obsolete_index_entries(const std::shared_ptr<Table>& table);
+
+  // Merges the given chunks into new chunks sorted by the table's primary key (if any) within a single transaction. If
+  // the merge succeeds, the original chunks are marked for cleanup and true is returned.
+  static bool _merge_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+
+  // Removes merged chunks once no active transaction can see them anymore
+  void _physical_delete();
+
+  // Encodes the given chunks (which also generates their pruning statistics). For each column, the encoding of the
+  // table's first chunk is used if that chunk is encoded. Otherwise, the default encoding is used.
+  static void _encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids);
+
+  static ChunkEncodingSpec _chunk_encoding_spec(const std::shared_ptr<Table>& table);
+
+  // Primary key columns in ascending order of their ColumnIDs, empty if the table has no primary key
+  static std::vector<SortColumnDefinition> _primary_key_sort_definitions(const std::shared_ptr<Table>& table);
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+
+  std::mutex _mutex_physical_delete_queue;
+  std::queue<TableAndChunkID> _physical_delete_queue;
+};
+
+}  // namespace opossum
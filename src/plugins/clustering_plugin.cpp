@@ -0,0 +1,324 @@
+#include "clustering_plugin.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <unordered_set>
+
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/chunk_merge.hpp"
+#include "operators/get_table.hpp"
+#include "operators/operator_scan_predicate.hpp"
+#include "operators/pqp_utils.hpp"
+#include "operators/validate.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::string ClusteringPlugin::description() const { return "Table clustering plugin"; }
+
+void ClusteringPlugin::start() {
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY_CLUSTERING, [&](size_t) {
+    _update_scores();
+    _select_clustering_columns();
+    if (!_cluster_tables()) return;
+
+    // Cached plans were optimized with the pruning statistics of the original chunks
+    if (Hyrise::get().default_pqp_cache) Hyrise::get().default_pqp_cache->clear();
+    if (Hyrise::get().default_lqp_cache) Hyrise::get().default_lqp_cache->clear();
+    _query_frequencies.clear();
+  });
+}
+
+void ClusteringPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+
+  // Chunks that were not removed yet remain in the tables. As they have a cleanup commit id, they are not visible for
+  // new transactions.
+  std::queue<std::pair<std::shared_ptr<Table>, ChunkID>> empty;
+  std::swap(_physical_delete_queue, empty);
+}
+
+void ClusteringPlugin::_update_scores() {
+  for (auto& [clustering_key, score] : _scores) {
+    score *= SCORE_DECAY;
+  }
+
+  const auto& pqp_cache = Hyrise::get().default_pqp_cache;
+  if (!pqp_cache) return;
+
+  auto query_frequencies = std::unordered_map<std::string, size_t>{};
+  for (const auto& [query, entry] : pqp_cache->snapshot()) {
+    if (!entry.frequency) continue;
+    const auto frequency = *entry.frequency;
+    query_frequencies.emplace(query, frequency);
+
+    // If the query was evicted from the cache and added again, its frequency was reset
+    const auto previous_frequency_iter = _query_frequencies.find(query);
+    const auto previous_frequency =
+        previous_frequency_iter != _query_frequencies.end() && previous_frequency_iter->second <= frequency
+            ? previous_frequency_iter->second
+            : size_t{0};
+    const auto execution_count = frequency - previous_frequency;
+    if (execution_count == 0) continue;
+
+    for (const auto& [clustering_key, benefit] : _pruning_benefits(entry.value)) {
+      _scores[clustering_key] += static_cast<double>(execution_count) * benefit;
+    }
+  }
+
+  _query_frequencies = std::move(query_frequencies);
+}
+
+void ClusteringPlugin::_select_clustering_columns() {
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  auto best_keys = std::map<std::string, std::pair<ColumnID, double>>{};
+  for (auto score_iter = _scores.begin(); score_iter != _scores.end();) {
+    const auto& [clustering_key, score] = *score_iter;
+    const auto& [table_name, column_id] = clustering_key;
+
+    // Forget about scores that have decayed and about dropped tables. The score of a clustering column is kept, as
+    // it is needed to decide whether another column is considerably better.
+    const auto is_clustering_column = _clustering_columns.contains(table_name) &&
+                                      _clustering_columns.at(table_name) == column_id;
+    if ((score < MIN_SCORE && !is_clustering_column) || !storage_manager.has_table(table_name)) {
+      score_iter = _scores.erase(score_iter);
+      continue;
+    }
+
+    const auto best_key_iter = best_keys.find(table_name);
+    if (score >= MIN_SCORE && (best_key_iter == best_keys.end() || score > best_key_iter->second.second)) {
+      best_keys[table_name] = {column_id, score};
+    }
+    ++score_iter;
+  }
+
+  std::erase_if(_clustering_columns,
+                [&](const auto& clustering_column) { return !storage_manager.has_table(clustering_column.first); });
+
+  for (const auto& [table_name, best_key] : best_keys) {
+    const auto& [column_id, score] = best_key;
+    const auto clustering_column_iter = _clustering_columns.find(table_name);
+    if (clustering_column_iter == _clustering_columns.end()) {
+      _clustering_columns.emplace(table_name, column_id);
+      continue;
+    }
+
+    const auto current_score_iter = _scores.find({table_name, clustering_column_iter->second});
+    const auto current_score = current_score_iter != _scores.end() ? current_score_iter->second : 0.0;
+    if (score > current_score * CLUSTERING_SWITCH_FACTOR) {
+      clustering_column_iter->second = column_id;
+    }
+  }
+}
+
+bool ClusteringPlugin::_cluster_tables() {
+  auto& storage_manager = Hyrise::get().storage_manager;
+  auto tables_clustered = false;
+
+  for (const auto& [table_name, column_id] : _clustering_columns) {
+    if (!storage_manager.has_table(table_name)) continue;
+    const auto table = storage_manager.get_table(table_name);
+    if (table->uses_mvcc() != UseMvcc::Yes) continue;
+
+    const auto chunk_ids = _chunks_to_cluster(*table, column_id);
+    if (chunk_ids.empty() || !_cluster_chunks(table_name, chunk_ids, column_id)) continue;
+
+    for (const auto chunk_id : chunk_ids) {
+      _physical_delete_queue.emplace(table, chunk_id);
+    }
+    tables_clustered = true;
+
+    std::ostringstream message;
+    message << "Clustered " << chunk_ids.size() << " chunk(s) of " << table_name << " by "
+            << table->column_name(column_id);
+    Hyrise::get().log_manager.add_message("ClusteringPlugin", message.str(), LogLevel::Info);
+  }
+
+  _physical_delete();
+  return tables_clustered;
+}
+
+std::map<ClusteringPlugin::ClusteringKey, double> ClusteringPlugin::_pruning_benefits(
+    const std::shared_ptr<const AbstractOperator>& pqp) {
+  auto predicate_nodes = std::unordered_set<std::shared_ptr<const AbstractLQPNode>>{};
+  visit_pqp(pqp, [&](const auto& op) {
+    if (op->lqp_node && op->lqp_node->type == LQPNodeType::Predicate) {
+      predicate_nodes.emplace(op->lqp_node);
+    }
+    return PQPVisitation::VisitInputs;
+  });
+
+  auto benefits = std::map<ClusteringKey, double>{};
+  const auto cardinality_estimator = CardinalityEstimator{};
+  for (const auto& node : predicate_nodes) {
+    // The ChunkPruningRule uses all predicates that are (transitively) placed on a StoredTableNode, optionally above a
+    // ValidateNode.
+    auto stored_table_node = node->left_input();
+    while (stored_table_node &&
+           (stored_table_node->type == LQPNodeType::Predicate || stored_table_node->type == LQPNodeType::Validate)) {
+      stored_table_node = stored_table_node->left_input();
+    }
+    if (!stored_table_node || stored_table_node->type != LQPNodeType::StoredTable) continue;
+
+    const auto& predicate_node = static_cast<const PredicateNode&>(*node);
+    const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate_node.predicate(), *node);
+    if (!operator_predicates || operator_predicates->size() != 1) continue;
+
+    const auto& operator_predicate = operator_predicates->front();
+    if (is_column_id(operator_predicate.value)) continue;
+
+    switch (operator_predicate.predicate_condition) {
+      case PredicateCondition::Equals:
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+      case PredicateCondition::BetweenInclusive:
+      case PredicateCondition::BetweenLowerExclusive:
+      case PredicateCondition::BetweenUpperExclusive:
+      case PredicateCondition::BetweenExclusive:
+        break;
+      default:
+        continue;
+    }
+
+    const auto column_expression = std::dynamic_pointer_cast<const LQPColumnExpression>(
+        node->left_input()->output_expressions()[operator_predicate.column_id]);
+    if (!column_expression || column_expression->original_node.lock() != stored_table_node) continue;
+
+    const auto input_row_count = cardinality_estimator.estimate_cardinality(node->left_input());
+    if (input_row_count == 0.0f) continue;
+    const auto selectivity = cardinality_estimator.estimate_cardinality(node) / input_row_count;
+
+    // Rows of the stored table that do not have to be scanned if the chunks are clustered by the column
+    const auto stored_row_count = cardinality_estimator.estimate_cardinality(stored_table_node);
+    const auto& table_name = static_cast<const StoredTableNode&>(*stored_table_node).table_name;
+    benefits[{table_name, column_expression->original_column_id}] +=
+        static_cast<double>(stored_row_count * (1.0f - std::min(selectivity, 1.0f)));
+  }
+
+  return benefits;
+}
+
+std::vector<ChunkID> ClusteringPlugin::_chunks_to_cluster(const Table& table, const ColumnID column_id) {
+  const auto sorted_by = SortColumnDefinition{column_id, SortMode::Ascending};
+
+  auto chunk_ids = std::vector<ChunkID>{};
+  auto row_count = uint64_t{0};
+  auto scanned_value_count = uint64_t{0};
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable() || chunk->get_cleanup_commit_id() || chunk->size() == 0) continue;
+
+    const auto& individually_sorted_by = chunk->individually_sorted_by();
+    if (std::find(individually_sorted_by.cbegin(), individually_sorted_by.cend(), sorted_by) !=
+        individually_sorted_by.cend()) {
+      continue;
+    }
+
+    chunk_ids.emplace_back(chunk_id);
+    row_count += chunk->size();
+
+    // Segments that were evicted by the TieredStoragePlugin are cold and do not count as scanned
+    const auto segment = chunk->get_resident_segment(column_id);
+    if (!segment) continue;
+
+    const auto& access_counter = segment->access_counter;
+    scanned_value_count += access_counter[SegmentAccessCounter::AccessType::Sequential] +
+                           access_counter[SegmentAccessCounter::AccessType::Monotonic] +
+                           access_counter[SegmentAccessCounter::AccessType::Random];
+  }
+
+  if (static_cast<double>(scanned_value_count) < MIN_SCANS_PER_ROW * static_cast<double>(row_count)) return {};
+  return chunk_ids;
+}
+
+bool ClusteringPlugin::_cluster_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                       const ColumnID column_id) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+
+  // Exclude all other chunks of the table from the GetTable operator. chunk_ids is sorted.
+  auto excluded_chunk_ids = std::vector<ChunkID>{};
+  auto chunk_ids_iter = chunk_ids.begin();
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (chunk_ids_iter != chunk_ids.end() && *chunk_ids_iter == chunk_id) {
+      ++chunk_ids_iter;
+      continue;
+    }
+    excluded_chunk_ids.emplace_back(chunk_id);
+  }
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  // Rows whose Insert committed after our snapshot would be lost by the merge (see ChunkMaintenancePlugin)
+  for (const auto chunk_id : chunk_ids) {
+    if (*table->get_chunk(chunk_id)->mvcc_data()->max_begin_cid > transaction_context->snapshot_commit_id()) {
+      transaction_context->rollback(RollbackReason::Conflict);
+      return false;
+    }
+  }
+
+  // Keep the encoding of the clustered chunks
+  const auto first_chunk = table->get_chunk(chunk_ids.front());
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  const auto column_count = table->column_count();
+  for (auto segment_column_id = ColumnID{0}; segment_column_id < column_count; ++segment_column_id) {
+    chunk_encoding_spec.emplace_back(get_segment_encoding_spec(first_chunk->get_segment(segment_column_id)));
+  }
+
+  auto get_table = std::make_shared<GetTable>(table_name, excluded_chunk_ids, std::vector<ColumnID>());
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+
+  auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{column_id}};
+  auto chunk_merge = std::make_shared<ChunkMerge>(table_name, validate, sort_definitions, chunk_encoding_spec);
+  chunk_merge->set_transaction_context(transaction_context);
+  chunk_merge->execute();
+
+  if (chunk_merge->execute_failed()) {
+    // Transaction conflict. As we executed ChunkMerge directly, rolling back is our job.
+    transaction_context->rollback(RollbackReason::Conflict);
+    return false;
+  }
+
+  transaction_context->commit();
+
+  // The rows of the original chunks are not visible for transactions with a snapshot after the merge anymore
+  for (const auto chunk_id : chunk_ids) {
+    table->get_chunk(chunk_id)->set_cleanup_commit_id(transaction_context->commit_id());
+  }
+
+  return true;
+}
+
+void ClusteringPlugin::_physical_delete() {
+  const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+  while (!_physical_delete_queue.empty()) {
+    const auto& [table, chunk_id] = _physical_delete_queue.front();
+    const auto chunk = table->get_chunk(chunk_id);
+    DebugAssert(chunk && chunk->get_cleanup_commit_id(), "Chunk needs to be clustered before deleting it physically.");
+
+    // The queue is ordered by cleanup commit id, so we can stop at the first chunk that is still in use
+    if (lowest_snapshot_commit_id && *chunk->get_cleanup_commit_id() > *lowest_snapshot_commit_id) break;
+
+    table->remove_chunk(chunk_id);
+    _physical_delete_queue.pop();
+  }
+}
+
+EXPORT_PLUGIN(ClusteringPlugin)
+
+}  // namespace opossum
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/*
+ * Scans, the ChunkPruningRule, and the AggregateSort benefit from chunks that are sorted, and chunk pruning works best
+ * if the value ranges of the chunks do not overlap. Apart from importers and the Sort operator, nothing produces such
+ * chunks. This plugin periodically derives a clustering column for each table from the workload and rewrites the
+ * immutable chunks of the table so that they are sorted and range-partitioned on that column:
+ *
+ *  - For every query in the physical plan cache, it looks for predicates on stored tables that chunk pruning can use
+ *    (i.e., comparisons and BETWEEN with a value). Each (table, column) pair is scored with the number of rows that
+ *    perfectly clustered chunks would allow to prune, weighted by how often the query was executed since the last run.
+ *    Scores decay over time, as in the IndexTuningPlugin. The column with the highest score becomes the clustering
+ *    column of the table. To avoid rewriting the table back and forth, a table's clustering column is only replaced
+ *    by a column with a considerably higher score (see CLUSTERING_SWITCH_FACTOR).
+ *  - Rewriting chunks is expensive. The SegmentAccessCounters of the clustering column tell how often the chunks
+ *    were actually scanned. Chunks are only rewritten once they have been scanned about MIN_SCANS_PER_ROW times.
+ *  - The immutable chunks that are not sorted by the clustering column yet are merged into new chunks using the
+ *    ChunkMerge operator, which sorts the rows, writes them to chunks of the table's target chunk size, encodes them,
+ *    sets their sorted_by flag, and generates their pruning statistics. As all rows are sorted together, the new
+ *    chunks cover disjoint value ranges. The merge is performed within a transaction: If it conflicts with a
+ *    concurrent modification, it is retried in the next run. Once no transaction can see the original chunks
+ *    anymore, they are removed physically (as done by the ChunkMaintenancePlugin).
+ *
+ * Only one clustering column is chosen per table, since the chunks can only be range-partitioned on a single column.
+ * After tables were clustered, the plan caches are cleared, as cached plans prune the original chunks only.
+ */
+class ClusteringPlugin : public AbstractPlugin {
+  friend class ClusteringPluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * IDLE_DELAY_CLUSTERING: sleep after each run
+   * SCORE_DECAY: factor by which the scores are multiplied in each run. With the delay of one minute, a score halves
+   *              in about 69 minutes if the queries that contributed to it are not executed anymore.
+   * MIN_SCORE: a table is only clustered if this number of rows could have been pruned
+   * CLUSTERING_SWITCH_FACTOR: a new clustering column needs a score that is this much higher than the current one's
+   * MIN_SCANS_PER_ROW: chunks are rewritten once their clustering column was read this many times per row
+   */
+  constexpr static std::chrono::milliseconds IDLE_DELAY_CLUSTERING = std::chrono::milliseconds(60'000);
+  constexpr static double SCORE_DECAY = 0.99;
+  constexpr static double MIN_SCORE = 10'000.0;
+  constexpr static double CLUSTERING_SWITCH_FACTOR = 2.0;
+  constexpr static double MIN_SCANS_PER_ROW = 1.0;
+
+ private:
+  using ClusteringKey = std::pair<std::string, ColumnID>;
+
+  // Adds the benefit of the queries executed since the last run to the scores
+  void _update_scores();
+
+  // Chooses the clustering column of each table based on the scores
+  void _select_clustering_columns();
+
+  // Rewrites the unclustered chunks of all tables that have a clustering column. Returns whether any table was
+  // clustered.
+  bool _cluster_tables();
+
+  // Returns the number of rows that chunk pruning could skip when executing the given plan once on clustered tables
+  static std::map<ClusteringKey, double> _pruning_benefits(const std::shared_ptr<const AbstractOperator>& pqp);
+
+  // Returns the IDs of the immutable chunks that are not sorted by the column. If these chunks were not scanned often
+  // enough to justify the rewrite, no chunks are returned.
+  static std::vector<ChunkID> _chunks_to_cluster(const Table& table, const ColumnID column_id);
+
+  // Merges the given chunks into new chunks sorted by the column within a single transaction. If the merge succeeds,
+  // the original chunks are marked for cleanup and true is returned.
+  static bool _cluster_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                              const ColumnID column_id);
+
+  // Removes clustered chunks once no active transaction can see them anymore
+  void _physical_delete();
+
+  // Number of executions of the cached queries as of the last run
+  std::unordered_map<std::string, size_t> _query_frequencies;
+  std::map<ClusteringKey, double> _scores;
+  std::map<std::string, ColumnID> _clustering_columns;
+
+  std::queue<std::pair<std::shared_ptr<Table>, ChunkID>> _physical_delete_queue;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
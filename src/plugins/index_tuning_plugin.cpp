@@ -0,0 +1,269 @@
+#include "index_tuning_plugin.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <unordered_set>
+#include <vector>
+
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/operator_scan_predicate.hpp"
+#include "operators/pqp_utils.hpp"
+#include "optimizer/strategy/index_scan_rule.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+IndexTuningPlugin::MemoryBudgetSetting::MemoryBudgetSetting()
+    : AbstractSetting("IndexTuningPlugin.MemoryBudget"), _value(std::to_string(std::numeric_limits<size_t>::max())) {}
+
+const std::string& IndexTuningPlugin::MemoryBudgetSetting::description() const {
+  static const auto description = std::string{"Memory budget for automatically created indexes in bytes"};
+  return description;
+}
+
+const std::string& IndexTuningPlugin::MemoryBudgetSetting::get() { return _value; }
+
+void IndexTuningPlugin::MemoryBudgetSetting::set(const std::string& value) {
+  _memory_budget = std::stoull(value);
+  _value = value;
+}
+
+size_t IndexTuningPlugin::MemoryBudgetSetting::memory_budget() const { return _memory_budget; }
+
+std::string IndexTuningPlugin::description() const { return "Index tuning plugin"; }
+
+void IndexTuningPlugin::start() {
+  _memory_budget_setting = std::make_shared<MemoryBudgetSetting>();
+  _memory_budget_setting->register_at_settings_manager();
+
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY_INDEX_TUNING, [&](size_t) {
+    _update_scores();
+    if (!_tune_indexes(_memory_budget_setting->memory_budget())) return;
+
+    // Cached plans were optimized with the previous indexes
+    if (Hyrise::get().default_pqp_cache) Hyrise::get().default_pqp_cache->clear();
+    if (Hyrise::get().default_lqp_cache) Hyrise::get().default_lqp_cache->clear();
+    _query_frequencies.clear();
+
+    std::ostringstream message;
+    message << "Tuned indexes, now managing " << _managed_indexes.size() << " index(es)";
+    Hyrise::get().log_manager.add_message("IndexTuningPlugin", message.str(), LogLevel::Info);
+  });
+}
+
+void IndexTuningPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+  _memory_budget_setting->unregister_at_settings_manager();
+
+  // The created indexes remain, as queries might still use them.
+}
+
+void IndexTuningPlugin::_update_scores() {
+  for (auto& [index_key, score] : _scores) {
+    score *= SCORE_DECAY;
+  }
+
+  const auto& pqp_cache = Hyrise::get().default_pqp_cache;
+  if (!pqp_cache) return;
+
+  auto query_frequencies = std::unordered_map<std::string, size_t>{};
+  for (const auto& [query, entry] : pqp_cache->snapshot()) {
+    if (!entry.frequency) continue;
+    const auto frequency = *entry.frequency;
+    query_frequencies.emplace(query, frequency);
+
+    // If the query was evicted from the cache and added again, its frequency was reset
+    const auto previous_frequency_iter = _query_frequencies.find(query);
+    const auto previous_frequency =
+        previous_frequency_iter != _query_frequencies.end() && previous_frequency_iter->second <= frequency
+            ? previous_frequency_iter->second
+            : size_t{0};
+    const auto execution_count = frequency - previous_frequency;
+    if (execution_count == 0) continue;
+
+    for (const auto& [index_key, benefit] : _index_benefits(entry.value)) {
+      _scores[index_key] += static_cast<double>(execution_count) * benefit;
+    }
+  }
+
+  _query_frequencies = std::move(query_frequencies);
+}
+
+bool IndexTuningPlugin::_tune_indexes(const size_t memory_budget) {
+  struct IndexCandidate {
+    IndexKey index_key;
+    double score;
+    size_t memory_consumption;
+  };
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  auto candidates = std::vector<IndexCandidate>{};
+  for (auto score_iter = _scores.begin(); score_iter != _scores.end();) {
+    const auto& [index_key, score] = *score_iter;
+    const auto& [table_name, column_id] = index_key;
+
+    // Forget about scores that have decayed and about dropped tables
+    if ((score < MIN_SCORE && !_managed_indexes.contains(index_key)) || !storage_manager.has_table(table_name)) {
+      score_iter = _scores.erase(score_iter);
+      continue;
+    }
+
+    const auto table = storage_manager.get_table(table_name);
+    const auto indexes_statistics = table->indexes_statistics();
+    const auto user_index_exists = std::any_of(
+        indexes_statistics.cbegin(), indexes_statistics.cend(), [&](const auto& index_statistics) {
+          return index_statistics.column_ids == std::vector<ColumnID>{column_id} &&
+                 index_statistics.type == SegmentIndexType::GroupKey && !_managed_indexes.contains(index_key);
+        });
+
+    if (score >= MIN_SCORE && !user_index_exists) {
+      candidates.emplace_back(IndexCandidate{index_key, score, _estimate_memory_consumption(*table, column_id)});
+    }
+    ++score_iter;
+  }
+
+  // Prefer the indexes that save the most work per byte
+  std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.score / static_cast<double>(std::max(lhs.memory_consumption, size_t{1})) >
+           rhs.score / static_cast<double>(std::max(rhs.memory_consumption, size_t{1}));
+  });
+
+  auto selected_indexes = std::set<IndexKey>{};
+  auto memory_consumption = size_t{0};
+  for (const auto& candidate : candidates) {
+    if (candidate.memory_consumption > memory_budget - memory_consumption) continue;
+    memory_consumption += candidate.memory_consumption;
+    selected_indexes.emplace(candidate.index_key);
+  }
+
+  auto indexes_changed = false;
+
+  // Drop the indexes first so that the memory is available for the new ones
+  for (auto index_iter = _managed_indexes.begin(); index_iter != _managed_indexes.end();) {
+    const auto& [table_name, column_id] = *index_iter;
+    if (selected_indexes.contains(*index_iter)) {
+      ++index_iter;
+      continue;
+    }
+
+    if (storage_manager.has_table(table_name)) {
+      storage_manager.get_table(table_name)->drop_index({column_id}, SegmentIndexType::GroupKey);
+    }
+    index_iter = _managed_indexes.erase(index_iter);
+    indexes_changed = true;
+  }
+
+  // Create the selected indexes that do not exist yet. Table::create_index builds them on the chunks in parallel and
+  // registers them in the table's indexes statistics once they are complete. Afterwards, the table indexes chunks
+  // that are finalized or encoded later itself (see Table::create_chunk_indexes).
+  for (const auto& index_key : selected_indexes) {
+    if (_managed_indexes.contains(index_key)) continue;
+
+    const auto& [table_name, column_id] = index_key;
+    storage_manager.get_table(table_name)->create_index<GroupKeyIndex>({column_id}, "IndexTuningPlugin");
+    _managed_indexes.emplace(index_key);
+    indexes_changed = true;
+  }
+
+  return indexes_changed;
+}
+
+std::map<IndexTuningPlugin::IndexKey, double> IndexTuningPlugin::_index_benefits(
+    const std::shared_ptr<const AbstractOperator>& pqp) {
+  // Multiple operators (e.g., an IndexScan and a TableScan for the unindexed chunks) might share the same node
+  auto predicate_nodes = std::unordered_set<std::shared_ptr<const AbstractLQPNode>>{};
+  visit_pqp(pqp, [&](const auto& op) {
+    if (op->lqp_node && op->lqp_node->type == LQPNodeType::Predicate &&
+        op->lqp_node->left_input()->type == LQPNodeType::StoredTable) {
+      predicate_nodes.emplace(op->lqp_node);
+    }
+    return PQPVisitation::VisitInputs;
+  });
+
+  auto benefits = std::map<IndexKey, double>{};
+  const auto cardinality_estimator = CardinalityEstimator{};
+  for (const auto& node : predicate_nodes) {
+    const auto& predicate_node = static_cast<const PredicateNode&>(*node);
+    const auto stored_table_node = std::static_pointer_cast<const StoredTableNode>(node->left_input());
+
+    // Same restrictions as in the IndexScanRule
+    const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate_node.predicate(), *node);
+    if (!operator_predicates || operator_predicates->size() != 1) continue;
+
+    const auto& operator_predicate = operator_predicates->front();
+    if (is_column_id(operator_predicate.value)) continue;
+
+    switch (operator_predicate.predicate_condition) {
+      case PredicateCondition::Equals:
+      case PredicateCondition::NotEquals:
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+      case PredicateCondition::BetweenInclusive:
+      case PredicateCondition::BetweenLowerExclusive:
+      case PredicateCondition::BetweenUpperExclusive:
+      case PredicateCondition::BetweenExclusive:
+        break;
+      default:
+        continue;
+    }
+
+    const auto input_row_count = cardinality_estimator.estimate_cardinality(stored_table_node);
+    if (input_row_count < IndexScanRule::INDEX_SCAN_ROW_COUNT_THRESHOLD) continue;
+
+    const auto selectivity = cardinality_estimator.estimate_cardinality(node) / input_row_count;
+    if (selectivity > IndexScanRule::INDEX_SCAN_SELECTIVITY_THRESHOLD) continue;
+
+    const auto column_expression = std::dynamic_pointer_cast<const LQPColumnExpression>(
+        stored_table_node->output_expressions()[operator_predicate.column_id]);
+    if (!column_expression) continue;
+
+    // Rows that do not have to be scanned
+    benefits[{stored_table_node->table_name, column_expression->original_column_id}] +=
+        static_cast<double>(input_row_count * (1.0f - selectivity));
+  }
+
+  return benefits;
+}
+
+bool IndexTuningPlugin::_is_indexable(const Chunk& chunk, const ColumnID column_id) {
+  if (chunk.is_mutable() || chunk.get_cleanup_commit_id()) return false;
+
+  // Evicted segments (see TieredStoragePlugin) are dictionary-encoded as well, but we do not load them just to check
+  const auto segment = chunk.get_resident_segment(column_id);
+  return !segment || std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+}
+
+size_t IndexTuningPlugin::_estimate_memory_consumption(const Table& table, const ColumnID column_id) {
+  auto memory_consumption = size_t{0};
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || !_is_indexable(*chunk, column_id)) continue;
+
+    // Without the dictionary of an evicted segment, we assume that all values are distinct
+    const auto row_count = chunk->size();
+    const auto dictionary_segment =
+        std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_resident_segment(column_id));
+    const auto distinct_count = dictionary_segment ? dictionary_segment->unique_values_count() : row_count;
+
+    // GroupKeyIndexes store positions and ValueIDs, the size of the values is irrelevant
+    memory_consumption +=
+        AbstractIndex::estimate_memory_consumption(SegmentIndexType::GroupKey, row_count, distinct_count, 0);
+  }
+
+  return memory_consumption;
+}
+
+EXPORT_PLUGIN(IndexTuningPlugin)
+
+}  // namespace opossum
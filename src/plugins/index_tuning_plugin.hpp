@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "hyrise.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Chunk;
+class Table;
+
+/*
+ * Indexes speed up selective scans, but they cost memory and the optimizer only uses indexes that somebody created.
+ * This plugin periodically derives the indexes that are worth creating from the workload: For every query in the
+ * physical plan cache, it looks for predicates on stored tables that the IndexScanRule would turn into an IndexScan
+ * (i.e., single-column predicates with a low estimated selectivity on large tables). Each such (table, column) pair
+ * is scored with the number of rows an index would have saved to scan, weighted by how often the query was executed
+ * since the last run. Scores decay over time so that the chosen indexes follow a changing workload.
+ *
+ * The pairs with the highest score per estimated byte are selected greedily until a configurable memory budget
+ * (setting "IndexTuningPlugin.MemoryBudget", in bytes) is exhausted. GroupKeyIndexes are created on the selected
+ * columns via Table::create_index, which indexes the immutable dictionary-encoded chunks, and the indexes the plugin
+ * created earlier that are no longer selected are dropped. Indexes created by the user are never dropped. Indexes are
+ * built while queries keep running; IndexScans that were planned with an index that was dropped in the meantime scan
+ * the chunk instead.
+ * After the set of indexes changed, the plan caches are cleared so that the next queries are optimized with them.
+ *
+ * Join predicates are not considered, as the LQPTranslator does not use index joins.
+ *
+ * By default, the memory budget is unlimited.
+ */
+class IndexTuningPlugin : public AbstractPlugin {
+  friend class IndexTuningPluginTest;
+
+ public:
+  class MemoryBudgetSetting : public AbstractSetting {
+   public:
+    MemoryBudgetSetting();
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+    size_t memory_budget() const;
+
+   private:
+    std::string _value;
+    std::atomic<size_t> _memory_budget{std::numeric_limits<size_t>::max()};
+  };
+
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * IDLE_DELAY_INDEX_TUNING: sleep after each run
+   * SCORE_DECAY: factor by which the scores are multiplied in each run. With the delay of ten seconds, a score halves
+   *              in about 19 hours if the queries that contributed to it are not executed anymore.
+   * MIN_SCORE: an index is only kept if it would have saved scanning at least this number of rows
+   */
+  constexpr static std::chrono::milliseconds IDLE_DELAY_INDEX_TUNING = std::chrono::milliseconds(10'000);
+  constexpr static double SCORE_DECAY = 0.9999;
+  constexpr static double MIN_SCORE = 10'000.0;
+
+ private:
+  using IndexKey = std::pair<std::string, ColumnID>;
+
+  // Adds the benefit of the queries executed since the last run to the scores
+  void _update_scores();
+
+  // Selects the indexes within the memory budget, creates and drops indexes accordingly. Returns whether the set of
+  // indexes changed.
+  bool _tune_indexes(const size_t memory_budget);
+
+  // Returns the number of rows that indexes would save to scan when executing the given plan once
+  static std::map<IndexKey, double> _index_benefits(const std::shared_ptr<const AbstractOperator>& pqp);
+
+  static bool _is_indexable(const Chunk& chunk, const ColumnID column_id);
+  static size_t _estimate_memory_consumption(const Table& table, const ColumnID column_id);
+
+  // Number of executions of the cached queries as of the last run
+  std::unordered_map<std::string, size_t> _query_frequencies;
+  std::map<IndexKey, double> _scores;
+  std::set<IndexKey> _managed_indexes;
+
+  std::shared_ptr<MemoryBudgetSetting> _memory_budget_setting;
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
@@ -1,11 +1,15 @@
 #include "mvcc_delete_plugin.hpp"
 
+#include <algorithm>
+
+#include "operators/chunk_merge.hpp"
 #include "operators/get_table.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -41,9 +45,16 @@ void MvccDeletePlugin::_logical_delete_loop() {
     size_t saved_memory = 0;
     size_t num_chunks = 0;
 
-    // Check all chunks, except for the last one, which is currently used for insertions
-    const auto max_chunk_id = static_cast<ChunkID>(table->chunk_count() - 1);
-    for (auto chunk_id = ChunkID{0}; chunk_id < max_chunk_id; chunk_id++) {
+    // Immutable candidates are not reinserted one by one, but compacted together after all chunks have been checked
+    auto compaction_chunk_ids = std::vector<ChunkID>{};
+
+    // Check all chunks, except for the mutable tails, which are currently used for insertions. Tails only move
+    // towards the end of the table, so other chunks are not written to anymore.
+    const auto mutable_tail_chunk_ids = table->mutable_tail_chunk_ids();
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; chunk_id++) {
+      if (std::binary_search(mutable_tail_chunk_ids.begin(), mutable_tail_chunk_ids.end(), chunk_id)) continue;
+
       const auto& chunk = table->get_chunk(chunk_id);
       if (chunk && !chunk->get_cleanup_commit_id()) {
         const auto chunk_memory = chunk->memory_usage(MemoryUsageCalculationMode::Sampled);
@@ -73,6 +84,11 @@ void MvccDeletePlugin::_logical_delete_loop() {
           continue;
         }
 
+        if (!chunk->is_mutable()) {
+          compaction_chunk_ids.emplace_back(chunk_id);
+          continue;
+        }
+
         auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
         const bool success = _try_logical_delete(table_name, chunk_id, transaction_context);
 
@@ -87,6 +103,21 @@ void MvccDeletePlugin::_logical_delete_loop() {
         }
       }
     }
+
+    if (!compaction_chunk_ids.empty()) {
+      auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+      const auto compaction_saved_memory = _try_compaction(table_name, compaction_chunk_ids, transaction_context);
+
+      if (compaction_saved_memory) {
+        std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
+        for (const auto chunk_id : compaction_chunk_ids) {
+          _physical_delete_queue.emplace(table, chunk_id);
+        }
+        saved_memory += *compaction_saved_memory;
+        num_chunks += compaction_chunk_ids.size();
+      }
+    }
+
     if (saved_memory > 0) {
       std::ostringstream message;
       double saved_mb = static_cast<float>(saved_memory) / (1000.0 * 1000.0);
@@ -133,8 +164,9 @@ bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const
   const auto& chunk = table->get_chunk(chunk_id);
 
   Assert(chunk != nullptr, "Chunk does not exist. Logical Delete can not be applied.");
-  Assert(chunk_id < (table->chunk_count() - 1),
-         "MVCC Logical Delete should not be applied on the last/current mutable chunk.");
+  const auto mutable_tail_chunk_ids = table->mutable_tail_chunk_ids();
+  Assert(!std::binary_search(mutable_tail_chunk_ids.begin(), mutable_tail_chunk_ids.end(), chunk_id),
+         "MVCC Logical Delete should not be applied on a mutable chunk that is used for insertions.");
 
   // Create temporary referencing table that contains the given chunk only
   //   Include all ChunksIDs of current table except chunk_id for pruning in GetTable
@@ -171,6 +203,90 @@ bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const
   return true;
 }
 
+std::optional<size_t> MvccDeletePlugin::_try_compaction(
+    const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+    const std::shared_ptr<TransactionContext>& transaction_context) {
+  const auto& table = Hyrise::get().storage_manager.get_table(table_name);
+
+  Assert(!chunk_ids.empty() && std::is_sorted(chunk_ids.begin(), chunk_ids.end()), "Expected sorted ChunkIDs");
+
+  // Create temporary referencing table that contains the given chunks only
+  std::vector<ChunkID> excluded_chunk_ids;
+  auto chunk_ids_iter = chunk_ids.begin();
+  size_t sparse_memory = 0;
+  size_t sparse_row_count = 0;
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (chunk_ids_iter != chunk_ids.end() && *chunk_ids_iter == chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      Assert(chunk && !chunk->is_mutable(), "Only immutable chunks can be compacted.");
+      sparse_memory += chunk->memory_usage(MemoryUsageCalculationMode::Sampled);
+      sparse_row_count += chunk->size();
+      ++chunk_ids_iter;
+      continue;
+    }
+    excluded_chunk_ids.emplace_back(chunk_id);
+  }
+
+  // The compacted chunks use the encoding of the first chunk. If all chunks are sorted by the same column, the
+  // compacted chunks are sorted by it as well.
+  const auto& first_chunk = table->get_chunk(chunk_ids.front());
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    auto segment_encoding_spec = get_segment_encoding_spec(first_chunk->get_segment(column_id));
+    if (segment_encoding_spec.encoding_type == EncodingType::Unencoded) segment_encoding_spec = SegmentEncodingSpec{};
+    chunk_encoding_spec.emplace_back(segment_encoding_spec);
+  }
+
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  if (!first_chunk->individually_sorted_by().empty()) {
+    const auto sort_definition = first_chunk->individually_sorted_by().front();
+    const auto all_sorted = std::all_of(chunk_ids.begin(), chunk_ids.end(), [&](const auto chunk_id) {
+      const auto& sorted_by = table->get_chunk(chunk_id)->individually_sorted_by();
+      return std::find(sorted_by.begin(), sorted_by.end(), sort_definition) != sorted_by.end();
+    });
+    if (all_sorted) sort_definitions.emplace_back(sort_definition);
+  }
+
+  auto get_table = std::make_shared<GetTable>(table_name, excluded_chunk_ids, std::vector<ColumnID>());
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+
+  // Validate temporary table
+  auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  // Use ChunkMerge operator to delete the valid records and write them to new, compacted chunks. Rows that do not fill
+  // a complete chunk are inserted into the mutable tail, so that compaction does not leave a partial chunk behind.
+  auto chunk_merge = std::make_shared<ChunkMerge>(table_name, validate, sort_definitions, chunk_encoding_spec,
+                                                  MergeRemainder::InsertIntoTail);
+  chunk_merge->set_transaction_context(transaction_context);
+  chunk_merge->execute();
+
+  // Check for success
+  if (chunk_merge->execute_failed()) {
+    // Transaction conflict. Usually, the OperatorTask would call rollback, but as we executed ChunkMerge directly, that
+    // is our job.
+    transaction_context->rollback(RollbackReason::Conflict);
+    return std::nullopt;
+  }
+
+  transaction_context->commit();
+  // Mark chunks as logically deleted
+  for (const auto chunk_id : chunk_ids) {
+    table->get_chunk(chunk_id)->set_cleanup_commit_id(transaction_context->commit_id());
+  }
+
+  // The compacted rows still occupy memory in the new chunks and the mutable tail. For the latter, we assume the memory
+  // per row of the sparse chunks.
+  auto compacted_memory = chunk_merge->inserted_row_count() * sparse_memory / std::max(sparse_row_count, size_t{1});
+  for (const auto chunk_id : chunk_merge->merged_chunk_ids()) {
+    compacted_memory += table->get_chunk(chunk_id)->memory_usage(MemoryUsageCalculationMode::Sampled);
+  }
+  return sparse_memory > compacted_memory ? sparse_memory - compacted_memory : 0;
+}
+
 void MvccDeletePlugin::_delete_chunk_physically(const std::shared_ptr<Table>& table, const ChunkID chunk_id) {
   const auto& chunk = table->get_chunk(chunk_id);
 
@@ -3,8 +3,10 @@
 #include <algorithm>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <queue>
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest_prod.h"
 #include "hyrise.hpp"
@@ -26,6 +28,11 @@ namespace opossum {
  * recognizing chunks with high numbers of invalidated rows and fully invalidates them.
  * The physical delete checks if chunks are not visible anymore for other transactions and
  * removes the chunk from the table completely.
+ * Immutable candidate chunks of a table are not reinserted one by one. Instead, they are
+ * compacted together: their remaining rows are merged into new, full, encoded, and (if the
+ * chunks share a sort order) sorted chunks using the ChunkMerge operator. Rows that do not fill
+ * a complete chunk are reinserted into the mutable tail of the table. The switch from the
+ * sparse chunks to the compacted chunks happens atomically with the commit.
  */
 class MvccDeletePlugin : public AbstractPlugin {
   friend class MvccDeletePluginTest;
@@ -59,6 +66,9 @@ class MvccDeletePlugin : public AbstractPlugin {
 
   static bool _try_logical_delete(const std::string& table_name, ChunkID chunk_id,
                                   const std::shared_ptr<TransactionContext>& transaction_context);
+  // Returns the memory saved by the compaction or std::nullopt if it conflicted with another transaction
+  static std::optional<size_t> _try_compaction(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                               const std::shared_ptr<TransactionContext>& transaction_context);
   static void _delete_chunk_physically(const std::shared_ptr<Table>& table, ChunkID chunk_id);
 
   std::unique_ptr<PausableLoopThread> _loop_thread_logical_delete, _loop_thread_physical_delete;
@@ -0,0 +1,126 @@
+#include "tiered_storage_plugin.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "storage/table.hpp"
+
+namespace opossum {
+
+TieredStoragePlugin::MemoryBudgetSetting::MemoryBudgetSetting()
+    : AbstractSetting("TieredStoragePlugin.MemoryBudget"),
+      _value(std::to_string(std::numeric_limits<size_t>::max())) {}
+
+const std::string& TieredStoragePlugin::MemoryBudgetSetting::description() const {
+  static const auto description = std::string{"Memory budget for resident segments in bytes"};
+  return description;
+}
+
+const std::string& TieredStoragePlugin::MemoryBudgetSetting::get() { return _value; }
+
+void TieredStoragePlugin::MemoryBudgetSetting::set(const std::string& value) {
+  _memory_budget = std::stoull(value);
+  _value = value;
+}
+
+size_t TieredStoragePlugin::MemoryBudgetSetting::memory_budget() const { return _memory_budget; }
+
+std::string TieredStoragePlugin::description() const { return "Tiered storage plugin"; }
+
+void TieredStoragePlugin::start() {
+  _directory = std::filesystem::temp_directory_path() / ("hyrise_tiered_storage_" + std::to_string(getpid()));
+  std::filesystem::create_directories(_directory);
+
+  _memory_budget_setting = std::make_shared<MemoryBudgetSetting>();
+  _memory_budget_setting->register_at_settings_manager();
+
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY_EVICTION, [&](size_t) {
+    const auto evicted_segment_count = _evict_cold_segments(_memory_budget_setting->memory_budget(), _directory);
+    if (evicted_segment_count > 0) {
+      std::ostringstream message;
+      message << "Evicted " << evicted_segment_count << " segment(s) to " << _directory;
+      Hyrise::get().log_manager.add_message("TieredStoragePlugin", message.str(), LogLevel::Info);
+    }
+  });
+}
+
+void TieredStoragePlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+  _memory_budget_setting->unregister_at_settings_manager();
+
+  // The files of evicted segments are still needed, they are removed by the chunks that own them.
+}
+
+size_t TieredStoragePlugin::_evict_cold_segments(const size_t memory_budget, const std::filesystem::path& directory) {
+  struct EvictionCandidate {
+    std::string table_name;
+    std::shared_ptr<Chunk> chunk;
+    ChunkID chunk_id;
+    ColumnID column_id;
+    size_t memory_usage;
+    uint64_t access_count;
+  };
+
+  auto resident_memory = size_t{0};
+  auto candidates = std::vector<EvictionCandidate>{};
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto chunk_count = table->chunk_count();
+    const auto column_count = table->column_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto segment = chunk->get_resident_segment(column_id);
+        if (!segment) continue;
+
+        const auto memory_usage = segment->memory_usage(MemoryUsageCalculationMode::Sampled);
+        resident_memory += memory_usage;
+
+        // Only encoded segments of immutable chunks can be evicted, and only if the binary segment format supports
+        // their compressed vectors. As indexes reference the segments they were built on, segments with indexes are
+        // kept in memory.
+        if (chunk->is_mutable() || chunk->get_cleanup_commit_id()) continue;
+        if (!Chunk::is_evictable(*segment)) continue;
+        if (chunk->is_indexed(column_id)) continue;
+
+        auto access_count = uint64_t{0};
+        for (auto access_type = size_t{0}; access_type < static_cast<size_t>(SegmentAccessCounter::AccessType::Count);
+             ++access_type) {
+          access_count += segment->access_counter[static_cast<SegmentAccessCounter::AccessType>(access_type)];
+        }
+
+        candidates.emplace_back(EvictionCandidate{table_name, chunk, chunk_id, column_id, memory_usage, access_count});
+      }
+    }
+  }
+
+  if (resident_memory <= memory_budget) return 0;
+
+  // Evict the coldest segments first
+  std::sort(candidates.begin(), candidates.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.access_count < rhs.access_count; });
+
+  auto evicted_segment_count = size_t{0};
+  for (const auto& candidate : candidates) {
+    if (resident_memory <= memory_budget) break;
+
+    const auto file_name = directory / (candidate.table_name + "_" + std::to_string(candidate.chunk_id) + "_" +
+                                        std::to_string(candidate.column_id) + ".bin");
+    candidate.chunk->evict_segment(candidate.column_id, file_name.string());
+
+    resident_memory -= candidate.memory_usage;
+    ++evicted_segment_count;
+  }
+
+  return evicted_segment_count;
+}
+
+EXPORT_PLUGIN(TieredStoragePlugin)
+
+}  // namespace opossum
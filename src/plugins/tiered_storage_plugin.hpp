@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "hyrise.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace opossum {
+
+/*
+ * Keeping all segments in memory is expensive for large tables of which most chunks are rarely accessed. This plugin
+ * periodically checks whether the segments held in memory exceed a configurable memory budget (setting
+ * "TieredStoragePlugin.MemoryBudget", in bytes). If so, the coldest encoded segments of immutable chunks, i.e., those
+ * with the fewest accesses according to their SegmentAccessCounter, are evicted to local files until the budget is
+ * met. Evicted segments are transparently loaded again by Chunk::get_segment when they are accessed (see
+ * Chunk::evict_segment). The residency of segments and the number of evictions and loads are shown in the segments
+ * meta table.
+ *
+ * By default, the memory budget is unlimited, i.e., no segments are evicted.
+ */
+class TieredStoragePlugin : public AbstractPlugin {
+  friend class TieredStoragePluginTest;
+
+ public:
+  class MemoryBudgetSetting : public AbstractSetting {
+   public:
+    MemoryBudgetSetting();
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+    size_t memory_budget() const;
+
+   private:
+    std::string _value;
+    std::atomic<size_t> _memory_budget{std::numeric_limits<size_t>::max()};
+  };
+
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * IDLE_DELAY_EVICTION: sleep after each run over all tables
+   */
+  constexpr static std::chrono::milliseconds IDLE_DELAY_EVICTION = std::chrono::milliseconds(1000);
+
+ private:
+  // Evicts the least accessed segments until the resident segments fit into the memory budget. Returns the number of
+  // evicted segments.
+  static size_t _evict_cold_segments(size_t memory_budget, const std::filesystem::path& directory);
+
+  std::shared_ptr<MemoryBudgetSetting> _memory_budget_setting;
+  std::filesystem::path _directory;
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,239 @@
+#include <fstream>
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "cost_estimation/cost_estimator_physical.hpp"
+#include "cost_estimation/cost_model_calibration.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CostEstimatorPhysicalTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Table "large" has 1'000 rows in four chunks, table "small" 100 rows in one chunk. Column a of both tables is
+    // sorted.
+    _add_table("large", 1'000, 250);
+    _add_table("small", 100, 250);
+
+    large_node = StoredTableNode::make("large");
+    large_a = large_node->get_column("a");
+    large_b = large_node->get_column("b");
+    small_node = StoredTableNode::make("small");
+    small_a = small_node->get_column("a");
+  }
+
+  static void _add_table(const std::string& name, const int32_t row_count, const ChunkOffset chunk_size) {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::Int, false);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
+    for (auto row_id = int32_t{0}; row_id < row_count; ++row_id) {
+      table->append({row_id, (row_id * 7) % row_count});
+    }
+    table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      table->get_chunk(chunk_id)->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}});
+    }
+    Hyrise::get().storage_manager.add_table(name, table);
+  }
+
+  static double _feature(const CostFeatures& features, const CostFeature cost_feature) {
+    return features[static_cast<size_t>(cost_feature)];
+  }
+
+  const CostEstimatorPhysical cost_estimator{std::make_shared<CardinalityEstimator>(), CostModelCoefficients{}};
+  std::shared_ptr<StoredTableNode> large_node, small_node;
+  std::shared_ptr<LQPColumnExpression> large_a, large_b, small_a;
+};
+
+TEST_F(CostEstimatorPhysicalTest, JoinHashBuildsSmallerInput) {
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(large_a, small_a), large_node, small_node);
+  const auto features = cost_estimator.join_features(join_node, OperatorType::JoinHash);
+  ASSERT_TRUE(features);
+  EXPECT_FLOAT_EQ(_feature(*features, CostFeature::HashBuildRows), 100.0);
+  EXPECT_FLOAT_EQ(_feature(*features, CostFeature::HashProbeRows), 1'000.0);
+  // Values of dictionary segments are read with a relative cost of 1.5
+  EXPECT_FLOAT_EQ(_feature(*features, CostFeature::ReadValues), 1'650.0);
+
+  // The JoinHash does not support non-equi joins
+  const auto non_equi_join_node =
+      JoinNode::make(JoinMode::Inner, less_than_(large_a, small_a), large_node, small_node);
+  EXPECT_FALSE(cost_estimator.join_features(non_equi_join_node, OperatorType::JoinHash));
+  EXPECT_TRUE(cost_estimator.join_features(non_equi_join_node, OperatorType::JoinSortMerge));
+}
+
+TEST_F(CostEstimatorPhysicalTest, JoinIndexRequiresIndex) {
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(small_a, large_a), small_node, large_node);
+  EXPECT_FALSE(cost_estimator.join_features(join_node, OperatorType::JoinIndex, IndexSide::Right));
+
+  // Three of the four chunks are indexed, the rows of the fourth chunk are joined using a nested loop
+  const auto table = Hyrise::get().storage_manager.get_table("large");
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{3}; ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+
+  const auto features = cost_estimator.join_features(join_node, OperatorType::JoinIndex, IndexSide::Right);
+  ASSERT_TRUE(features);
+  EXPECT_FLOAT_EQ(_feature(*features, CostFeature::IndexLookups), 300.0);
+  EXPECT_FLOAT_EQ(_feature(*features, CostFeature::NestedLoopPairs), 100.0 * 250.0);
+
+  // The index side needs to be a (validated) stored table
+  EXPECT_FALSE(cost_estimator.join_features(join_node, OperatorType::JoinIndex, IndexSide::Left));
+  const auto predicate_node = PredicateNode::make(greater_than_(large_b, 10), large_node);
+  const auto join_on_predicate_node =
+      JoinNode::make(JoinMode::Inner, equals_(small_a, large_a), small_node, predicate_node);
+  EXPECT_FALSE(cost_estimator.join_features(join_on_predicate_node, OperatorType::JoinIndex, IndexSide::Right));
+  const auto join_on_validate_node =
+      JoinNode::make(JoinMode::Inner, equals_(small_a, large_a), small_node, ValidateNode::make(large_node));
+  EXPECT_TRUE(cost_estimator.join_features(join_on_validate_node, OperatorType::JoinIndex, IndexSide::Right));
+
+  // Only inner joins are supported on reference tables
+  join_on_validate_node->join_mode = JoinMode::Semi;
+  EXPECT_FALSE(cost_estimator.join_features(join_on_validate_node, OperatorType::JoinIndex, IndexSide::Right));
+}
+
+TEST_F(CostEstimatorPhysicalTest, AggregateSortOnValueClusteredInput) {
+  // The AggregateSort sorts the input even if its chunks are sorted by the group-by column, as the stored table is not
+  // value-clustered
+  const auto stored_aggregate_node =
+      AggregateNode::make(expression_vector(large_a), expression_vector(sum_(large_b)), large_node);
+  const auto stored_features = cost_estimator.aggregate_sort_features(stored_aggregate_node);
+  EXPECT_GT(_feature(stored_features, CostFeature::SortComparisons), 0.0);
+  EXPECT_GT(cost_estimator.cost(stored_features),
+            cost_estimator.cost(cost_estimator.aggregate_hash_features(stored_aggregate_node)));
+
+  // The output of a JoinSortMerge is clustered and sorted by the join columns
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(large_a, small_a), large_node, small_node);
+  const auto aggregate_on_join_node =
+      AggregateNode::make(expression_vector(small_a), expression_vector(sum_(large_b)), join_node);
+  const auto clustered_features = cost_estimator.aggregate_sort_features(aggregate_on_join_node, true);
+  EXPECT_FLOAT_EQ(_feature(clustered_features, CostFeature::SortComparisons), 0.0);
+  EXPECT_LT(cost_estimator.cost(clustered_features),
+            cost_estimator.cost(cost_estimator.aggregate_hash_features(aggregate_on_join_node)));
+
+  // Other join operators do not cluster their output
+  EXPECT_GT(_feature(cost_estimator.aggregate_sort_features(aggregate_on_join_node, false),
+                     CostFeature::SortComparisons),
+            0.0);
+
+  // Grouping by other columns or by multiple columns requires sorting
+  const auto aggregate_by_other_column_node =
+      AggregateNode::make(expression_vector(large_b), expression_vector(sum_(large_a)), join_node);
+  EXPECT_GT(_feature(cost_estimator.aggregate_sort_features(aggregate_by_other_column_node, true),
+                     CostFeature::SortComparisons),
+            0.0);
+  const auto aggregate_by_multiple_columns_node =
+      AggregateNode::make(expression_vector(large_a, large_b), expression_vector(sum_(large_a)), join_node);
+  EXPECT_GT(_feature(cost_estimator.aggregate_sort_features(aggregate_by_multiple_columns_node, true),
+                     CostFeature::SortComparisons),
+            0.0);
+
+  // The output of outer joins is not clustered, as it contains NULL values
+  const auto outer_join_node = JoinNode::make(JoinMode::Left, equals_(large_a, small_a), large_node, small_node);
+  const auto aggregate_on_outer_join_node =
+      AggregateNode::make(expression_vector(large_a), expression_vector(sum_(large_b)), outer_join_node);
+  EXPECT_GT(_feature(cost_estimator.aggregate_sort_features(aggregate_on_outer_join_node, true),
+                     CostFeature::SortComparisons),
+            0.0);
+}
+
+TEST_F(CostEstimatorPhysicalTest, DefaultCoefficients) {
+  EXPECT_FALSE(CostEstimatorPhysical::has_calibrated_default_coefficients());
+  EXPECT_EQ(CostEstimatorPhysical::default_coefficients().feature_costs, CostModelCoefficients{}.feature_costs);
+
+  auto coefficients = CostModelCoefficients{};
+  coefficients.feature_costs[static_cast<size_t>(CostFeature::IndexLookups)] = 17.0;
+  CostEstimatorPhysical::set_default_coefficients(coefficients);
+  EXPECT_TRUE(CostEstimatorPhysical::has_calibrated_default_coefficients());
+  EXPECT_EQ(CostEstimatorPhysical::default_coefficients().feature_costs, coefficients.feature_costs);
+
+  CostEstimatorPhysical::reset_default_coefficients();
+  EXPECT_FALSE(CostEstimatorPhysical::has_calibrated_default_coefficients());
+}
+
+TEST_F(CostEstimatorPhysicalTest, LoadDefaultCoefficients) {
+  // Coefficients that are missing from the file keep their default values
+  const auto file_path = test_data_path + "cost_model_coefficients.json";
+  {
+    auto file = std::ofstream{file_path};
+    file << R"({"feature_costs": {"IndexLookups": 17.0}, "relative_read_costs": {"LZ4": 30.0}})";
+  }
+  CostEstimatorPhysical::load_default_coefficients(file_path);
+
+  auto expected_coefficients = CostModelCoefficients{};
+  expected_coefficients.feature_costs[static_cast<size_t>(CostFeature::IndexLookups)] = 17.0;
+  expected_coefficients.relative_read_costs[static_cast<size_t>(EncodingType::LZ4)] = 30.0;
+  EXPECT_TRUE(CostEstimatorPhysical::has_calibrated_default_coefficients());
+  EXPECT_EQ(CostEstimatorPhysical::default_coefficients().feature_costs, expected_coefficients.feature_costs);
+  EXPECT_EQ(CostEstimatorPhysical::default_coefficients().relative_read_costs,
+            expected_coefficients.relative_read_costs);
+  CostEstimatorPhysical::reset_default_coefficients();
+
+  EXPECT_THROW(CostEstimatorPhysical::load_default_coefficients(test_data_path + "missing.json"),
+               InvalidInputException);
+  EXPECT_FALSE(CostEstimatorPhysical::has_calibrated_default_coefficients());
+}
+
+TEST_F(CostEstimatorPhysicalTest, ReadCostsDependOnEncoding) {
+  const auto predicate_node = PredicateNode::make(greater_than_(large_b, 10), large_node);
+  const auto dictionary_cost = cost_estimator.estimate_node_cost(predicate_node);
+
+  const auto table = Hyrise::get().storage_manager.get_table("large");
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    ChunkEncoder::encode_chunk(table->get_chunk(chunk_id), table->column_data_types(),
+                               SegmentEncodingSpec{EncodingType::LZ4});
+  }
+  EXPECT_GT(cost_estimator.estimate_node_cost(predicate_node), dictionary_cost);
+}
+
+TEST_F(CostEstimatorPhysicalTest, CoefficientsJson) {
+  auto coefficients = CostModelCoefficients{};
+  coefficients.feature_costs[static_cast<size_t>(CostFeature::IndexLookups)] = 17.0;
+  coefficients.relative_read_costs[static_cast<size_t>(EncodingType::LZ4)] = 4.0;
+
+  const auto json = nlohmann::json(coefficients);
+  EXPECT_EQ(json["feature_costs"]["IndexLookups"], 17.0);
+  EXPECT_EQ(json["relative_read_costs"]["LZ4"], 4.0);
+
+  const auto parsed_coefficients = json.get<CostModelCoefficients>();
+  EXPECT_EQ(parsed_coefficients.feature_costs, coefficients.feature_costs);
+  EXPECT_EQ(parsed_coefficients.relative_read_costs, coefficients.relative_read_costs);
+
+  // Coefficients that are not specified keep their default value
+  const auto partial_json = nlohmann::json::parse(R"({"feature_costs": {"OutputRows": 3.0}})");
+  const auto partial_coefficients = partial_json.get<CostModelCoefficients>();
+  EXPECT_EQ(partial_coefficients.feature_costs[static_cast<size_t>(CostFeature::OutputRows)], 3.0);
+  EXPECT_EQ(partial_coefficients.relative_read_costs, CostModelCoefficients{}.relative_read_costs);
+}
+
+TEST_F(CostEstimatorPhysicalTest, Calibration) {
+  const auto coefficients = CostModelCalibration{{1'000}, 1}.run();
+  EXPECT_EQ(coefficients.relative_read_costs[static_cast<size_t>(EncodingType::Unencoded)], 1.0);
+  for (const auto feature_cost : coefficients.feature_costs) {
+    EXPECT_GE(feature_cost, 0.0);
+  }
+
+  // The nested loop is not measured, its cost is not changed
+  EXPECT_EQ(coefficients.feature_costs[static_cast<size_t>(CostFeature::NestedLoopPairs)],
+            CostModelCoefficients{}.feature_costs[static_cast<size_t>(CostFeature::NestedLoopPairs)]);
+
+  // The calibration tables are dropped
+  EXPECT_EQ(Hyrise::get().storage_manager.table_names().size(), 2u);
+}
+
+}  // namespace opossum
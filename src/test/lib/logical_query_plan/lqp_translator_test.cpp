@@ -1,3 +1,4 @@
+#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -5,6 +6,7 @@
 #include <vector>
 
 #include "base_test.hpp"
+#include "cost_estimation/cost_estimator_physical.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
 #include "expression/expression_functional.hpp"
@@ -32,13 +34,17 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
+#include "operators/aggregate_from_metadata.hpp"
 #include "operators/aggregate_hash.hpp"
+#include "operators/aggregate_sort.hpp"
 #include "operators/change_meta_table.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
 #include "operators/import.hpp"
+#include "operators/index_only_scan.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -52,6 +58,7 @@
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -97,6 +104,24 @@ class LQPTranslatorTest : public BaseTest {
     int_float5_d = int_float5_node->get_column("d");
   }
 
+  void TearDown() override { CostEstimatorPhysical::reset_default_coefficients(); }
+
+  // Adds a table of 1'000 rows in a single chunk that is sorted by column a and has a GroupKeyIndex on it
+  static void add_sorted_table_with_index() {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::Int, false);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000, UseMvcc::Yes);
+    for (auto row_id = int32_t{0}; row_id < 1'000; ++row_id) {
+      table->append({row_id / 10, (row_id * 7) % 1'000});
+    }
+    table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+    table->get_chunk(ChunkID{0})->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}});
+    table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+    Hyrise::get().storage_manager.add_table("int_sorted", table);
+  }
+
   std::shared_ptr<Table> table_int_float, table_int_float2, table_int_float5, table_alias_name, table_int_string;
   std::shared_ptr<StoredTableNode> int_float_node, int_string_node, int_float2_node, int_float5_node;
   std::shared_ptr<LQPColumnExpression> int_float_a, int_float_b, int_string_a, int_string_b, int_float2_a, int_float2_b,
@@ -593,6 +618,28 @@ TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   EXPECT_THROW(LQPTranslator{}.translate_node(predicate_node2), std::logic_error);
 }
 
+TEST_F(LQPTranslatorTest, ValidateNodeIndexOnlyScan) {
+  const auto table = Hyrise::get().storage_manager.get_table("int_float_chunked");
+  table->create_table_hash_index({ColumnID{1}}, "", {ColumnID{0}});
+
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  const auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("b"), 42));
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto validate_node = ValidateNode::make(predicate_node);
+
+  // The index stores all columns, so that neither the table nor the MvccData have to be accessed by a Validate
+  const auto op = LQPTranslator{}.translate_node(validate_node);
+  const auto index_only_scan_op = std::dynamic_pointer_cast<IndexOnlyScan>(op);
+  ASSERT_TRUE(index_only_scan_op);
+  EXPECT_FALSE(op->left_input());
+  EXPECT_EQ(index_only_scan_op->lqp_node, validate_node);
+
+  // Pruned chunks cannot be excluded from the lookup
+  stored_table_node->set_pruned_chunk_ids({ChunkID{0}});
+  EXPECT_TRUE(std::dynamic_pointer_cast<Validate>(LQPTranslator{}.translate_node(validate_node)));
+}
+
 TEST_F(LQPTranslatorTest, ProjectionNode) {
   /**
    * Build LQP and translate to PQP
@@ -663,6 +710,59 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinNestedLoop) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeToJoinIndex) {
+  // A single probe row is looked up in the index of the large table instead of building a hash table on either input.
+  // The JoinIndex is only considered with calibrated coefficients.
+  CostEstimatorPhysical::set_default_coefficients(CostModelCoefficients{});
+  add_sorted_table_with_index();
+  const auto sorted_node = StoredTableNode::make("int_sorted");
+
+  // clang-format off
+  const auto join_node =
+  JoinNode::make(JoinMode::Inner, equals_(int_float_a, sorted_node->get_column("a")),
+    PredicateNode::make(equals_(int_float_a, 12345),
+      int_float_node),
+    sorted_node);
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  const auto join_op = std::dynamic_pointer_cast<JoinIndex>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->mode(), JoinMode::Inner);
+  EXPECT_NE(join_op->description(DescriptionMode::SingleLine).find("Index side: Right"), std::string::npos);
+
+  // Without indexes, the JoinHash is used
+  const auto table = Hyrise::get().storage_manager.get_table("int_sorted");
+  const auto chunk = table->get_chunk(ChunkID{0});
+  chunk->remove_index(chunk->get_indexes(std::vector<ColumnID>{ColumnID{0}}).front());
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+}
+
+TEST_F(LQPTranslatorTest, CostModelCoefficientsFromFile) {
+  // Coefficients written by the hyriseCostModelCalibration binary are loaded at startup (e.g., by the BenchmarkRunner
+  // and the server via --cost_model_coefficients) and make the LQPTranslator choose operators by cost
+  add_sorted_table_with_index();
+  const auto sorted_node = StoredTableNode::make("int_sorted");
+
+  // clang-format off
+  const auto join_node =
+  JoinNode::make(JoinMode::Inner, equals_(int_float_a, sorted_node->get_column("a")),
+    PredicateNode::make(equals_(int_float_a, 12345),
+      int_float_node),
+    sorted_node);
+  // clang-format on
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+
+  const auto file_path = test_data_path + "cost_model_coefficients.json";
+  {
+    auto file = std::ofstream{file_path};
+    file << nlohmann::json(CostModelCoefficients{}).dump(2) << std::endl;
+  }
+  CostEstimatorPhysical::load_default_coefficients(file_path);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinIndex>(LQPTranslator{}.translate_node(join_node)));
+}
+
 TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   /**
    * Build LQP and translate to PQP
@@ -691,6 +791,65 @@ TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   EXPECT_EQ(*count, *count_(pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")));
 }
 
+TEST_F(LQPTranslatorTest, AggregateNodeFromMetadata) {
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  const auto a = stored_table_node->get_column("a");
+
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(), expression_vector(max_(a), count_star_(stored_table_node)),
+    ValidateNode::make(
+      stored_table_node));
+  // clang-format on
+  lqp->aggregate_implementation = AggregateImplementation::FromMetadata;
+
+  // The AggregateFromMetadata performs the MVCC checks itself and is executed directly on the GetTable
+  const auto op = LQPTranslator{}.translate_node(lqp);
+  const auto aggregate_op = std::dynamic_pointer_cast<AggregateFromMetadata>(op);
+  ASSERT_TRUE(aggregate_op);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(op->left_input()));
+  ASSERT_EQ(aggregate_op->aggregates().size(), 2u);
+  EXPECT_EQ(*aggregate_op->aggregates()[0], *max_(pqp_column_(ColumnID{0}, DataType::Int, false, "a")));
+}
+
+TEST_F(LQPTranslatorTest, AggregateNodeToAggregateSort) {
+  add_sorted_table_with_index();
+  const auto sorted_node = StoredTableNode::make("int_sorted");
+  const auto a = sorted_node->get_column("a");
+
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(a), expression_vector(count_star_(sorted_node)),
+    JoinNode::make(JoinMode::Inner, equals_(a, int_float_a),
+      sorted_node,
+      int_float_node));
+  // clang-format on
+
+  // Without calibrated coefficients, the AggregateHash is used
+  EXPECT_TRUE(std::dynamic_pointer_cast<AggregateHash>(LQPTranslator{}.translate_node(lqp)));
+
+  // Even though the chunks of the stored table are sorted by the group-by column, the AggregateSort would sort the
+  // entire input, as the table is not value-clustered
+  CostEstimatorPhysical::set_default_coefficients(CostModelCoefficients{});
+  const auto stored_table_lqp =
+      AggregateNode::make(expression_vector(a), expression_vector(count_star_(sorted_node)), sorted_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<AggregateHash>(LQPTranslator{}.translate_node(stored_table_lqp)));
+
+  // With coefficients under which the join is executed by a JoinSortMerge, the input of the aggregate is clustered and
+  // sorted by the group-by column, so the AggregateSort does not need to sort it
+  auto coefficients = CostModelCoefficients{};
+  coefficients.feature_costs[static_cast<size_t>(CostFeature::HashBuildRows)] = 1'000'000.0;
+  coefficients.feature_costs[static_cast<size_t>(CostFeature::HashProbeRows)] = 1'000'000.0;
+  coefficients.feature_costs[static_cast<size_t>(CostFeature::IndexLookups)] = 1'000'000.0;
+  CostEstimatorPhysical::set_default_coefficients(coefficients);
+
+  const auto op = LQPTranslator{}.translate_node(lqp);
+  const auto aggregate_op = std::dynamic_pointer_cast<AggregateSort>(op);
+  ASSERT_TRUE(aggregate_op);
+  EXPECT_EQ(aggregate_op->groupby_column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinSortMerge>(op->left_input()));
+}
+
 TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   /**
    * Build LQP and translate to PQP
@@ -0,0 +1,206 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate_from_metadata.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsAggregateFromMetadataTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::String, true);
+    column_definitions.emplace_back("c", DataType::Float, true);
+
+    // The first two chunks are immutable and have pruning statistics, the last one is still mutable
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+    table->append({4, "d", 1.5f});
+    table->append({2, NullValue{}, NullValue{}});
+    table->append({7, "a", 2.5f});
+    table->append({9, "z", NullValue{}});
+    table->append({1, "m", NullValue{}});
+    table->append({5, NullValue{}, NullValue{}});
+    table->append({3, "b", 0.5f});
+    generate_chunk_pruning_statistics(table);
+    Hyrise::get().storage_manager.add_table("table", table);
+
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto column = pqp_column_(column_id, table->column_data_type(column_id),
+                                      table->column_is_nullable(column_id), table->column_name(column_id));
+      aggregates.emplace_back(min_(column));
+      aggregates.emplace_back(max_(column));
+      aggregates.emplace_back(count_(column));
+    }
+    aggregates.emplace_back(
+        std::make_shared<AggregateExpression>(AggregateFunction::Count, pqp_column_(INVALID_COLUMN_ID, DataType::Long,
+                                                                                    false, "*")));
+  }
+
+  // Executes the AggregateFromMetadata and the AggregateHash on the validated table and compares their results
+  void aggregate_and_compare(const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    const auto get_table = std::make_shared<GetTable>("table");
+    aggregate_from_metadata = std::make_shared<AggregateFromMetadata>(get_table, aggregates);
+
+    auto aggregate_hash_input = std::shared_ptr<AbstractOperator>{get_table};
+    if (transaction_context) {
+      aggregate_hash_input = std::make_shared<Validate>(get_table);
+      aggregate_hash_input->set_transaction_context(transaction_context);
+      get_table->set_transaction_context(transaction_context);
+      aggregate_from_metadata->set_transaction_context(transaction_context);
+    }
+    const auto aggregate_hash =
+        std::make_shared<AggregateHash>(aggregate_hash_input, aggregates, std::vector<ColumnID>{});
+
+    get_table->execute();
+    aggregate_from_metadata->execute();
+    aggregate_hash_input->execute();
+    aggregate_hash->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(aggregate_from_metadata->get_output(), aggregate_hash->get_output());
+  }
+
+  const AggregateFromMetadata::PerformanceData& performance_data() const {
+    return static_cast<const AggregateFromMetadata::PerformanceData&>(*aggregate_from_metadata->performance_data);
+  }
+
+  std::shared_ptr<Table> table;
+  std::vector<std::shared_ptr<AggregateExpression>> aggregates;
+  std::shared_ptr<AggregateFromMetadata> aggregate_from_metadata;
+};
+
+TEST_F(OperatorsAggregateFromMetadataTest, UsesMetadataOfImmutableChunks) {
+  aggregate_and_compare();
+  const auto& output = aggregate_from_metadata->get_output();
+
+  EXPECT_EQ(*output->get_value<int32_t>(ColumnID{0}, 0), 1);
+  EXPECT_EQ(*output->get_value<int32_t>(ColumnID{1}, 0), 9);
+  EXPECT_EQ(*output->get_value<int64_t>(ColumnID{5}, 0), 5);
+  EXPECT_EQ(*output->get_value<float>(ColumnID{6}, 0), 0.5f);
+  EXPECT_EQ(*output->get_value<int64_t>(ColumnID{8}, 0), 3);
+  EXPECT_EQ(*output->get_value<int64_t>(ColumnID{9}, 0), 7);
+
+  // Only the mutable chunk, which has no pruning statistics, needs to be scanned
+  EXPECT_EQ(performance_data().num_chunks_from_metadata, 2ul);
+  EXPECT_EQ(performance_data().num_chunks_scanned, 1ul);
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  aggregate_and_compare(transaction_context);
+  EXPECT_EQ(performance_data().num_chunks_from_metadata, 2ul);
+}
+
+TEST_F(OperatorsAggregateFromMetadataTest, ScansChunksWithInvisibleRows) {
+  // Delete the row with the maximum of column a
+  const auto delete_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>("table");
+  get_table->set_transaction_context(delete_context);
+  get_table->execute();
+  const auto table_scan = create_table_scan(get_table, ColumnID{0}, PredicateCondition::Equals, 9);
+  table_scan->execute();
+  const auto delete_op = std::make_shared<Delete>(table_scan);
+  delete_op->set_transaction_context(delete_context);
+  delete_op->execute();
+
+  // The transaction that deleted the row cannot rely on the metadata of any chunk
+  aggregate_and_compare(delete_context);
+  EXPECT_EQ(*aggregate_from_metadata->get_output()->get_value<int32_t>(ColumnID{1}, 0), 7);
+  EXPECT_EQ(performance_data().num_chunks_from_metadata, 0ul);
+  EXPECT_EQ(performance_data().num_chunks_scanned, 3ul);
+
+  // The deleted row is still visible to a transaction that started before the deletion was committed
+  const auto old_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  delete_context->commit();
+  aggregate_and_compare(old_context);
+  EXPECT_EQ(*aggregate_from_metadata->get_output()->get_value<int32_t>(ColumnID{1}, 0), 9);
+
+  const auto new_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  aggregate_and_compare(new_context);
+  EXPECT_EQ(*aggregate_from_metadata->get_output()->get_value<int32_t>(ColumnID{1}, 0), 7);
+  EXPECT_EQ(*aggregate_from_metadata->get_output()->get_value<int64_t>(ColumnID{9}, 0), 6);
+  EXPECT_EQ(performance_data().num_chunks_from_metadata, 1ul);
+  EXPECT_EQ(performance_data().num_chunks_scanned, 2ul);
+}
+
+TEST_F(OperatorsAggregateFromMetadataTest, SharedDictionary) {
+  // Column a of the first two chunks is encoded with the shared dictionary {1, 2, 4, 5, 7, 9}. The values of each chunk
+  // are a strict subset of it.
+  const auto shared_dictionary_table =
+      std::make_shared<Table>(table->column_definitions(), TableType::Data, 3, UseMvcc::Yes);
+  for (const auto& row : table->get_rows()) {
+    shared_dictionary_table->append(row);
+  }
+  ChunkEncoder::encode_column_with_shared_dictionary(shared_dictionary_table, ColumnID{0});
+  generate_chunk_pruning_statistics(shared_dictionary_table);
+  Hyrise::get().storage_manager.drop_table("table");
+  Hyrise::get().storage_manager.add_table("table", shared_dictionary_table);
+
+  aggregate_and_compare();
+  EXPECT_EQ(performance_data().num_chunks_from_metadata, 2ul);
+
+  // Without the second chunk, the maximum of column a is 7, although the shared dictionary contains 9
+  const auto get_table = std::make_shared<GetTable>("table", std::vector<ChunkID>{ChunkID{1}}, std::vector<ColumnID>{});
+  get_table->execute();
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto aggregate = std::make_shared<AggregateFromMetadata>(
+      get_table, std::vector<std::shared_ptr<AggregateExpression>>{min_(column), max_(column)});
+  aggregate->execute();
+  EXPECT_EQ(*aggregate->get_output()->get_value<int32_t>(ColumnID{0}, 0), 2);
+  EXPECT_EQ(*aggregate->get_output()->get_value<int32_t>(ColumnID{1}, 0), 7);
+}
+
+TEST_F(OperatorsAggregateFromMetadataTest, ScansChunksWithInexactStatistics) {
+  // Statistics that do not come from generate_chunk_pruning_statistics might not hold the exact bounds
+  const auto chunk = table->get_chunk(ChunkID{0});
+  const auto segment_statistics = std::make_shared<AttributeStatistics<int32_t>>();
+  segment_statistics->set_statistics_object(std::make_shared<MinMaxFilter<int32_t>>(0, 100));
+  auto pruning_statistics = *chunk->pruning_statistics();
+  pruning_statistics[0] = segment_statistics;
+  chunk->set_pruning_statistics(pruning_statistics);
+
+  aggregate_and_compare();
+  EXPECT_EQ(*aggregate_from_metadata->get_output()->get_value<int32_t>(ColumnID{0}, 0), 1);
+  EXPECT_EQ(*aggregate_from_metadata->get_output()->get_value<int32_t>(ColumnID{1}, 0), 9);
+  EXPECT_EQ(performance_data().num_chunks_scanned, 2ul);
+}
+
+TEST_F(OperatorsAggregateFromMetadataTest, EmptyTable) {
+  Hyrise::get().storage_manager.drop_table("table");
+  Hyrise::get().storage_manager.add_table(
+      "table", std::make_shared<Table>(table->column_definitions(), TableType::Data, 3, UseMvcc::Yes));
+
+  // MIN and MAX are NULL, the COUNTs are zero
+  aggregate_and_compare();
+  const auto& output = aggregate_from_metadata->get_output();
+  EXPECT_EQ(output->row_count(), 1u);
+  EXPECT_FALSE(output->get_value<int32_t>(ColumnID{0}, 0));
+  EXPECT_EQ(*output->get_value<int64_t>(ColumnID{9}, 0), 0);
+}
+
+TEST_F(OperatorsAggregateFromMetadataTest, UnsupportedAggregates) {
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto get_table = std::make_shared<GetTable>("table");
+  EXPECT_THROW(std::make_shared<AggregateFromMetadata>(get_table, std::vector{sum_(column)}), std::logic_error);
+  EXPECT_FALSE(AggregateFromMetadata::is_supported(AggregateFunction::CountDistinct));
+}
+
+}  // namespace opossum
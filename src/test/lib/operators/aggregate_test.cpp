@@ -316,6 +316,26 @@ TYPED_TEST(OperatorsAggregateTest, StringSingleAggregateAvg) {
                          "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/avg.tbl");
 }
 
+TYPED_TEST(OperatorsAggregateTest, SharedDictionaryStringSingleAggregateSum) {
+  const auto table = load_table("resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/input.tbl", 2);
+  ChunkEncoder::encode_column_with_shared_dictionary(table, ColumnID{0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  test_output<TypeParam>(table_wrapper, {{ColumnID{1}, AggregateFunction::Sum}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/sum.tbl");
+}
+
+TYPED_TEST(OperatorsAggregateTest, SharedDictionaryCountStringColumnsWithNull) {
+  const auto table = load_table("resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/input_null.tbl", 2);
+  ChunkEncoder::encode_column_with_shared_dictionary(table, ColumnID{0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  test_output<TypeParam>(table_wrapper, {{ColumnID{1}, AggregateFunction::Count}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/count_str_null.tbl", false);
+}
+
 TYPED_TEST(OperatorsAggregateTest, StringSingleAggregateStandardDeviationSample) {
   test_output<TypeParam>(this->_table_wrapper_1_1_string, {{ColumnID{1}, AggregateFunction::StandardDeviationSample}},
                          {ColumnID{0}},
@@ -790,6 +810,42 @@ TYPED_TEST(OperatorsAggregateTest, DictionarySingleAggregateStandardDeviationSam
                          "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/stddev_samp_filtered.tbl");
 }
 
+TYPED_TEST(OperatorsAggregateTest, RunLengthAndFrameOfReferenceWithoutGroupBy) {
+  // Column a contains runs interrupted by NULLs, column b long runs without NULLs. Both contain negative values and
+  // span multiple FrameOfReference blocks.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3'000);
+  for (auto row = int32_t{0}; row < 5'000; ++row) {
+    const auto a = row % 7 == 0 ? NULL_VALUE : AllTypeVariant{row / 100 - 20};
+    table->append({a, row / 1'000 - 2});
+  }
+  table->last_chunk()->finalize();
+
+  auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  for (const auto column_id : {ColumnID{0}, ColumnID{1}}) {
+    for (const auto aggregate_function : {AggregateFunction::Min, AggregateFunction::Max, AggregateFunction::Sum,
+                                          AggregateFunction::Avg, AggregateFunction::Count}) {
+      aggregates.emplace_back(std::make_shared<AggregateExpression>(
+          aggregate_function, pqp_column_(column_id, table->column_data_type(column_id),
+                                          table->column_is_nullable(column_id), table->column_name(column_id))));
+    }
+  }
+
+  const auto aggregate_table = [&]() {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    const auto aggregate = std::make_shared<TypeParam>(table_wrapper, aggregates, std::vector<ColumnID>{});
+    aggregate->execute();
+    return aggregate->get_output();
+  };
+
+  const auto expected_result = aggregate_table();
+  for (const auto encoding_type : {EncodingType::RunLength, EncodingType::FrameOfReference}) {
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{encoding_type});
+    EXPECT_TABLE_EQ_ORDERED(aggregate_table(), expected_result);
+  }
+}
+
 TYPED_TEST(OperatorsAggregateTest, JoinThenAggregate) {
   auto join = std::make_shared<JoinHash>(
       this->_table_wrapper_2_0_a, this->_table_wrapper_2_o_b, JoinMode::Inner,
@@ -0,0 +1,201 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/chunk_merge.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment/shared_dictionary.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsChunkMergeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 8 rows in three chunks of sizes 3, 3, and 2
+    _table = load_table("resources/test_data/tbl/int_int3.tbl", 3);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    _expected_table = load_table("resources/test_data/tbl/int_int3.tbl");
+  }
+
+  // Merges the first two chunks of the table, sorted by the first column
+  std::shared_ptr<ChunkMerge> _merge(const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto get_table =
+        std::make_shared<GetTable>(_table_name, std::vector<ChunkID>{ChunkID{2}}, std::vector<ColumnID>{});
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+
+    const auto chunk_merge = std::make_shared<ChunkMerge>(
+        _table_name, validate, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}},
+        ChunkEncodingSpec{2, SegmentEncodingSpec{EncodingType::Dictionary}});
+    chunk_merge->set_transaction_context(transaction_context);
+    chunk_merge->execute();
+
+    return chunk_merge;
+  }
+
+  std::shared_ptr<const Table> _visible_rows(const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+
+    return validate->get_output();
+  }
+
+  const std::string _table_name{"chunkMergeTestTable"};
+  std::shared_ptr<Table> _table, _expected_table;
+};
+
+TEST_F(OperatorsChunkMergeTest, MergeAndCommit) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto chunk_merge = _merge(transaction_context);
+  EXPECT_FALSE(chunk_merge->execute_failed());
+  EXPECT_EQ(chunk_merge->merged_chunk_ids(), std::vector<ChunkID>({ChunkID{3}, ChunkID{4}}));
+  transaction_context->commit();
+
+  ASSERT_EQ(_table->chunk_count(), 5);
+
+  // The original rows are deleted.
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 3; ++chunk_offset) {
+    EXPECT_EQ(_table->get_chunk(ChunkID{0})->mvcc_data()->get_end_cid(chunk_offset), transaction_context->commit_id());
+    EXPECT_EQ(_table->get_chunk(ChunkID{1})->mvcc_data()->get_end_cid(chunk_offset), transaction_context->commit_id());
+  }
+
+  // The merged chunks are sorted, encoded, finalized, and have pruning statistics.
+  auto merged_values = std::vector<AllTypeVariant>{};
+  for (const auto chunk_id : chunk_merge->merged_chunk_ids()) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_EQ(chunk->size(), 3);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(chunk->pruning_statistics());
+    EXPECT_EQ(*chunk->mvcc_data()->max_begin_cid, transaction_context->commit_id());
+    ASSERT_EQ(chunk->individually_sorted_by().size(), 1);
+    EXPECT_EQ(chunk->individually_sorted_by().front().column, ColumnID{0});
+
+    const auto segment = chunk->get_segment(ColumnID{0});
+    EXPECT_EQ(get_segment_encoding_spec(segment).encoding_type, EncodingType::Dictionary);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      merged_values.emplace_back((*segment)[chunk_offset]);
+    }
+  }
+  EXPECT_EQ(merged_values, std::vector<AllTypeVariant>({1, 4, 4, 6, 8, 13}));
+
+  const auto new_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(new_transaction_context), _expected_table);
+}
+
+TEST_F(OperatorsChunkMergeTest, MergeIntoSharedDictionary) {
+  _table->last_chunk()->finalize();
+  ChunkEncoder::encode_column_with_shared_dictionary(_table, ColumnID{0});
+  const auto dictionary = get_shared_dictionary<int32_t>(*_table, ColumnID{0});
+  ASSERT_TRUE(dictionary);
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto chunk_merge = _merge(transaction_context);
+  EXPECT_FALSE(chunk_merge->execute_failed());
+  transaction_context->commit();
+
+  // The merged chunks use the shared dictionary, but their pruning statistics only cover their own values
+  const auto chunk = _table->get_chunk(chunk_merge->merged_chunk_ids().front());
+  const auto segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->dictionary(), dictionary);
+
+  const auto& pruning_statistics = chunk->pruning_statistics();
+  ASSERT_TRUE(pruning_statistics);
+  const auto& segment_statistics = pruning_statistics->at(0);
+  EXPECT_TRUE(segment_statistics->does_not_contain(PredicateCondition::Equals, int32_t{0}));
+  EXPECT_TRUE(segment_statistics->does_not_contain(PredicateCondition::GreaterThan, int32_t{4}));
+  EXPECT_FALSE(segment_statistics->does_not_contain(PredicateCondition::Equals, int32_t{4}));
+}
+
+TEST_F(OperatorsChunkMergeTest, UncommittedMergeInvisibleToOthers) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  _merge(transaction_context);
+
+  // Both our own and other transactions see each row exactly once.
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(transaction_context), _expected_table);
+  const auto other_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(other_transaction_context), _expected_table);
+
+  transaction_context->commit();
+
+  // A transaction that started before the commit still sees the original rows (and not the merged ones).
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(other_transaction_context), _expected_table);
+}
+
+TEST_F(OperatorsChunkMergeTest, Rollback) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto chunk_merge = _merge(transaction_context);
+  transaction_context->rollback(RollbackReason::User);
+
+  for (const auto chunk_id : chunk_merge->merged_chunk_ids()) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_EQ(chunk->invalid_row_count(), chunk->size());
+  }
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->mvcc_data()->get_end_cid(0), MvccData::MAX_COMMIT_ID);
+
+  const auto new_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(new_transaction_context), _expected_table);
+}
+
+TEST_F(OperatorsChunkMergeTest, ConflictWithConcurrentDelete) {
+  const auto merge_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  // Another transaction deletes a row of the first chunk (a = 13) before the merge is executed.
+  {
+    const auto delete_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->execute();
+    const auto table_scan = create_table_scan(get_table, ColumnID{0}, PredicateCondition::Equals, 13);
+    table_scan->execute();
+    const auto delete_op = std::make_shared<Delete>(table_scan);
+    delete_op->set_transaction_context(delete_transaction_context);
+    delete_op->execute();
+    delete_transaction_context->commit();
+  }
+
+  const auto chunk_merge = _merge(merge_transaction_context);
+  EXPECT_TRUE(chunk_merge->execute_failed());
+  merge_transaction_context->rollback(RollbackReason::Conflict);
+
+  EXPECT_EQ(_table->chunk_count(), 3);
+}
+
+TEST_F(OperatorsChunkMergeTest, EmptyInput) {
+  const auto delete_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>(_table_name);
+  get_table->execute();
+  const auto delete_op = std::make_shared<Delete>(get_table);
+  delete_op->set_transaction_context(delete_transaction_context);
+  delete_op->execute();
+  delete_transaction_context->commit();
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto chunk_merge = _merge(transaction_context);
+  EXPECT_FALSE(chunk_merge->execute_failed());
+  EXPECT_TRUE(chunk_merge->merged_chunk_ids().empty());
+  transaction_context->commit();
+
+  EXPECT_EQ(_table->chunk_count(), 3);
+}
+
+}  // namespace opossum
@@ -142,6 +142,16 @@ TEST_F(OperatorsGetTableTest, PrunedColumns) {
   EXPECT_EQ(table->get_chunk(ChunkID{2})->get_indexes(column_ids_1).size(), 0u);
   EXPECT_EQ(table->get_chunk(ChunkID{3})->get_indexes(column_ids_0).size(), 1u);
   EXPECT_EQ(table->get_chunk(ChunkID{3})->get_indexes(column_ids_1).size(), 0u);
+
+  // The pruning statistics of the remaining columns are forwarded
+  const auto stored_table = Hyrise::get().storage_manager.get_table("int_int_float");
+  const auto& stored_pruning_statistics = stored_table->get_chunk(ChunkID{0})->pruning_statistics();
+  const auto& pruning_statistics = table->get_chunk(ChunkID{0})->pruning_statistics();
+  ASSERT_TRUE(stored_pruning_statistics);
+  ASSERT_TRUE(pruning_statistics);
+  ASSERT_EQ(pruning_statistics->size(), 2u);
+  EXPECT_EQ(pruning_statistics->at(0), stored_pruning_statistics->at(0));
+  EXPECT_EQ(pruning_statistics->at(1), stored_pruning_statistics->at(2));
 }
 
 TEST_F(OperatorsGetTableTest, PrunedColumnsAndChunks) {
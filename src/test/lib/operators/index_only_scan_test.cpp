@@ -0,0 +1,138 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_only_scan.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/index/table_art/table_art_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsIndexOnlyScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::String, true);
+    column_definitions.emplace_back("c", DataType::Float, false);
+
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    table->append({1, "one", 1.5f});
+    table->append({2, NullValue{}, 2.5f});
+    table->append({3, "three", 3.5f});
+    table->append({2, "two", 4.5f});
+    table->append({5, "five", 5.5f});
+    Hyrise::get().storage_manager.add_table("table", table);
+
+    table->create_table_hash_index({ColumnID{0}}, "", {ColumnID{1}});
+    table->create_table_art_index(ColumnID{2}, "", {ColumnID{0}});
+  }
+
+  std::shared_ptr<const Table> scan_hash_index(const AllTypeVariant& value,
+                                               const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto index_only_scan =
+        std::make_shared<IndexOnlyScan>("table", SegmentIndexType::TableHash, std::vector{ColumnID{0}},
+                                        PredicateCondition::Equals, std::vector{value}, std::vector<AllTypeVariant>{},
+                                        std::vector{ColumnID{0}, ColumnID{1}});
+    index_only_scan->set_transaction_context(transaction_context);
+    index_only_scan->execute();
+    return index_only_scan->get_output();
+  }
+
+  std::shared_ptr<Table> expected_table(const std::vector<ColumnID>& column_ids) const {
+    auto expected_column_definitions = TableColumnDefinitions{};
+    for (const auto column_id : column_ids) {
+      expected_column_definitions.emplace_back(column_definitions[column_id]);
+    }
+    return std::make_shared<Table>(expected_column_definitions, TableType::Data);
+  }
+
+  TableColumnDefinitions column_definitions;
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(OperatorsIndexOnlyScanTest, HashIndexLookup) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto expected = expected_table({ColumnID{0}, ColumnID{1}});
+  expected->append({2, NullValue{}});
+  expected->append({2, "two"});
+  EXPECT_TABLE_EQ_UNORDERED(scan_hash_index(2, transaction_context), expected);
+
+  EXPECT_EQ(scan_hash_index(4, transaction_context)->row_count(), 0u);
+  EXPECT_EQ(scan_hash_index(4, transaction_context)->column_count(), 2u);
+}
+
+TEST_F(OperatorsIndexOnlyScanTest, ARTIndexRangeLookup) {
+  const auto index_only_scan = std::make_shared<IndexOnlyScan>(
+      "table", SegmentIndexType::TableART, std::vector{ColumnID{2}}, PredicateCondition::BetweenInclusive,
+      std::vector<AllTypeVariant>{2.0f}, std::vector<AllTypeVariant>{4.5f}, std::vector{ColumnID{0}, ColumnID{2}});
+  index_only_scan->execute();
+
+  const auto expected = expected_table({ColumnID{0}, ColumnID{2}});
+  expected->append({2, 2.5f});
+  expected->append({3, 3.5f});
+  expected->append({2, 4.5f});
+  EXPECT_TABLE_EQ_UNORDERED(index_only_scan->get_output(), expected);
+}
+
+TEST_F(OperatorsIndexOnlyScanTest, ChecksVisibility) {
+  // Insert a row without committing it. It is only visible to the inserting transaction.
+  const auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+  values->append({2, "new", 6.5f});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  const auto insert_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto insert = std::make_shared<Insert>("table", table_wrapper);
+  insert->set_transaction_context(insert_context);
+  insert->execute();
+
+  const auto other_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_EQ(scan_hash_index(2, insert_context)->row_count(), 3u);
+  EXPECT_EQ(scan_hash_index(2, other_context)->row_count(), 2u);
+  insert_context->commit();
+
+  // Delete the rows with a = 2 that existed before
+  const auto delete_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>("table");
+  get_table->set_transaction_context(delete_context);
+  get_table->execute();
+  const auto table_scan = create_table_scan(get_table, ColumnID{2}, PredicateCondition::LessThan, 5.0f);
+  table_scan->execute();
+  const auto delete_op = std::make_shared<Delete>(table_scan);
+  delete_op->set_transaction_context(delete_context);
+  delete_op->execute();
+  delete_context->commit();
+
+  // The deleted rows are still visible to the transaction that started before the deletion
+  EXPECT_EQ(scan_hash_index(2, other_context)->row_count(), 2u);
+
+  const auto expected = expected_table({ColumnID{0}, ColumnID{1}});
+  expected->append({2, "new"});
+  const auto new_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TABLE_EQ_UNORDERED(scan_hash_index(2, new_context), expected);
+}
+
+TEST_F(OperatorsIndexOnlyScanTest, RequiresCoveringIndex) {
+  // Column c is not stored in the TableHashIndex
+  const auto index_only_scan =
+      std::make_shared<IndexOnlyScan>("table", SegmentIndexType::TableHash, std::vector{ColumnID{0}},
+                                      PredicateCondition::Equals, std::vector<AllTypeVariant>{2},
+                                      std::vector<AllTypeVariant>{}, std::vector{ColumnID{0}, ColumnID{2}});
+  EXPECT_THROW(index_only_scan->execute(), std::logic_error);
+
+  EXPECT_TRUE(IndexOnlyScan::is_covering(*table->get_table_hash_index({ColumnID{0}}), {ColumnID{1}, ColumnID{0}}));
+  EXPECT_FALSE(IndexOnlyScan::is_covering(*table->get_table_art_index(ColumnID{2}), {ColumnID{1}}));
+}
+
+}  // namespace opossum
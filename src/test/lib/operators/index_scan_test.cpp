@@ -21,6 +21,8 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/index/trigram/trigram_index.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -308,4 +310,141 @@ TYPED_TEST(OperatorsIndexScanTest, AddedChunk) {
                             load_table("resources/test_data/tbl/int_int_shuffled_appended_and_filtered.tbl", 10));
 }
 
+class OperatorsIndexScanTableHashTest : public BaseTest {};
+
+TEST_F(OperatorsIndexScanTableHashTest, ScanWithTableHashIndex) {
+  const auto table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 7);
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}});
+  table->create_table_hash_index({ColumnID{0}});
+  Hyrise::get().storage_manager.add_table("hash_index_test_table", table);
+
+  const auto stored_table_node = StoredTableNode::make("hash_index_test_table");
+  auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("a"), 4), stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+
+  // The TableHashIndex covers all chunks, so that no TableScan is required
+  const auto pqp = LQPTranslator{}.translate_node(predicate_node);
+  const auto index_scan = std::dynamic_pointer_cast<IndexScan>(pqp);
+  ASSERT_TRUE(index_scan);
+
+  // Rows added after the translation are found as well
+  table->append({4, 5});
+
+  index_scan->mutable_left_input()->execute();
+  index_scan->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(index_scan->get_output(),
+                            load_table("resources/test_data/tbl/int_int_shuffled_appended_and_filtered.tbl", 10));
+}
+
+TEST_F(OperatorsIndexScanTableHashTest, ScanWithTableHashIndexOnPrunedColumns) {
+  const auto table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 7);
+  table->create_table_hash_index({ColumnID{1}});
+  table->create_table_hash_index({ColumnID{0}});
+  Hyrise::get().storage_manager.add_table("hash_index_test_table", table);
+
+  // GetTable forwards the index on column b as an index on its first output column and drops the one on column a
+  const auto get_table = std::make_shared<GetTable>("hash_index_test_table", std::vector<ChunkID>{},
+                                                    std::vector<ColumnID>{ColumnID{0}});
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->get_table_hash_index({ColumnID{0}}), table->get_table_hash_index({ColumnID{1}}));
+  EXPECT_EQ(get_table->get_output()->table_indexes().size(), 1u);
+
+  const auto index_scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::TableHash,
+                                                      std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::Equals,
+                                                      std::vector<AllTypeVariant>{104});
+  index_scan->execute();
+
+  const auto expected_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Int, false}}, TableType::Data);
+  expected_table->append({104});
+  expected_table->append({104});
+  EXPECT_TABLE_EQ_UNORDERED(index_scan->get_output(), expected_table);
+}
+
+TEST_F(OperatorsIndexScanTableHashTest, ScanWithTableHashIndexOnPrunedChunks) {
+  const auto table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 7);
+  table->create_table_hash_index({ColumnID{0}});
+  Hyrise::get().storage_manager.add_table("hash_index_test_table", table);
+
+  // The value 4 is contained in both chunks. As chunk 0 is pruned, the RowIDs of chunk 1 are mapped to chunk 0 of the
+  // output of GetTable.
+  const auto get_table = std::make_shared<GetTable>("hash_index_test_table", std::vector<ChunkID>{ChunkID{0}},
+                                                    std::vector<ColumnID>{});
+  get_table->execute();
+  auto row_ids = table->get_table_hash_index({ColumnID{0}})->lookup({4});
+  get_table->get_output()->map_table_index_row_ids(row_ids);
+  EXPECT_EQ(row_ids, std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{0}}}));
+
+  const auto index_scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::TableHash,
+                                                      std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::Equals,
+                                                      std::vector<AllTypeVariant>{4});
+  index_scan->execute();
+
+  const auto expected_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  expected_table->append({4, 104});
+  EXPECT_TABLE_EQ_UNORDERED(index_scan->get_output(), expected_table);
+}
+
+TEST_F(OperatorsIndexScanTableHashTest, ScanWithTableARTIndex) {
+  const auto table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 7);
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}});
+  table->create_table_art_index(ColumnID{0});
+  Hyrise::get().storage_manager.add_table("art_index_test_table", table);
+
+  const auto stored_table_node = StoredTableNode::make("art_index_test_table");
+  auto predicate_node =
+      PredicateNode::make(between_inclusive_(stored_table_node->get_column("a"), 4, 6), stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+
+  // The TableARTIndex answers range predicates on all chunks
+  const auto pqp = LQPTranslator{}.translate_node(predicate_node);
+  const auto index_scan = std::dynamic_pointer_cast<IndexScan>(pqp);
+  ASSERT_TRUE(index_scan);
+
+  table->append({5, 105});
+
+  index_scan->mutable_left_input()->execute();
+  index_scan->execute();
+
+  const auto expected_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  expected_table->append({4, 104});
+  expected_table->append({4, 104});
+  expected_table->append({6, 106});
+  expected_table->append({6, 106});
+  expected_table->append({5, 105});
+  EXPECT_TABLE_EQ_UNORDERED(index_scan->get_output(), expected_table);
+}
+
+class OperatorsIndexScanTrigramTest : public BaseTest {};
+
+TEST_F(OperatorsIndexScanTrigramTest, ScanWithTrigramIndex) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("s", DataType::String, true);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  table->append({"ERR-1234 a"});
+  table->append({"ERR-4321 x"});
+  table->append({"ERR-1234 b"});
+  table->append({"ERR-1235 x"});
+  table->append({"x ERR-1234"});
+  table->append({NullValue{}});
+  table->get_chunk(ChunkID{1})->finalize();
+  ChunkEncoder::encode_all_chunks(table);
+  table->create_index<TrigramIndex>({ColumnID{0}});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // The candidates of the index ("ERR-1234 a", "ERR-1234 b", "x ERR-1234") are verified with the LikeMatcher
+  const auto index_scan = std::make_shared<IndexScan>(table_wrapper, SegmentIndexType::Trigram,
+                                                      std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::Like,
+                                                      std::vector<AllTypeVariant>{pmr_string{"ERR-1234%"}});
+  index_scan->execute();
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({"ERR-1234 a"});
+  expected_table->append({"ERR-1234 b"});
+  EXPECT_TABLE_EQ_UNORDERED(index_scan->get_output(), expected_table);
+}
+
 }  // namespace opossum
@@ -13,6 +13,7 @@
 #include "operators/join_index.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -183,6 +184,29 @@ TEST_F(OperatorPerformanceDataTest, TableScanPerformanceData) {
   }
 }
 
+// Unfiltered run-length encoded segments are scanned per run.
+TEST_F(OperatorPerformanceDataTest, TableScanPerformanceDataRunLength) {
+  const auto table = load_table("resources/test_data/tbl/int_int.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::RunLength});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto value_scan = std::make_shared<TableScan>(
+      table_wrapper, greater_than_equals_(get_column_expression(table_wrapper, ColumnID{0}), 1234));
+  value_scan->execute();
+  EXPECT_EQ(dynamic_cast<TableScan::PerformanceData&>(*value_scan->performance_data).num_chunks_with_run_length_scan,
+            2u);
+  EXPECT_EQ(value_scan->get_output()->row_count(), 2u);
+
+  const auto between_scan = std::make_shared<TableScan>(
+      value_scan, between_inclusive_(get_column_expression(value_scan, ColumnID{1}), 0, 1000));
+  between_scan->execute();
+
+  // The input of the second scan is filtered, so the runs cannot be used
+  EXPECT_EQ(dynamic_cast<TableScan::PerformanceData&>(*between_scan->performance_data).num_chunks_with_run_length_scan,
+            0u);
+}
+
 TEST_F(OperatorPerformanceDataTest, JoinHashStepRuntimes) {
   const auto join = std::make_shared<JoinHash>(
       _table_wrapper, _table_wrapper, JoinMode::Inner,
@@ -22,6 +22,8 @@
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/statistics_objects/zone_map.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/reference_segment.hpp"
@@ -890,6 +892,109 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   EXPECT_EQ(*scan_c->predicate(), *greater_than_equals_(column, placeholder_(ParameterID{4})));
 }
 
+TEST_P(OperatorsTableScanTest, RuntimePruningWithPruningStatistics) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  for (auto value = 1; value <= 9; ++value) {
+    table->append({value});
+  }
+  table->last_chunk()->finalize();
+  generate_chunk_pruning_statistics(table);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto column = get_column_expression(table_wrapper, ColumnID{0});
+
+  // The value of the parameter is unknown during optimization, so only the TableScan can prune the first chunk
+  const auto scan = std::make_shared<TableScan>(
+      table_wrapper, greater_than_(column, correlated_parameter_(ParameterID{0}, column)));
+  scan->set_parameters({{ParameterID{0}, AllTypeVariant{5}}});
+  scan->execute();
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, {6, 7, 8, 9});
+  EXPECT_EQ(dynamic_cast<TableScan::PerformanceData&>(*scan->performance_data).num_chunks_pruned_at_runtime, 1u);
+
+  // Chunks of reference tables are pruned based on the chunk they reference
+  const auto between_scan = std::make_shared<TableScan>(
+      scan, between_inclusive_(column, correlated_parameter_(ParameterID{0}, column), 20));
+  between_scan->set_parameters({{ParameterID{0}, AllTypeVariant{8}}});
+  between_scan->execute();
+  ASSERT_COLUMN_EQ(between_scan->get_output(), ColumnID{0}, {8, 9});
+  EXPECT_EQ(dynamic_cast<TableScan::PerformanceData&>(*between_scan->performance_data).num_chunks_pruned_at_runtime,
+            1u);
+
+  // Parameter values that cannot be losslessly casted to the column type are not used for pruning
+  const auto float_scan =
+      std::make_shared<TableScan>(table_wrapper, less_than_(column, correlated_parameter_(ParameterID{0}, column)));
+  float_scan->set_parameters({{ParameterID{0}, AllTypeVariant{3.5f}}});
+  float_scan->execute();
+  EXPECT_EQ(dynamic_cast<TableScan::PerformanceData&>(*float_scan->performance_data).num_chunks_pruned_at_runtime,
+            0u);
+}
+
+TEST_P(OperatorsTableScanTest, RuntimePruningOfSortedChunks) {
+  // The chunks are sorted, but have no pruning statistics: [1, 1, 2, 2] and [4]
+  const auto table = load_table("resources/test_data/tbl/int_sorted.tbl", 4);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->set_individually_sorted_by(SortColumnDefinition(ColumnID{0}, SortMode::Ascending));
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto column = get_column_expression(table_wrapper, ColumnID{0});
+
+  const auto scan =
+      std::make_shared<TableScan>(table_wrapper, equals_(column, correlated_parameter_(ParameterID{0}, column)));
+  scan->set_parameters({{ParameterID{0}, AllTypeVariant{4}}});
+  scan->execute();
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, {4});
+  EXPECT_EQ(dynamic_cast<TableScan::PerformanceData&>(*scan->performance_data).num_chunks_pruned_at_runtime, 1u);
+}
+
+TEST_P(OperatorsTableScanTest, ScanWithZoneMap) {
+  // The values are clustered, so that the ZoneMap allows for skipping blocks and emitting blocks without scanning them.
+  // The three blocks contain the values [0, 4095], [4096, 8191], and [8192, 12286] plus a NULL.
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, true);
+  const auto row_count = 3 * DEFAULT_ZONE_MAP_BLOCK_SIZE;
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, row_count);
+  for (auto value = int32_t{0}; value < static_cast<int32_t>(row_count) - 1; ++value) {
+    table->append({value});
+  }
+  table->append({NullValue{}});
+  table->last_chunk()->finalize();
+
+  if (encoding_supports_data_type(_encoding_type, DataType::Int)) {
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+  }
+  generate_chunk_pruning_statistics(table);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto column = get_column_expression(table_wrapper, ColumnID{0});
+
+  // Predicate, expected row count, and expected first value
+  const auto predicates = std::vector<std::tuple<std::shared_ptr<AbstractExpression>, size_t, int32_t>>{
+      {less_than_(column, 5000), 5000, 0},
+      {between_inclusive_(column, 4096, 8191), 4096, 4096},
+      {greater_than_equals_(column, 8000), 4287, 8000},
+      {equals_(column, 20000), 0, 0}};
+
+  for (const auto& [predicate, expected_row_count, expected_first_value] : predicates) {
+    const auto scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    scan->execute();
+
+    const auto& output = scan->get_output();
+    ASSERT_EQ(output->row_count(), expected_row_count);
+    if (expected_row_count > 0) {
+      EXPECT_EQ(output->get_value<int32_t>(ColumnID{0}, 0), expected_first_value);
+      EXPECT_EQ(output->get_value<int32_t>(ColumnID{0}, expected_row_count - 1),
+                expected_first_value + static_cast<int32_t>(expected_row_count) - 1);
+    }
+    EXPECT_EQ(dynamic_cast<TableScan::PerformanceData&>(*scan->performance_data).num_chunks_with_zone_map, 1u);
+  }
+}
+
 TEST_P(OperatorsTableScanTest, GetImpl) {
   /**
    * Test that the correct scanning backend is chosen
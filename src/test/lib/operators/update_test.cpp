@@ -8,12 +8,15 @@
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
 #include "operators/get_table.hpp"
+#include "operators/insert.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/table.hpp"
+#include "storage/table_key_constraint.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -83,4 +86,53 @@ TEST_F(OperatorsUpdateTest, UpdateNone) {
   helper(greater_than_(column_a, 100'000), expression_vector(1, 1.5f), "resources/test_data/tbl/int_float2.tbl");
 }
 
+TEST_F(OperatorsUpdateTest, UpdateOwnInsertedRowWithKeyConstraint) {
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Float, false}}, TableType::Data, 2,
+      UseMvcc::Yes);
+  table->add_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  Hyrise::get().storage_manager.add_table("keyConstraintTable", table);
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto values = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  values->append({1, 1.5f});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+  const auto insert = std::make_shared<Insert>("keyConstraintTable", table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+  ASSERT_FALSE(insert->execute_failed());
+
+  // The Update deletes the row and inserts it again with the same key. As the deleted row was inserted by the same
+  // transaction, it never becomes visible and does not violate the constraint.
+  const auto get_table = std::make_shared<GetTable>("keyConstraintTable");
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+  const auto where_scan = std::make_shared<TableScan>(validate, equals_(column_a, 1));
+  where_scan->execute();
+  const auto updated_values_projection = std::make_shared<Projection>(where_scan, expression_vector(column_a, 2.5f));
+  updated_values_projection->execute();
+
+  const auto update = std::make_shared<Update>("keyConstraintTable", where_scan, updated_values_projection);
+  update->set_transaction_context(transaction_context);
+  update->execute();
+  EXPECT_FALSE(update->execute_failed());
+  transaction_context->commit();
+
+  const auto post_update_transaction_context =
+      Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto post_update_get_table = std::make_shared<GetTable>("keyConstraintTable");
+  const auto post_update_validate = std::make_shared<Validate>(post_update_get_table);
+  post_update_validate->set_transaction_context(post_update_transaction_context);
+  post_update_get_table->execute();
+  post_update_validate->execute();
+
+  const auto expected_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  expected_table->append({1, 2.5f});
+  EXPECT_TABLE_EQ_UNORDERED(post_update_validate->get_output(), expected_table);
+}
+
 }  // namespace opossum
@@ -0,0 +1,85 @@
+#include <memory>
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/aggregate_from_metadata_rule.hpp"
+#include "strategy_base_test.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class AggregateFromMetadataRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    Hyrise::get().storage_manager.add_table("table", load_table("resources/test_data/tbl/int_int_int.tbl", 2));
+
+    rule = std::make_shared<AggregateFromMetadataRule>();
+    stored_table_node = StoredTableNode::make("table");
+    a = stored_table_node->get_column("a");
+    b = stored_table_node->get_column("b");
+  }
+
+  AggregateImplementation apply(const std::shared_ptr<AbstractLQPNode>& lqp) {
+    const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(apply_rule(rule, lqp));
+    return aggregate_node->aggregate_implementation;
+  }
+
+  std::shared_ptr<AggregateFromMetadataRule> rule;
+  std::shared_ptr<StoredTableNode> stored_table_node;
+  std::shared_ptr<LQPColumnExpression> a, b;
+};
+
+TEST_F(AggregateFromMetadataRuleTest, MinMaxCountOnStoredTable) {
+  const auto aggregates = expression_vector(min_(a), max_(b), count_(a), count_star_(stored_table_node));
+
+  // clang-format off
+  const auto validated_lqp =
+  AggregateNode::make(expression_vector(), aggregates,
+    ValidateNode::make(
+      stored_table_node));
+
+  const auto lqp =
+  AggregateNode::make(expression_vector(), expression_vector(max_(a)),
+    stored_table_node);
+  // clang-format on
+
+  EXPECT_EQ(apply(validated_lqp), AggregateImplementation::FromMetadata);
+  EXPECT_EQ(apply(lqp), AggregateImplementation::FromMetadata);
+}
+
+TEST_F(AggregateFromMetadataRuleTest, NotApplicable) {
+  // clang-format off
+  const auto group_by_lqp =
+  AggregateNode::make(expression_vector(b), expression_vector(max_(a)),
+    ValidateNode::make(
+      stored_table_node));
+
+  const auto sum_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(max_(a), sum_(b)),
+    ValidateNode::make(
+      stored_table_node));
+
+  const auto expression_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(max_(add_(a, 1))),
+    ValidateNode::make(
+      stored_table_node));
+
+  const auto predicate_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(count_star_(stored_table_node)),
+    PredicateNode::make(greater_than_(a, 5),
+      ValidateNode::make(
+        stored_table_node)));
+  // clang-format on
+
+  EXPECT_EQ(apply(group_by_lqp), AggregateImplementation::Hash);
+  EXPECT_EQ(apply(sum_lqp), AggregateImplementation::Hash);
+  EXPECT_EQ(apply(expression_lqp), AggregateImplementation::Hash);
+  EXPECT_EQ(apply(predicate_lqp), AggregateImplementation::Hash);
+}
+
+}  // namespace opossum
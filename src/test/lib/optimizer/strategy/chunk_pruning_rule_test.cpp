@@ -20,7 +20,9 @@
 #include "logical_query_plan/validate_node.hpp"
 #include "operators/get_table.hpp"
 #include "optimizer/strategy/chunk_pruning_rule.hpp"
+#include "statistics/attribute_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/statistics_objects/bloom_filter.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
@@ -305,6 +307,39 @@ TEST_F(ChunkPruningRuleTest, LotsOfRangesFilterTest) {
   EXPECT_EQ(pruned_chunk_ids, expected_chunk_ids);
 }
 
+TEST_F(ChunkPruningRuleTest, BloomFilterTest) {
+  // Both chunks cover the same value range, so that only the BloomFilter can prune the equality predicate
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::String, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto chunk_id = 0; chunk_id < 2; ++chunk_id) {
+    for (auto index = 0; index < 100; ++index) {
+      table->append({pmr_string{"key_" + std::to_string(1000 + 2 * index + chunk_id)}});
+    }
+  }
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  generate_chunk_pruning_statistics(table);
+  Hyrise::get().storage_manager.add_table("high_cardinality", table);
+
+  const auto statistics = std::dynamic_pointer_cast<AttributeStatistics<pmr_string>>(
+      (*table->get_chunk(ChunkID{0})->pruning_statistics())[ColumnID{0}]);
+  ASSERT_TRUE(statistics);
+  EXPECT_TRUE(statistics->bloom_filter);
+
+  auto stored_table_node = std::make_shared<StoredTableNode>("high_cardinality");
+  auto predicate_node =
+      std::make_shared<PredicateNode>(equals_(lqp_column_(stored_table_node, ColumnID{0}), "key_1051"));
+  predicate_node->set_left_input(stored_table_node);
+
+  auto pruned = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(pruned, predicate_node);
+  std::vector<ChunkID> expected_chunk_ids = {ChunkID{0}};
+  std::vector<ChunkID> pruned_chunk_ids = stored_table_node->pruned_chunk_ids();
+  EXPECT_EQ(pruned_chunk_ids, expected_chunk_ids);
+}
+
 TEST_F(ChunkPruningRuleTest, RunLengthSegmentPruningTest) {
   auto stored_table_node = std::make_shared<StoredTableNode>("run_length_compressed");
 
@@ -147,6 +147,24 @@ TEST_F(IndexScanRuleTest, IndexScanWithIndex) {
   EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
 }
 
+TEST_F(IndexScanRuleTest, NoTableARTIndexScanWithLossySearchValue) {
+  table->create_table_art_index(ColumnID{2});
+
+  generate_mock_statistics(1'000'000);
+
+  auto predicate_node_0 = PredicateNode::make(greater_than_(c, 19'900.5));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+
+  auto predicate_node_1 = PredicateNode::make(greater_than_(c, 19'900));
+  predicate_node_1->set_left_input(stored_table_node);
+
+  reordered = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::IndexScan);
+}
+
 TEST_F(IndexScanRuleTest, IndexScanWithIndexPrunedColumn) {
   table->create_index<GroupKeyIndex>({ColumnID{2}});
   stored_table_node->set_pruned_column_ids({ColumnID{0}});
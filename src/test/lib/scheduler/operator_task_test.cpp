@@ -126,4 +126,52 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   EXPECT_EQ(scan_b->get_output(), nullptr);
   EXPECT_EQ(scan_c->get_output(), nullptr);
 }
+
+TEST_F(OperatorTaskTest, MakeTasksFromMultipleOperators) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_equals_(a, 1234));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(a, 12346));
+
+  // The GetTable is shared by the subplans and is one of the requested operators itself
+  auto tasks = OperatorTask::make_tasks_from_operators({scan_b, gt_a});
+  ASSERT_EQ(tasks.size(), 3u);
+  for (auto& task : tasks) {
+    task->schedule();
+    // We don't have to wait here, because we are running the task tests without a scheduler
+  }
+
+  // The outputs of the requested operators are kept
+  EXPECT_NE(gt_a->get_output(), nullptr);
+  EXPECT_EQ(scan_a->get_output(), nullptr);
+  EXPECT_NE(scan_b->get_output(), nullptr);
+
+  // Executed operators are skipped
+  EXPECT_TRUE(OperatorTask::make_tasks_from_operators({scan_b, gt_a}).empty());
+}
+
+TEST_F(OperatorTaskTest, ExecutedInputsAreClearedByConsumers) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_equals_(a, 1234));
+  auto scan_b = std::make_shared<TableScan>(gt_a, less_than_(a, 12346));
+  auto union_positions = std::make_shared<UnionPositions>(scan_a, scan_b);
+
+  for (auto& task : OperatorTask::make_tasks_from_operators({gt_a})) {
+    task->schedule();
+  }
+  ASSERT_NE(gt_a->get_output(), nullptr);
+
+  // The executed GetTable is not executed again, but its output is cleared once both scans are done
+  auto tasks = OperatorTask::make_tasks_from_operator(union_positions);
+  ASSERT_EQ(tasks.size(), 4u);
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  EXPECT_EQ(gt_a->get_output(), nullptr);
+  EXPECT_EQ(scan_a->get_output(), nullptr);
+  EXPECT_EQ(scan_b->get_output(), nullptr);
+  EXPECT_NE(union_positions->get_output(), nullptr);
+}
 }  // namespace opossum
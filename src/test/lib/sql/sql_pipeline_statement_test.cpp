@@ -10,6 +10,7 @@
 #include "hyrise.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "operators/abstract_join_operator.hpp"
+#include "operators/pqp_utils.hpp"
 #include "operators/print.hpp"
 #include "operators/validate.hpp"
 #include "scheduler/job_task.hpp"
@@ -78,6 +79,37 @@ class SQLPipelineStatementTest : public BaseTest {
     return sql_pipeline._get_sql_pipeline_statements();
   }
 
+  // Adds the tables t and u. The statistics of t are created while it contains ten rows. Afterwards, 2'000 rows are
+  // added, so that t is underestimated by a factor of about 200.
+  static void _add_misestimated_tables() {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    const auto table_t = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000}, UseMvcc::Yes);
+    const auto table_u = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000}, UseMvcc::Yes);
+    for (auto row_id = int32_t{0}; row_id < 10; ++row_id) {
+      table_t->append({row_id});
+    }
+    for (auto row_id = int32_t{0}; row_id < 100; ++row_id) {
+      table_u->append({row_id});
+    }
+    Hyrise::get().storage_manager.add_table("t", table_t);
+    Hyrise::get().storage_manager.add_table("u", table_u);
+
+    for (auto row_id = int32_t{10}; row_id < 2'010; ++row_id) {
+      table_t->append({row_id % 100});
+    }
+
+    // Make the rows visible to transactions
+    for (const auto& table : {table_t, table_u}) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+          chunk->mvcc_data()->set_begin_cid(chunk_offset, CommitID{0});
+        }
+      }
+    }
+  }
+
   std::shared_ptr<Table> _table_a;
   std::shared_ptr<Table> _table_b;
   std::shared_ptr<Table> _table_int;
@@ -608,6 +640,71 @@ TEST_F(SQLPipelineStatementTest, GetTimes) {
   EXPECT_GT(metrics->plan_execution_duration, zero_duration);
 }
 
+TEST_F(SQLPipelineStatementTest, AdaptiveReoptimization) {
+  _add_misestimated_tables();
+  Hyrise::get().cardinality_feedback_cache = std::make_shared<CardinalityFeedbackCache>();
+
+  const auto sql = std::string{"SELECT * FROM t, u WHERE t.a = u.a"};
+  const auto pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+
+  auto sql_pipeline = SQLPipelineBuilder{sql}.with_pqp_cache(pqp_cache).enable_adaptive_execution().create_pipeline();
+  const auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+  const auto [pipeline_status, result_table] = statement->get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(result_table->row_count(), 2'010u);
+  EXPECT_GE(statement->metrics()->reoptimization_count, 1u);
+
+  // The re-optimized plan is cached. It is executed completely.
+  const auto cached_plan = pqp_cache->try_get(sql);
+  ASSERT_TRUE(cached_plan);
+  EXPECT_EQ(*cached_plan, statement->get_physical_plan());
+  EXPECT_EQ(OperatorTask::make_tasks_from_operator(statement->get_physical_plan()).size(), 0u);
+
+  // The outputs of the operators executed before the re-optimization were cleared by their consumers in the new plan
+  visit_pqp(statement->get_physical_plan(), [&](const auto& op) {
+    if (op != statement->get_physical_plan()) {
+      EXPECT_EQ(op->get_output(), nullptr);
+    }
+    return PQPVisitation::VisitInputs;
+  });
+
+  // Afterwards, the observed cardinalities are used for the estimation, and the plan is not re-optimized anymore
+  auto second_sql_pipeline = SQLPipelineBuilder{sql}.enable_adaptive_execution().create_pipeline();
+  const auto second_statement = get_sql_pipeline_statements(second_sql_pipeline).at(0);
+  const auto [second_pipeline_status, second_result_table] = second_statement->get_result_table();
+  EXPECT_EQ(second_pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(second_result_table->row_count(), 2'010u);
+  EXPECT_EQ(second_statement->metrics()->reoptimization_count, 0u);
+}
+
+TEST_F(SQLPipelineStatementTest, AdaptiveReoptimizationWithSharedInputs) {
+  _add_misestimated_tables();
+  Hyrise::get().cardinality_feedback_cache = std::make_shared<CardinalityFeedbackCache>();
+
+  // The operators reading t are shared by the inputs of both joins. Once all inputs were executed, the output of the
+  // GetTable operator is cleared, so that it must not be reused by the re-optimized plan. Of the values below ten, t
+  // contains 21 rows each.
+  const auto sql = std::string{"SELECT * FROM t AS t1, t AS t2, u WHERE t1.a = u.a AND t2.a = u.a AND t1.a < 10"};
+  auto sql_pipeline = SQLPipelineBuilder{sql}.enable_adaptive_execution().create_pipeline();
+  const auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+  const auto [pipeline_status, result_table] = statement->get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(result_table->row_count(), 10u * 21u * 21u);
+  EXPECT_GE(statement->metrics()->reoptimization_count, 1u);
+}
+
+TEST_F(SQLPipelineStatementTest, AdaptiveExecutionIsOptIn) {
+  _add_misestimated_tables();
+  Hyrise::get().cardinality_feedback_cache = std::make_shared<CardinalityFeedbackCache>();
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM t, u WHERE t.a = u.a"}.create_pipeline();
+  const auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+  const auto [pipeline_status, result_table] = statement->get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(result_table->row_count(), 2'010u);
+  EXPECT_EQ(statement->metrics()->reoptimization_count, 0u);
+}
+
 TEST_F(SQLPipelineStatementTest, CacheQueryPlan) {
   auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.with_lqp_cache(_lqp_cache).create_pipeline();
   auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
@@ -31,6 +31,7 @@
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
 #include "storage/table_column_definition.hpp"
 #include "utils/load_table.hpp"
 
@@ -846,6 +847,139 @@ TEST_F(CardinalityEstimatorTest, StoredTable) {
   EXPECT_EQ(estimator.estimate_cardinality(StoredTableNode::make("t")), 3);
 }
 
+TEST_F(CardinalityEstimatorTest, CorrelatedPredicatesOnStoredTable) {
+  // Each of the ten cities lies in one of two countries
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("city", DataType::Int, false);
+  column_definitions.emplace_back("country", DataType::Int, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{256}, UseMvcc::Yes);
+  for (auto row_id = int32_t{0}; row_id < 1'000; ++row_id) {
+    table->append({row_id % 10, row_id % 10 / 5});
+  }
+  Hyrise::get().storage_manager.add_table("t", table);
+
+  const auto stored_table_node = StoredTableNode::make("t");
+  const auto city = stored_table_node->get_column("city");
+  const auto country = stored_table_node->get_column("country");
+
+  // Assuming independence, 1'000 * 0.1 * 0.5 = 50 rows would be estimated
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(country, 0),
+    ValidateNode::make(
+      PredicateNode::make(equals_(city, 3),
+        stored_table_node)));
+  // clang-format on
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp), 100.0f);
+
+  // clang-format off
+  const auto reordered_lqp =
+  PredicateNode::make(equals_(city, 3),
+    PredicateNode::make(equals_(country, 0),
+      stored_table_node));
+  // clang-format on
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(reordered_lqp), 100.0f);
+
+  // The city does not lie in the other country
+  // clang-format off
+  const auto empty_lqp =
+  PredicateNode::make(equals_(country, 1),
+    PredicateNode::make(equals_(city, 3),
+      stored_table_node));
+  // clang-format on
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(empty_lqp), 0.0f);
+}
+
+TEST_F(CardinalityEstimatorTest, CorrelatedPredicatesDoNotIncreaseCardinality) {
+  // a = 100 is not among the most common values of a, but (100, 0) is the most common combination of a and b. Thus,
+  // the combination is estimated to be more frequent than a = 100 alone.
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Int, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{256}, UseMvcc::Yes);
+  for (auto row_id = int32_t{0}; row_id < 1'000; ++row_id) {
+    table->append({row_id / 10, row_id});
+  }
+  table->append({100, 0});
+  table->append({100, 0});
+  for (auto value = int32_t{101}; value < 200; ++value) {
+    table->append({value, 0});
+  }
+  Hyrise::get().storage_manager.add_table("t", table);
+
+  const auto stored_table_node = StoredTableNode::make("t");
+  const auto a = stored_table_node->get_column("a");
+  const auto b = stored_table_node->get_column("b");
+
+  const auto lower_lqp = PredicateNode::make(equals_(a, 100), stored_table_node);
+  const auto input_lqp = PredicateNode::make(equals_(b, 0), lower_lqp);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp), estimator.estimate_cardinality(lower_lqp));
+}
+
+TEST_F(CardinalityEstimatorTest, ForeignKeyJoin) {
+  // Each of the 100 customers has ten orders
+  auto customer_column_definitions = TableColumnDefinitions{};
+  customer_column_definitions.emplace_back("c_id", DataType::Int, false);
+  const auto customer_table =
+      std::make_shared<Table>(customer_column_definitions, TableType::Data, ChunkOffset{256}, UseMvcc::Yes);
+  for (auto row_id = int32_t{0}; row_id < 100; ++row_id) {
+    customer_table->append({row_id});
+  }
+  customer_table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  Hyrise::get().storage_manager.add_table("customer", customer_table);
+
+  auto order_column_definitions = TableColumnDefinitions{};
+  order_column_definitions.emplace_back("o_id", DataType::Int, false);
+  order_column_definitions.emplace_back("o_c_id", DataType::Int, false);
+  const auto order_table =
+      std::make_shared<Table>(order_column_definitions, TableType::Data, ChunkOffset{256}, UseMvcc::Yes);
+  for (auto row_id = int32_t{0}; row_id < 1'000; ++row_id) {
+    order_table->append({row_id, row_id % 100});
+  }
+  order_table->add_soft_foreign_key_constraint({{ColumnID{1}}, "customer", {ColumnID{0}}});
+  Hyrise::get().storage_manager.add_table("order", order_table);
+
+  const auto customer_node = StoredTableNode::make("customer");
+  const auto order_node = StoredTableNode::make("order");
+  const auto c_id = customer_node->get_column("c_id");
+  const auto o_id = order_node->get_column("o_id");
+  const auto o_c_id = order_node->get_column("o_c_id");
+
+  // The orders of the remaining customers are joined
+  const auto customer_predicate_node = PredicateNode::make(less_than_(c_id, 10), customer_node);
+  const auto customer_selectivity = estimator.estimate_cardinality(customer_predicate_node) / 100.0f;
+  EXPECT_FLOAT_EQ(
+      estimator.estimate_cardinality(JoinNode::make(JoinMode::Inner, equals_(o_c_id, c_id), order_node,
+                                                    customer_predicate_node)),
+      1'000.0f * customer_selectivity);
+  EXPECT_FLOAT_EQ(
+      estimator.estimate_cardinality(JoinNode::make(JoinMode::Inner, equals_(c_id, o_c_id), customer_predicate_node,
+                                                    order_node)),
+      1'000.0f * customer_selectivity);
+
+  // Each of the remaining orders finds its customer
+  const auto order_predicate_node = PredicateNode::make(less_than_(o_id, 500), order_node);
+  EXPECT_FLOAT_EQ(
+      estimator.estimate_cardinality(JoinNode::make(JoinMode::Inner, equals_(o_c_id, c_id), order_predicate_node,
+                                                    customer_node)),
+      estimator.estimate_cardinality(order_predicate_node));
+
+  // Joins on other columns are not foreign key joins
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(o_id, c_id), order_node, customer_predicate_node);
+  const auto output_table_statistics = estimator.estimate_statistics(join_node);
+  EXPECT_NE(output_table_statistics->row_count, 1'000.0f * customer_selectivity);
+
+  // If the customers were joined with their orders before, each customer occurs ten times. Joining these with the
+  // orders again yields more rows than there are orders.
+  const auto other_order_node = StoredTableNode::make("order");
+  const auto other_o_c_id = other_order_node->get_column("o_c_id");
+  const auto customer_order_join_node =
+      JoinNode::make(JoinMode::Inner, equals_(c_id, other_o_c_id), customer_node, other_order_node);
+  EXPECT_GT(estimator.estimate_cardinality(
+                JoinNode::make(JoinMode::Inner, equals_(o_c_id, c_id), order_node, customer_order_join_node)),
+            1'000.0f);
+}
+
 TEST_F(CardinalityEstimatorTest, Validate) {
   // Test Validate doesn't break the TableStatistics. The CardinalityEstimator is not estimating anything for Validate
   // as there are no statistics available atm to base such an estimation on.
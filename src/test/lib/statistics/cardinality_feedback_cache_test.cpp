@@ -0,0 +1,146 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/cardinality_feedback_cache.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CardinalityFeedbackCacheTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Columns a and b are equal in 900 of 1'000 rows, which the statistics cannot tell
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::Int, false);
+    table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100}, UseMvcc::Yes);
+    for (auto row_id = int32_t{0}; row_id < 1'000; ++row_id) {
+      table->append({row_id, row_id < 900 ? row_id : row_id + 1});
+    }
+    // Make the rows visible to transactions
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        chunk->mvcc_data()->set_begin_cid(chunk_offset, CommitID{0});
+      }
+    }
+    Hyrise::get().storage_manager.add_table("t", table);
+
+    Hyrise::get().cardinality_feedback_cache = std::make_shared<CardinalityFeedbackCache>();
+  }
+
+  static std::shared_ptr<AbstractLQPNode> make_predicate_node(const std::shared_ptr<AbstractExpression>& predicate) {
+    const auto stored_table_node = StoredTableNode::make("t");
+    return PredicateNode::make(predicate, stored_table_node);
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(CardinalityFeedbackCacheTest, SubplansAreComparedByValue) {
+  const auto stored_table_node_a = StoredTableNode::make("t");
+  const auto stored_table_node_b = StoredTableNode::make("t");
+  const auto a_a = stored_table_node_a->get_column("a");
+  const auto a_b = stored_table_node_a->get_column("b");
+  const auto b_a = stored_table_node_b->get_column("a");
+  const auto b_b = stored_table_node_b->get_column("b");
+
+  // Equal subplans share an entry, even though their nodes are different objects
+  auto cache = CardinalityFeedbackCache{};
+  cache.store(PredicateNode::make(equals_(a_a, a_b), stored_table_node_a), 42.0f);
+  EXPECT_EQ(cache.get(PredicateNode::make(equals_(b_a, b_b), stored_table_node_b)), 42.0f);
+  EXPECT_FALSE(cache.get(PredicateNode::make(equals_(b_b, b_a), stored_table_node_b)));
+  EXPECT_FALSE(cache.get(PredicateNode::make(equals_(b_a, 5), stored_table_node_b)));
+
+  // Columns of different nodes of the same table are distinguished
+  cache.store(JoinNode::make(JoinMode::Inner, equals_(a_a, b_b), stored_table_node_a, stored_table_node_b), 43.0f);
+  EXPECT_EQ(cache.get(JoinNode::make(JoinMode::Inner, equals_(a_a, b_b), stored_table_node_a, stored_table_node_b)),
+            43.0f);
+  EXPECT_FALSE(cache.get(JoinNode::make(JoinMode::Inner, equals_(a_b, b_a), stored_table_node_a, stored_table_node_b)));
+
+  // Subplans whose cardinality cannot be reproduced are not cached
+  const auto mock_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}});
+  EXPECT_TRUE(CardinalityFeedbackCache::is_cacheable(stored_table_node_a));
+  EXPECT_FALSE(CardinalityFeedbackCache::is_cacheable(mock_node));
+  EXPECT_FALSE(CardinalityFeedbackCache::is_cacheable(
+      PredicateNode::make(equals_(a_a, placeholder_(ParameterID{0})), stored_table_node_a)));
+}
+
+TEST_F(CardinalityFeedbackCacheTest, StoreAndGet) {
+  auto cache = CardinalityFeedbackCache{};
+  cache.store(make_predicate_node(equals_(1, 1)), 42.0f);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_EQ(cache.get(make_predicate_node(equals_(1, 1))), 42.0f);
+  EXPECT_FALSE(cache.get(make_predicate_node(equals_(1, 2))));
+
+  cache.store(MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}), 42.0f);
+  EXPECT_EQ(cache.size(), 1u);
+
+  cache.clear();
+  EXPECT_FALSE(cache.get(make_predicate_node(equals_(1, 1))));
+}
+
+TEST_F(CardinalityFeedbackCacheTest, Staleness) {
+  auto cache = CardinalityFeedbackCache{};
+  cache.store(make_predicate_node(equals_(1, 1)), 42.0f);
+
+  // Up to 10% of the table's rows can be changed before the observation is stale
+  for (auto row_id = int32_t{0}; row_id < 100; ++row_id) {
+    table->append({row_id, row_id});
+  }
+  EXPECT_EQ(cache.get(make_predicate_node(equals_(1, 1))), 42.0f);
+
+  table->increase_invalidated_row_count(1);
+  EXPECT_FALSE(cache.get(make_predicate_node(equals_(1, 1))));
+
+  // A new observation replaces the stale one
+  cache.store(make_predicate_node(equals_(1, 1)), 43.0f);
+  EXPECT_EQ(cache.get(make_predicate_node(equals_(1, 1))), 43.0f);
+
+  // Observations for tables that were replaced are stale
+  Hyrise::get().storage_manager.drop_table("t");
+  Hyrise::get().storage_manager.add_table("t", std::make_shared<Table>(table->column_definitions(), TableType::Data));
+  EXPECT_FALSE(cache.get(make_predicate_node(equals_(1, 1))));
+}
+
+TEST_F(CardinalityFeedbackCacheTest, EstimationUsesObservedCardinalities) {
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM t WHERE a = b"}.create_pipeline();
+  const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(result_table->row_count(), 900u);
+
+  auto predicate_node = std::shared_ptr<AbstractLQPNode>{};
+  visit_lqp(sql_pipeline.get_optimized_logical_plans().at(0), [&](const auto& node) {
+    if (node->type == LQPNodeType::Predicate) predicate_node = node;
+    return LQPVisitation::VisitInputs;
+  });
+  ASSERT_TRUE(predicate_node);
+
+  const auto estimator = CardinalityEstimator{};
+  const auto feedback_cache = Hyrise::get().cardinality_feedback_cache;
+  Hyrise::get().cardinality_feedback_cache = nullptr;
+  const auto estimated_cardinality = estimator.estimate_cardinality(predicate_node);
+  Hyrise::get().cardinality_feedback_cache = feedback_cache;
+
+  // Equal subplans of other LQPs use the observed cardinality as well
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(predicate_node), 900.0f);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(predicate_node->deep_copy()), 900.0f);
+
+  // After the table changed, the observation is not used anymore
+  for (auto row_id = int32_t{0}; row_id < 200; ++row_id) {
+    table->append({row_id, row_id});
+  }
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(predicate_node), estimated_cardinality);
+}
+
+}  // namespace opossum
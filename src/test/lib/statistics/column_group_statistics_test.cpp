@@ -0,0 +1,80 @@
+#include "base_test.hpp"
+
+#include <cmath>
+
+#include "statistics/column_group_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ColumnGroupStatisticsTest : public BaseTest {
+ public:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::String, false);
+    table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3});
+
+    // (1, "x") occurs three times, (2, "y") twice, all other combinations once
+    table->append({1, "x"});
+    table->append({2, "y"});
+    table->append({1, "x"});
+    table->append({1, "y"});
+    table->append({2, "y"});
+    table->append({1, "x"});
+    table->append({NULL_VALUE, "x"});
+    table->append({3, "z"});
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(ColumnGroupStatisticsTest, FromTable) {
+  const auto statistics = ColumnGroupStatistics::from_table(*table, {ColumnID{0}, ColumnID{1}}, 2);
+  EXPECT_EQ(statistics->column_ids, std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+  EXPECT_EQ(statistics->data_types, std::vector<DataType>({DataType::Int, DataType::String}));
+  EXPECT_FLOAT_EQ(statistics->row_count, 8.0f);
+  EXPECT_FLOAT_EQ(statistics->distinct_count, 5.0f);
+
+  ASSERT_EQ(statistics->most_common_values.size(), 2u);
+  EXPECT_EQ(statistics->most_common_values[0].first, std::vector<AllTypeVariant>({int32_t{1}, pmr_string{"x"}}));
+  EXPECT_FLOAT_EQ(statistics->most_common_values[0].second, 3.0f);
+  EXPECT_EQ(statistics->most_common_values[1].first, std::vector<AllTypeVariant>({int32_t{2}, pmr_string{"y"}}));
+  EXPECT_FLOAT_EQ(statistics->most_common_values[1].second, 2.0f);
+}
+
+TEST_F(ColumnGroupStatisticsTest, FromSample) {
+  // The sample consists of the first two chunks. (1, "x") occurs three times and (2, "y") twice in them, (1, "y") once.
+  const auto statistics = ColumnGroupStatistics::from_table(*table, {ColumnID{0}, ColumnID{1}}, 1, 3);
+  EXPECT_FLOAT_EQ(statistics->row_count, 8.0f);
+
+  // Each sampled row stands for 8 / 6 rows. The combination occurring once stands for sqrt(8 / 6) combinations.
+  EXPECT_FLOAT_EQ(statistics->distinct_count, std::sqrt(8.0f / 6.0f) + 2.0f);
+  ASSERT_EQ(statistics->most_common_values.size(), 1u);
+  EXPECT_EQ(statistics->most_common_values[0].first, std::vector<AllTypeVariant>({int32_t{1}, pmr_string{"x"}}));
+  EXPECT_FLOAT_EQ(statistics->most_common_values[0].second, 4.0f);
+}
+
+TEST_F(ColumnGroupStatisticsTest, EstimateEquals) {
+  const auto statistics = ColumnGroupStatistics::from_table(*table, {ColumnID{0}, ColumnID{1}}, 2);
+
+  // Most common values
+  EXPECT_FLOAT_EQ(statistics->estimate_equals({int32_t{1}, pmr_string{"x"}}), 3.0f / 8.0f);
+  EXPECT_FLOAT_EQ(statistics->estimate_equals({int64_t{2}, pmr_string{"y"}}), 2.0f / 8.0f);
+
+  // The remaining three rows are distributed over three combinations
+  EXPECT_FLOAT_EQ(statistics->estimate_equals({int32_t{3}, pmr_string{"z"}}), 1.0f / 8.0f);
+  EXPECT_FLOAT_EQ(statistics->estimate_equals({int32_t{4}, pmr_string{"z"}}), 1.0f / 8.0f);
+
+  // Values that cannot occur in the columns
+  EXPECT_FLOAT_EQ(statistics->estimate_equals({1.5f, pmr_string{"x"}}), 0.0f);
+  EXPECT_FLOAT_EQ(statistics->estimate_equals({NULL_VALUE, pmr_string{"x"}}), 0.0f);
+
+  // If all combinations are most common values, other combinations do not occur
+  const auto single_column_statistics = ColumnGroupStatistics::from_table(*table, {ColumnID{1}});
+  EXPECT_FLOAT_EQ(single_column_statistics->distinct_count, 3.0f);
+  EXPECT_FLOAT_EQ(single_column_statistics->estimate_equals({pmr_string{"x"}}), 4.0f / 8.0f);
+  EXPECT_FLOAT_EQ(single_column_statistics->estimate_equals({pmr_string{"w"}}), 0.0f);
+}
+
+}  // namespace opossum
@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "statistics/statistics_objects/bloom_filter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename T>
+class BloomFilterTest : public BaseTest {
+ protected:
+  // Returns the value with the given index. Even indexes are contained in the filter, odd indexes are not.
+  static T value(const int index) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      return pmr_string{"order-" + std::to_string(index * 7919)};
+    } else {
+      return static_cast<T>(index * 7919);
+    }
+  }
+
+  void SetUp() override {
+    for (auto index = 0; index < 2 * VALUE_COUNT; index += 2) {
+      _values.emplace_back(value(index));
+    }
+    std::sort(_values.begin(), _values.end());
+  }
+
+  static constexpr auto VALUE_COUNT = 1000;
+  pmr_vector<T> _values;
+};
+
+using BloomFilterTypes = ::testing::Types<int32_t, int64_t, float, double, pmr_string>;
+TYPED_TEST_SUITE(BloomFilterTest, BloomFilterTypes, );  // NOLINT(whitespace/parens)
+
+TYPED_TEST(BloomFilterTest, NoFalseNegatives) {
+  const auto filter = BloomFilter<TypeParam>::build_filter(this->_values);
+  ASSERT_TRUE(filter);
+  EXPECT_EQ(filter->blocks.size(), this->VALUE_COUNT * DEFAULT_BLOOM_FILTER_BITS_PER_VALUE / 256 + 1);
+
+  for (const auto& value : this->_values) {
+    EXPECT_TRUE(filter->may_contain(value));
+    EXPECT_FALSE(filter->does_not_contain(PredicateCondition::Equals, value));
+  }
+}
+
+TYPED_TEST(BloomFilterTest, FewFalsePositives) {
+  const auto filter = BloomFilter<TypeParam>::build_filter(this->_values);
+
+  auto false_positive_count = 0;
+  for (auto index = 1; index < 2 * this->VALUE_COUNT; index += 2) {
+    false_positive_count += filter->may_contain(this->value(index));
+  }
+
+  // The expected false positive rate is below 0.5%. We allow for some variance.
+  EXPECT_LT(false_positive_count, this->VALUE_COUNT / 100);
+}
+
+TYPED_TEST(BloomFilterTest, DoesNotContain) {
+  const auto filter = BloomFilter<TypeParam>::build_filter(this->_values);
+  const auto contained_value = this->value(42);
+
+  // Only equality predicates can be pruned
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::Equals, contained_value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::Equals, NullValue{}));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::LessThan, contained_value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::NotEquals, contained_value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::BetweenInclusive, contained_value, contained_value));
+
+  // Find a value that is not contained and not a false positive
+  auto missing_value = this->value(1);
+  for (auto index = 3; filter->may_contain(missing_value); index += 2) {
+    missing_value = this->value(index);
+  }
+  EXPECT_TRUE(filter->does_not_contain(PredicateCondition::Equals, missing_value));
+  EXPECT_TRUE(filter->does_not_contain(PredicateCondition::BetweenInclusive, missing_value, missing_value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::BetweenInclusive, missing_value, contained_value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::GreaterThan, missing_value));
+
+  EXPECT_FALSE(filter->sliced(PredicateCondition::Equals, missing_value));
+  const auto sliced_filter =
+      std::dynamic_pointer_cast<BloomFilter<TypeParam>>(filter->sliced(PredicateCondition::Equals, contained_value));
+  ASSERT_TRUE(sliced_filter);
+  EXPECT_EQ(sliced_filter->blocks, filter->blocks);
+}
+
+TYPED_TEST(BloomFilterTest, EmptyDictionary) {
+  EXPECT_FALSE(BloomFilter<TypeParam>::build_filter(pmr_vector<TypeParam>{}));
+
+  // A single value still gets a block
+  const auto filter = BloomFilter<TypeParam>::build_filter(pmr_vector<TypeParam>{this->value(0)});
+  EXPECT_EQ(filter->blocks.size(), 1u);
+  EXPECT_TRUE(filter->may_contain(this->value(0)));
+}
+
+TYPED_TEST(BloomFilterTest, NegativeZero) {
+  if constexpr (std::is_floating_point_v<TypeParam>) {
+    const auto filter = BloomFilter<TypeParam>::build_filter(pmr_vector<TypeParam>{-1.0, 0.0, 1.0});
+    EXPECT_TRUE(filter->may_contain(TypeParam{-0.0}));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "statistics/statistics_objects/zone_map.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Blocks of four rows: [1, 4], [5, 8] with one NULL, [5, 5], and only NULLs
+    auto blocks = std::vector<ZoneMap<int32_t>::Block>{{1, 4, 0, 4}, {5, 8, 1, 4}, {5, 5, 0, 4}, {0, 0, 2, 2}};
+    _zone_map = std::make_shared<ZoneMap<int32_t>>(ChunkOffset{4}, std::move(blocks));
+  }
+
+  std::shared_ptr<ZoneMap<int32_t>> _zone_map;
+};
+
+TEST_F(ZoneMapTest, MatchBlocks) {
+  using Match = ZoneMapBlockMatch;
+
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::Equals, 5),
+            (std::vector{Match::None, Match::Some, Match::All, Match::None}));
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::Equals, 9),
+            (std::vector{Match::None, Match::None, Match::None, Match::None}));
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::NotEquals, 5),
+            (std::vector{Match::All, Match::Some, Match::None, Match::None}));
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::LessThan, 5),
+            (std::vector{Match::All, Match::None, Match::None, Match::None}));
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::LessThanEquals, 5),
+            (std::vector{Match::All, Match::Some, Match::All, Match::None}));
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::GreaterThan, 4),
+            (std::vector{Match::None, Match::Some, Match::All, Match::None}));
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::GreaterThanEquals, 4),
+            (std::vector{Match::Some, Match::Some, Match::All, Match::None}));
+}
+
+TEST_F(ZoneMapTest, MatchBlocksBetween) {
+  using Match = ZoneMapBlockMatch;
+
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::BetweenInclusive, 1, 5),
+            (std::vector{Match::All, Match::Some, Match::All, Match::None}));
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::BetweenExclusive, 1, 5),
+            (std::vector{Match::Some, Match::None, Match::None, Match::None}));
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::BetweenLowerExclusive, 4, 8),
+            (std::vector{Match::None, Match::Some, Match::All, Match::None}));
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::BetweenUpperExclusive, 5, 9),
+            (std::vector{Match::None, Match::Some, Match::All, Match::None}));
+}
+
+TEST_F(ZoneMapTest, UnsupportedPredicates) {
+  using Match = ZoneMapBlockMatch;
+  const auto all_some = std::vector{Match::Some, Match::Some, Match::Some, Match::Some};
+
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::Equals, NullValue{}), all_some);
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::IsNull, NullValue{}), all_some);
+  EXPECT_EQ(_zone_map->match_blocks(PredicateCondition::BetweenInclusive, 1, NullValue{}), all_some);
+
+  // ZoneMaps refer to positions in their segment and cannot be sliced or scaled
+  EXPECT_FALSE(_zone_map->sliced(PredicateCondition::Equals, 5));
+  EXPECT_FALSE(_zone_map->scaled(0.5f));
+}
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #include "base_test.hpp"
 
+#include <cmath>
+
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
@@ -8,7 +10,33 @@
 
 namespace opossum {
 
-class TableStatisticsTest : public BaseTest {};
+class TableStatisticsTest : public BaseTest {
+ public:
+  // Creates a table with ten chunks of 100 rows. Column a contains each of the values 0 to 9 ten times per chunk,
+  // column b is unique.
+  static std::shared_ptr<Table> create_table() {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::Int, false);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100});
+    append_rows(*table, 0, 1'000);
+    return table;
+  }
+
+  static void append_rows(Table& table, const int32_t begin, const int32_t end) {
+    for (auto row_id = begin; row_id < end; ++row_id) {
+      table.append({row_id % 10, row_id});
+    }
+  }
+
+  template <typename T>
+  static std::shared_ptr<AbstractHistogram<T>> histogram(const TableStatistics& table_statistics,
+                                                         const ColumnID column_id) {
+    const auto column_statistics =
+        std::dynamic_pointer_cast<AttributeStatistics<T>>(table_statistics.column_statistics.at(column_id));
+    return column_statistics ? column_statistics->histogram : nullptr;
+  }
+};
 
 TEST_F(TableStatisticsTest, FromTable) {
   const auto table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", 20);
@@ -41,4 +69,92 @@ TEST_F(TableStatisticsTest, FromTable) {
   EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 190);
 }
 
+TEST_F(TableStatisticsTest, FromTableSampled) {
+  const auto table = create_table();
+
+  // The chunks 0, 3, and 6 are sampled
+  const auto table_statistics = TableStatistics::from_table(*table, 300);
+  EXPECT_FLOAT_EQ(table_statistics->row_count, 1'000.0f);
+
+  const auto histogram_a = histogram<int32_t>(*table_statistics, ColumnID{0});
+  ASSERT_TRUE(histogram_a);
+  EXPECT_FLOAT_EQ(histogram_a->total_count(), 1'000.0f);
+  EXPECT_FLOAT_EQ(histogram_a->total_distinct_count(), 10.0f);
+
+  // All sampled values of column b occur once, so the distinct count is extrapolated
+  const auto histogram_b = histogram<int32_t>(*table_statistics, ColumnID{1});
+  ASSERT_TRUE(histogram_b);
+  EXPECT_FLOAT_EQ(histogram_b->total_count(), 1'000.0f);
+  EXPECT_NEAR(histogram_b->total_distinct_count(), std::sqrt(1'000.0f / 300.0f) * 300.0f, 1.0f);
+  EXPECT_EQ(histogram_b->bin_minimum(BinID{0}), 0);
+  EXPECT_EQ(histogram_b->bin_maximum(histogram_b->bin_count() - 1), 699);
+
+  // Tables that are not larger than the sample are not sampled
+  const auto full_table_statistics = TableStatistics::from_table(*table, 1'000);
+  const auto full_histogram_b = histogram<int32_t>(*full_table_statistics, ColumnID{1});
+  ASSERT_TRUE(full_histogram_b);
+  EXPECT_FLOAT_EQ(full_histogram_b->total_distinct_count(), 1'000.0f);
+  EXPECT_EQ(full_histogram_b->bin_maximum(full_histogram_b->bin_count() - 1), 999);
+}
+
+TEST_F(TableStatisticsTest, Updated) {
+  const auto table = create_table();
+  const auto table_statistics = TableStatistics::from_table(*table);
+
+  append_rows(*table, 1'000, 1'100);
+  const auto updated_table_statistics = table_statistics->updated(*table, {ChunkID{10}});
+  EXPECT_FLOAT_EQ(updated_table_statistics->row_count, 1'100.0f);
+  EXPECT_FLOAT_EQ(updated_table_statistics->added_row_count, 100.0f);
+
+  // The values of column a are already contained in the histogram, those of column b are new
+  const auto histogram_a = histogram<int32_t>(*updated_table_statistics, ColumnID{0});
+  ASSERT_TRUE(histogram_a);
+  EXPECT_FLOAT_EQ(histogram_a->total_count(), 1'100.0f);
+  EXPECT_FLOAT_EQ(histogram_a->total_distinct_count(), 10.0f);
+
+  const auto histogram_b = histogram<int32_t>(*updated_table_statistics, ColumnID{1});
+  ASSERT_TRUE(histogram_b);
+  EXPECT_FLOAT_EQ(histogram_b->total_count(), 1'100.0f);
+  EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 1'100.0f);
+  EXPECT_EQ(histogram_b->bin_maximum(histogram_b->bin_count() - 1), 1'099);
+
+  // Once more than 20% of the rows were added, the statistics are created anew
+  append_rows(*table, 1'100, 1'250);
+  const auto recreated_table_statistics = updated_table_statistics->updated(*table, {ChunkID{11}, ChunkID{12}});
+  EXPECT_FLOAT_EQ(recreated_table_statistics->row_count, 1'250.0f);
+  EXPECT_FLOAT_EQ(recreated_table_statistics->added_row_count, 0.0f);
+  EXPECT_FLOAT_EQ(histogram<int32_t>(*recreated_table_statistics, ColumnID{1})->total_count(), 1'250.0f);
+}
+
+TEST_F(TableStatisticsTest, UpdatedWithPreviouslyMutableChunk) {
+  // Chunk 10 is mutable and contains 50 rows when the statistics are created
+  const auto table = create_table();
+  append_rows(*table, 1'000, 1'050);
+  const auto table_statistics = TableStatistics::from_table(*table);
+  EXPECT_FLOAT_EQ(table_statistics->row_count, 1'050.0f);
+
+  // Finalizing the chunk does not add any rows
+  table->get_chunk(ChunkID{10})->finalize();
+  const auto updated_table_statistics = table_statistics->updated(*table, {ChunkID{10}});
+  EXPECT_FLOAT_EQ(updated_table_statistics->row_count, 1'050.0f);
+  EXPECT_FLOAT_EQ(updated_table_statistics->added_row_count, 0.0f);
+  EXPECT_FLOAT_EQ(histogram<int32_t>(*updated_table_statistics, ColumnID{0})->total_count(), 1'050.0f);
+  EXPECT_FLOAT_EQ(histogram<int32_t>(*updated_table_statistics, ColumnID{1})->total_count(), 1'050.0f);
+}
+
+TEST_F(TableStatisticsTest, UpdatedWithAppendedRowsOfPreviouslyMutableChunk) {
+  const auto table = create_table();
+  append_rows(*table, 1'000, 1'050);
+  const auto table_statistics = TableStatistics::from_table(*table);
+
+  // Only the 30 rows appended to chunk 10 after the statistics were created are added
+  append_rows(*table, 1'050, 1'080);
+  table->get_chunk(ChunkID{10})->finalize();
+  const auto updated_table_statistics = table_statistics->updated(*table, {ChunkID{10}});
+  EXPECT_FLOAT_EQ(updated_table_statistics->row_count, 1'080.0f);
+  EXPECT_FLOAT_EQ(updated_table_statistics->added_row_count, 30.0f);
+  EXPECT_FLOAT_EQ(histogram<int32_t>(*updated_table_statistics, ColumnID{0})->total_count(), 1'080.0f);
+  EXPECT_TRUE(updated_table_statistics->mutable_chunk_sizes.empty());
+}
+
 }  // namespace opossum
@@ -12,6 +12,7 @@
 #include "storage/base_value_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment/shared_dictionary.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/table.hpp"
 
@@ -235,4 +236,99 @@ TEST_F(ChunkEncoderTest, ReencodingTable) {
   }
 }
 
+TEST_F(ChunkEncoderTest, EncodeColumnWithSharedDictionary) {
+  const auto expected_rows = _table->get_rows();
+
+  // The segments of the last (mutable) chunk are not encoded and do not prevent the others from sharing a dictionary
+  ChunkEncoder::encode_column_with_shared_dictionary(_table, ColumnID{1});
+  EXPECT_TRUE(get_shared_dictionary<int32_t>(*_table, ColumnID{1}));
+  EXPECT_EQ(get_segment_encoding_spec(_table->last_chunk()->get_segment(ColumnID{1})).encoding_type,
+            EncodingType::Unencoded);
+
+  _table->last_chunk()->finalize();
+  ChunkEncoder::encode_column_with_shared_dictionary(_table, ColumnID{1}, VectorCompressionType::SimdBp128);
+
+  const auto dictionary = get_shared_dictionary<int32_t>(*_table, ColumnID{1});
+  ASSERT_TRUE(dictionary);
+  EXPECT_EQ(dictionary->size(), 15u);
+  EXPECT_EQ(_table->get_rows(), expected_rows);
+
+  // ValueIDs are comparable across chunks
+  const auto chunk_count = _table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto segment =
+        std::dynamic_pointer_cast<DictionarySegment<int32_t>>(_table->get_chunk(chunk_id)->get_segment(ColumnID{1}));
+    ASSERT_TRUE(segment);
+    EXPECT_EQ(segment->dictionary(), dictionary);
+    EXPECT_EQ(segment->compressed_vector_type(), CompressedVectorType::SimdBp128);
+    EXPECT_EQ(segment->lower_bound(AllTypeVariant{int32_t{7}}), ValueID{7});
+  }
+
+  // Other columns and separately encoded segments do not share a dictionary
+  EXPECT_FALSE(get_shared_dictionary<int32_t>(*_table, ColumnID{0}));
+  ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_FALSE(get_shared_dictionary<int32_t>(*_table, ColumnID{0}));
+  EXPECT_EQ(get_shared_dictionary<int32_t>(*_table, ColumnID{1}), dictionary);
+}
+
+TEST_F(ChunkEncoderTest, AttachNewChunksToSharedDictionary) {
+  _table->last_chunk()->finalize();
+  ChunkEncoder::encode_column_with_shared_dictionary(_table, ColumnID{1});
+  const auto dictionary = get_shared_dictionary<int32_t>(*_table, ColumnID{1});
+  ASSERT_TRUE(dictionary);
+
+  // New chunks whose values are part of the dictionary are encoded with it
+  for (auto value = int32_t{3}; value < 8; ++value) {
+    _table->append({value, value, value});
+  }
+  _table->last_chunk()->finalize();
+  ChunkEncoder::encode_chunks(_table, {ChunkID{3}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_EQ(get_shared_dictionary<int32_t>(*_table, ColumnID{1}), dictionary);
+  EXPECT_FALSE(get_shared_dictionary<int32_t>(*_table, ColumnID{0}));
+
+  // New values require a new shared dictionary
+  for (auto value = int32_t{20}; value < 25; ++value) {
+    _table->append({value, value, value});
+  }
+  _table->last_chunk()->finalize();
+  const auto expected_rows = _table->get_rows();
+  ChunkEncoder::encode_chunks(_table, {ChunkID{4}}, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  const auto new_dictionary = get_shared_dictionary<int32_t>(*_table, ColumnID{1});
+  ASSERT_TRUE(new_dictionary);
+  EXPECT_NE(new_dictionary, dictionary);
+  EXPECT_EQ(new_dictionary->size(), 20u);
+  EXPECT_EQ(_table->get_rows(), expected_rows);
+}
+
+TEST_F(ChunkEncoderTest, RebuildSharedDictionaryForNewValues) {
+  _table->last_chunk()->finalize();
+  ChunkEncoder::encode_column_with_shared_dictionary(_table, ColumnID{1});
+  const auto dictionary = get_shared_dictionary<int32_t>(*_table, ColumnID{1});
+  ASSERT_TRUE(dictionary);
+
+  // A chunk with new values keeps its own dictionary until the shared dictionary is rebuilt
+  for (auto value = int32_t{20}; value < 25; ++value) {
+    _table->append({value, value, value});
+  }
+  const auto chunk = _table->last_chunk();
+  chunk->finalize();
+  ChunkEncoder::encode_chunk(chunk, _table->column_data_types(), SegmentEncodingSpec{EncodingType::Dictionary});
+  ChunkEncoder::attach_to_shared_dictionaries(_table, ChunkID{3});
+  EXPECT_FALSE(get_shared_dictionary<int32_t>(*_table, ColumnID{1}));
+  const auto segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->dictionary()->size(), 5u);
+  EXPECT_EQ(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+                _table->get_chunk(ChunkID{0})->get_segment(ColumnID{1}))->dictionary(),
+            dictionary);
+
+  const auto expected_rows = _table->get_rows();
+  ChunkEncoder::rebuild_shared_dictionaries(_table);
+  const auto new_dictionary = get_shared_dictionary<int32_t>(*_table, ColumnID{1});
+  ASSERT_TRUE(new_dictionary);
+  EXPECT_EQ(new_dictionary->size(), 20u);
+  EXPECT_EQ(_table->get_rows(), expected_rows);
+}
+
 }  // namespace opossum
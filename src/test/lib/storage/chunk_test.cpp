@@ -1,3 +1,4 @@
+#include <filesystem>
 #include <memory>
 
 #include "base_test.hpp"
@@ -5,6 +6,7 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/segment_encoding_utils.hpp"
@@ -90,6 +92,93 @@ TEST_F(StorageChunkTest, FinalizeSetsMaxBeginCid) {
   EXPECT_EQ(mvcc_data_chunk->max_begin_cid, 3);
 }
 
+TEST_F(StorageChunkTest, EvictAndLoadSegment) {
+  chunk = std::make_shared<Chunk>(Segments({ds_int, ds_str}));
+  const auto file_name = (std::filesystem::temp_directory_path() / "hyrise_chunk_test_segment.bin").string();
+
+  // Segments of mutable chunks cannot be evicted
+  EXPECT_THROW(chunk->evict_segment(ColumnID{0}, file_name), std::logic_error);
+
+  chunk->finalize();
+  ds_int->access_counter[SegmentAccessCounter::AccessType::Point] = 5;
+  chunk->evict_segment(ColumnID{0}, file_name);
+
+  EXPECT_TRUE(std::filesystem::exists(file_name));
+  EXPECT_FALSE(chunk->get_resident_segment(ColumnID{0}));
+  EXPECT_FALSE(chunk->segment_residency(ColumnID{0}).is_resident);
+  EXPECT_EQ(chunk->segment_residency(ColumnID{0}).eviction_count, 1);
+  EXPECT_TRUE(chunk->segment_residency(ColumnID{1}).is_resident);
+
+  // The size is known without loading the segment
+  EXPECT_EQ(chunk->size(), 3u);
+  EXPECT_FALSE(chunk->get_resident_segment(ColumnID{0}));
+
+  // Accessing the segment loads it
+  const auto segment = chunk->get_segment(ColumnID{0});
+  ASSERT_TRUE(segment);
+  EXPECT_NE(segment, ds_int);
+  EXPECT_EQ(get_segment_encoding_spec(segment).encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ((*segment)[ChunkOffset{0}], AllTypeVariant{4});
+  EXPECT_EQ((*segment)[ChunkOffset{1}], AllTypeVariant{6});
+  EXPECT_EQ((*segment)[ChunkOffset{2}], AllTypeVariant{3});
+  EXPECT_EQ(segment->access_counter[SegmentAccessCounter::AccessType::Point], 5);
+
+  EXPECT_FALSE(std::filesystem::exists(file_name));
+  EXPECT_TRUE(chunk->segment_residency(ColumnID{0}).is_resident);
+  EXPECT_EQ(chunk->segment_residency(ColumnID{0}).load_count, 1);
+  EXPECT_EQ(chunk->get_segment(ColumnID{0}), segment);
+
+  // Only encoded segments can be evicted
+  const auto value_segment_chunk = std::make_shared<Chunk>(Segments({vs_int}));
+  value_segment_chunk->finalize();
+  EXPECT_THROW(value_segment_chunk->evict_segment(ColumnID{0}, file_name), std::logic_error);
+}
+
+TEST_F(StorageChunkTest, LoadSegmentKeepsIndexesAndSharedDictionary) {
+  const auto file_name = (std::filesystem::temp_directory_path() / "hyrise_chunk_test_segment.bin").string();
+
+  {
+    // The index holds the evicted segment, so loading it re-uses the segment and the index is still found
+    const auto indexed_chunk = std::make_shared<Chunk>(Segments({ds_int, ds_str}));
+    indexed_chunk->finalize();
+    indexed_chunk->create_index<CompositeGroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}, ColumnID{1}});
+    EXPECT_TRUE(indexed_chunk->is_indexed(ColumnID{1}));
+    indexed_chunk->evict_segment(ColumnID{1}, file_name);
+    EXPECT_EQ(indexed_chunk->get_segment(ColumnID{1}), ds_str);
+    EXPECT_EQ(indexed_chunk->get_indexes(std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}).size(), 1u);
+  }
+
+  // The segment of another chunk shares the dictionary. Once the evicted segment is released, the loaded segment is
+  // attached to that dictionary.
+  auto dictionary_segment = std::static_pointer_cast<DictionarySegment<int>>(ds_int);
+  const auto other_segment = std::make_shared<DictionarySegment<int>>(dictionary_segment->dictionary(),
+                                                                      dictionary_segment->attribute_vector());
+  chunk = std::make_shared<Chunk>(Segments({ds_int}));
+  chunk->finalize();
+  EXPECT_FALSE(chunk->is_indexed(ColumnID{0}));
+  chunk->evict_segment(ColumnID{0}, file_name);
+
+  const auto evicted_segment = std::weak_ptr<AbstractSegment>{ds_int};
+  ds_int.reset();
+  dictionary_segment.reset();
+  EXPECT_TRUE(evicted_segment.expired());
+
+  const auto loaded_segment = std::dynamic_pointer_cast<DictionarySegment<int>>(chunk->get_segment(ColumnID{0}));
+  ASSERT_TRUE(loaded_segment);
+  EXPECT_EQ(loaded_segment->dictionary(), other_segment->dictionary());
+  EXPECT_EQ((*loaded_segment)[ChunkOffset{1}], AllTypeVariant{6});
+}
+
+TEST_F(StorageChunkTest, IsEvictable) {
+  EXPECT_TRUE(Chunk::is_evictable(*ds_int));
+  EXPECT_FALSE(Chunk::is_evictable(*vs_int));
+
+  // The binary segment format does not support SIMD-BP128
+  const auto simd_bp128_segment = ChunkEncoder::encode_segment(
+      vs_int, DataType::Int, SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128});
+  EXPECT_FALSE(Chunk::is_evictable(*simd_bp128_segment));
+}
+
 TEST_F(StorageChunkTest, AddIndexByColumnID) {
   chunk = std::make_shared<Chunk>(Segments({ds_int, ds_str}));
   auto index_int = chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
@@ -0,0 +1,69 @@
+#include "base_test.hpp"
+
+#include "storage/foreign_key_constraint.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ForeignKeyConstraintTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("column0", DataType::Int, false);
+    column_definitions.emplace_back("column1", DataType::Int, false);
+    column_definitions.emplace_back("column2", DataType::Int, true);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ForeignKeyConstraintTest, Accessors) {
+  const auto foreign_key_constraint =
+      ForeignKeyConstraint{{ColumnID{2}, ColumnID{0}}, "referenced_table", {ColumnID{3}, ColumnID{4}}};
+  EXPECT_EQ(foreign_key_constraint.columns(), std::unordered_set<ColumnID>({ColumnID{0}, ColumnID{2}}));
+  EXPECT_EQ(foreign_key_constraint.ordered_columns(), std::vector<ColumnID>({ColumnID{2}, ColumnID{0}}));
+  EXPECT_EQ(foreign_key_constraint.referenced_table_name(), "referenced_table");
+  EXPECT_EQ(foreign_key_constraint.referenced_columns(), std::vector<ColumnID>({ColumnID{3}, ColumnID{4}}));
+}
+
+TEST_F(ForeignKeyConstraintTest, InvalidConstraints) {
+  EXPECT_THROW(ForeignKeyConstraint({}, "referenced_table", {}), std::logic_error);
+  EXPECT_THROW(ForeignKeyConstraint({ColumnID{0}}, "referenced_table", {ColumnID{0}, ColumnID{1}}), std::logic_error);
+  EXPECT_THROW(ForeignKeyConstraint({ColumnID{0}, ColumnID{0}}, "referenced_table", {ColumnID{0}, ColumnID{1}}),
+               std::logic_error);
+}
+
+TEST_F(ForeignKeyConstraintTest, Equals) {
+  const auto foreign_key_constraint =
+      ForeignKeyConstraint{{ColumnID{0}, ColumnID{1}}, "referenced_table", {ColumnID{2}, ColumnID{3}}};
+
+  EXPECT_EQ(foreign_key_constraint,
+            ForeignKeyConstraint({ColumnID{0}, ColumnID{1}}, "referenced_table", {ColumnID{2}, ColumnID{3}}));
+  EXPECT_EQ(foreign_key_constraint,
+            ForeignKeyConstraint({ColumnID{1}, ColumnID{0}}, "referenced_table", {ColumnID{3}, ColumnID{2}}));
+  EXPECT_NE(foreign_key_constraint,
+            ForeignKeyConstraint({ColumnID{1}, ColumnID{0}}, "referenced_table", {ColumnID{2}, ColumnID{3}}));
+  EXPECT_NE(foreign_key_constraint,
+            ForeignKeyConstraint({ColumnID{0}, ColumnID{1}}, "other_table", {ColumnID{2}, ColumnID{3}}));
+  EXPECT_NE(foreign_key_constraint, ForeignKeyConstraint({ColumnID{0}}, "referenced_table", {ColumnID{2}}));
+  EXPECT_NE(foreign_key_constraint, TableKeyConstraint({ColumnID{0}, ColumnID{1}}, KeyConstraintType::UNIQUE));
+}
+
+TEST_F(ForeignKeyConstraintTest, AddForeignKeyConstraints) {
+  EXPECT_TRUE(_table->soft_foreign_key_constraints().empty());
+  _table->add_soft_foreign_key_constraint({{ColumnID{0}}, "referenced_table", {ColumnID{0}}});
+  _table->add_soft_foreign_key_constraint({{ColumnID{1}, ColumnID{2}}, "referenced_table", {ColumnID{1}, ColumnID{2}}});
+  ASSERT_EQ(_table->soft_foreign_key_constraints().size(), 2);
+  EXPECT_EQ(_table->soft_foreign_key_constraints()[1].referenced_columns(),
+            std::vector<ColumnID>({ColumnID{1}, ColumnID{2}}));
+
+  // Duplicate constraint
+  EXPECT_THROW(_table->add_soft_foreign_key_constraint({{ColumnID{0}}, "referenced_table", {ColumnID{0}}}),
+               std::logic_error);
+  // ColumnID out of range
+  EXPECT_THROW(_table->add_soft_foreign_key_constraint({{ColumnID{3}}, "referenced_table", {ColumnID{0}}}),
+               std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/index/table_art/concurrent_art.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ConcurrentARTTest : public BaseTest {
+ protected:
+  // Big-endian encoding, so that the byte-wise order equals the numerical order
+  static ConcurrentART::Key key(const uint32_t value) {
+    return {static_cast<uint8_t>(value >> 24), static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 8),
+            static_cast<uint8_t>(value)};
+  }
+
+  static std::vector<RowID> range(const ConcurrentART& tree, const std::optional<ConcurrentART::Bound>& lower_bound,
+                                  const std::optional<ConcurrentART::Bound>& upper_bound) {
+    auto result = std::vector<RowID>{};
+    tree.range_lookup(lower_bound, upper_bound, result);
+    return result;
+  }
+
+  static RowID row_id(const uint32_t value) { return RowID{ChunkID{value / 1000}, ChunkOffset{value % 1000}}; }
+
+  ConcurrentART tree;
+};
+
+TEST_F(ConcurrentARTTest, InsertAndLookup) {
+  tree.insert(key(5), row_id(0));
+  tree.insert(key(7), row_id(1));
+  tree.insert(key(5), row_id(2));
+
+  EXPECT_EQ(tree.size(), 3u);
+  EXPECT_EQ(tree.lookup(key(5)), std::vector<RowID>({row_id(0), row_id(2)}));
+  EXPECT_EQ(tree.lookup(key(7)), std::vector<RowID>({row_id(1)}));
+  EXPECT_TRUE(tree.lookup(key(6)).empty());
+  EXPECT_TRUE(tree.lookup(key(5 << 8)).empty());
+}
+
+TEST_F(ConcurrentARTTest, NodeGrowth) {
+  // The children of the node below the prefix 0x00 0x00 0x01 grow from 4 over 16 and 48 to 256
+  for (auto value = uint32_t{256}; value < 512; ++value) {
+    tree.insert(key(value), row_id(value));
+  }
+
+  for (auto value = uint32_t{256}; value < 512; ++value) {
+    EXPECT_EQ(tree.lookup(key(value)), std::vector<RowID>({row_id(value)}));
+  }
+  EXPECT_TRUE(tree.lookup(key(512)).empty());
+
+  const auto all = range(tree, std::nullopt, std::nullopt);
+  ASSERT_EQ(all.size(), 256u);
+  for (auto index = uint32_t{0}; index < 256; ++index) {
+    EXPECT_EQ(all[index], row_id(256 + index));
+  }
+}
+
+TEST_F(ConcurrentARTTest, LongPrefixes) {
+  // The keys share more than MAX_PREFIX_LENGTH bytes
+  const auto common = ConcurrentART::Key(3 * ConcurrentART::MAX_PREFIX_LENGTH, uint8_t{42});
+  auto key_a = common;
+  key_a.push_back(1);
+  auto key_b = common;
+  key_b.push_back(2);
+  auto key_c = ConcurrentART::Key(ConcurrentART::MAX_PREFIX_LENGTH + 2, uint8_t{42});
+  key_c.push_back(0);
+
+  tree.insert(key_b, row_id(2));
+  tree.insert(key_a, row_id(1));
+  tree.insert(key_c, row_id(0));
+
+  EXPECT_EQ(tree.lookup(key_a), std::vector<RowID>({row_id(1)}));
+  EXPECT_EQ(tree.lookup(key_b), std::vector<RowID>({row_id(2)}));
+  EXPECT_EQ(tree.lookup(key_c), std::vector<RowID>({row_id(0)}));
+  EXPECT_EQ(range(tree, std::nullopt, std::nullopt), std::vector<RowID>({row_id(0), row_id(1), row_id(2)}));
+  EXPECT_EQ(range(tree, ConcurrentART::Bound{key_a, false}, std::nullopt), std::vector<RowID>({row_id(2)}));
+}
+
+TEST_F(ConcurrentARTTest, RangeLookup) {
+  auto reference = std::multimap<uint32_t, RowID>{};
+  auto random_engine = std::mt19937{17};
+  auto distribution = std::uniform_int_distribution<uint32_t>{0, 5000};
+
+  for (auto index = uint32_t{0}; index < 2000; ++index) {
+    const auto value = distribution(random_engine);
+    tree.insert(key(value), row_id(index));
+    reference.emplace(value, row_id(index));
+  }
+
+  for (auto iteration = 0; iteration < 100; ++iteration) {
+    auto lower = distribution(random_engine);
+    auto upper = distribution(random_engine);
+    if (lower > upper) std::swap(lower, upper);
+    const auto lower_inclusive = iteration % 2 == 0;
+    const auto upper_inclusive = iteration % 3 == 0;
+
+    auto expected = std::vector<RowID>{};
+    for (auto it = reference.lower_bound(lower); it != reference.end(); ++it) {
+      if (it->first > upper || (it->first == upper && !upper_inclusive)) break;
+      if (it->first == lower && !lower_inclusive) continue;
+      expected.emplace_back(it->second);
+    }
+
+    // RowIDs of the same key are not ordered
+    const auto lower_bound = ConcurrentART::Bound{key(lower), lower_inclusive};
+    const auto upper_bound = ConcurrentART::Bound{key(upper), upper_inclusive};
+    auto actual = range(tree, lower_bound, upper_bound);
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    EXPECT_EQ(actual, expected);
+  }
+
+  EXPECT_EQ(range(tree, std::nullopt, std::nullopt).size(), 2000u);
+  EXPECT_TRUE(range(tree, ConcurrentART::Bound{key(6000), true}, std::nullopt).empty());
+}
+
+TEST_F(ConcurrentARTTest, Erase) {
+  tree.insert(key(1), row_id(0));
+  tree.insert(key(1), row_id(1));
+  tree.insert(key(2), row_id(2));
+
+  EXPECT_TRUE(tree.erase(key(1), row_id(0)));
+  EXPECT_FALSE(tree.erase(key(1), row_id(0)));
+  EXPECT_FALSE(tree.erase(key(3), row_id(0)));
+  EXPECT_EQ(tree.size(), 2u);
+  EXPECT_EQ(tree.lookup(key(1)), std::vector<RowID>({row_id(1)}));
+
+  EXPECT_TRUE(tree.erase(key(1), row_id(1)));
+  EXPECT_TRUE(tree.lookup(key(1)).empty());
+  EXPECT_EQ(range(tree, std::nullopt, std::nullopt), std::vector<RowID>({row_id(2)}));
+
+  // A key without RowIDs can be reused
+  tree.insert(key(1), row_id(3));
+  EXPECT_EQ(tree.lookup(key(1)), std::vector<RowID>({row_id(3)}));
+}
+
+TEST_F(ConcurrentARTTest, ConcurrentInserts) {
+  constexpr auto THREAD_COUNT = uint32_t{8};
+  constexpr auto VALUES_PER_THREAD = uint32_t{2000};
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = uint32_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      // Interleave the values of the threads so that they modify the same nodes
+      for (auto index = uint32_t{0}; index < VALUES_PER_THREAD; ++index) {
+        const auto value = index * THREAD_COUNT + thread_id;
+        tree.insert(key(value * 7919), row_id(value));
+
+        // Values inserted before by this thread are visible despite concurrent modifications
+        if (index % 100 == 0) {
+          const auto previous_value = (index / 2) * THREAD_COUNT + thread_id;
+          EXPECT_EQ(tree.lookup(key(previous_value * 7919)), std::vector<RowID>({row_id(previous_value)}));
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(tree.size(), THREAD_COUNT * VALUES_PER_THREAD);
+  for (auto value = uint32_t{0}; value < THREAD_COUNT * VALUES_PER_THREAD; ++value) {
+    ASSERT_EQ(tree.lookup(key(value * 7919)), std::vector<RowID>({row_id(value)}));
+  }
+
+  const auto all = range(tree, std::nullopt, std::nullopt);
+  ASSERT_EQ(all.size(), THREAD_COUNT * VALUES_PER_THREAD);
+  for (auto value = uint32_t{0}; value < THREAD_COUNT * VALUES_PER_THREAD; ++value) {
+    EXPECT_EQ(all[value], row_id(value));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/index/table_art/table_art_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TableARTIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::String, false);
+    column_definitions.emplace_back("c", DataType::Double, false);
+
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+    table->append({5, "b", 1.5});
+    table->append({-3, pmr_string{"a\0b", 3}, -2.0});
+    table->append({NullValue{}, "", 0.0});
+    table->append({5, "ab", -0.5});
+    table->append({100, "a", 1e20});
+  }
+
+  static std::vector<RowID> sorted(std::vector<RowID> row_ids) {
+    std::sort(row_ids.begin(), row_ids.end());
+    return row_ids;
+  }
+
+  static RowID row(const ChunkID::base_type chunk_id, const ChunkOffset chunk_offset) {
+    return RowID{ChunkID{chunk_id}, chunk_offset};
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(TableARTIndexTest, CreateAndLookupInt) {
+  const auto index = table->create_table_art_index(ColumnID{0}, "a_art");
+
+  EXPECT_EQ(table->get_table_art_index(ColumnID{0}), index);
+  EXPECT_FALSE(table->get_table_art_index(ColumnID{1}));
+  EXPECT_FALSE(table->get_table_hash_index({ColumnID{0}}));
+  ASSERT_EQ(table->indexes_statistics().size(), 1u);
+  EXPECT_EQ(table->indexes_statistics().front().type, SegmentIndexType::TableART);
+
+  // The row with a NULL value is not indexed
+  EXPECT_EQ(index->size(), 4u);
+
+  EXPECT_EQ(sorted(index->lookup(PredicateCondition::Equals, 5)), std::vector<RowID>({row(0, 0), row(1, 0)}));
+  EXPECT_TRUE(index->lookup(PredicateCondition::Equals, 4).empty());
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThan, 5), std::vector<RowID>({row(0, 1)}));
+  EXPECT_EQ(sorted(index->lookup(PredicateCondition::LessThanEquals, 5)),
+            std::vector<RowID>({row(0, 0), row(0, 1), row(1, 0)}));
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThan, 5), std::vector<RowID>({row(1, 1)}));
+  EXPECT_EQ(sorted(index->lookup(PredicateCondition::GreaterThanEquals, -2)),
+            sorted(index->lookup(PredicateCondition::GreaterThan, -3)));
+  EXPECT_EQ(sorted(index->lookup(PredicateCondition::NotEquals, 5)), std::vector<RowID>({row(0, 1), row(1, 1)}));
+  EXPECT_EQ(sorted(index->lookup(PredicateCondition::BetweenInclusive, -3, 5)),
+            std::vector<RowID>({row(0, 0), row(0, 1), row(1, 0)}));
+  EXPECT_EQ(index->lookup(PredicateCondition::BetweenExclusive, -3, 100).size(), 2u);
+  EXPECT_EQ(index->lookup(PredicateCondition::BetweenLowerExclusive, -3, 100).size(), 3u);
+  EXPECT_EQ(index->lookup(PredicateCondition::BetweenUpperExclusive, -3, 100).size(), 3u);
+  EXPECT_TRUE(index->lookup(PredicateCondition::LessThan, NullValue{}).empty());
+
+  // Values of other types are converted if this is possible without loss
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThan, int64_t{5}), std::vector<RowID>({row(1, 1)}));
+  EXPECT_TRUE(index->lookup(PredicateCondition::Equals, 5.5).empty());
+  EXPECT_THROW(index->lookup(PredicateCondition::LessThan, 5.5), std::logic_error);
+  EXPECT_THROW(index->lookup(PredicateCondition::Like, 5), std::logic_error);
+}
+
+TEST_F(TableARTIndexTest, LookupString) {
+  const auto index = table->create_table_art_index(ColumnID{1});
+
+  // Order: "", "a", "a\0b", "ab", "b"
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, ""), std::vector<RowID>({row(0, 2)}));
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, pmr_string{"a\0b", 3}), std::vector<RowID>({row(0, 1)}));
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThanEquals, "a"), std::vector<RowID>({row(0, 2), row(1, 1)}));
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThan, "a"),
+            std::vector<RowID>({row(0, 1), row(1, 0), row(0, 0)}));
+  EXPECT_EQ(index->lookup(PredicateCondition::BetweenExclusive, "a", "b"), std::vector<RowID>({row(0, 1), row(1, 0)}));
+  EXPECT_TRUE(index->lookup(PredicateCondition::GreaterThan, "b").empty());
+}
+
+TEST_F(TableARTIndexTest, LookupDouble) {
+  const auto index = table->create_table_art_index(ColumnID{2});
+
+  // Order: -2.0, -0.5, 0.0, 1.5, 1e20
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThan, 0.0), std::vector<RowID>({row(0, 1), row(1, 0)}));
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, -0.0), std::vector<RowID>({row(0, 2)}));
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThanEquals, -0.5),
+            std::vector<RowID>({row(1, 0), row(0, 2), row(0, 0), row(1, 1)}));
+  EXPECT_EQ(index->lookup(PredicateCondition::BetweenInclusive, -3, 1),
+            std::vector<RowID>({row(0, 1), row(1, 0), row(0, 2)}));
+}
+
+TEST_F(TableARTIndexTest, CastSearchPredicate) {
+  const auto cast_predicate = TableARTIndex::cast_search_predicate(PredicateCondition::GreaterThan, int64_t{5},
+                                                                   NullValue{}, DataType::Int);
+  ASSERT_TRUE(cast_predicate);
+  EXPECT_EQ(cast_predicate->predicate_condition, PredicateCondition::GreaterThan);
+  EXPECT_EQ(cast_predicate->value, AllTypeVariant{int32_t{5}});
+
+  // Values that cannot be represented as floats are rounded towards the matching values
+  const auto float_predicate =
+      TableARTIndex::cast_search_predicate(PredicateCondition::BetweenExclusive, 3.1, 4.1, DataType::Float);
+  ASSERT_TRUE(float_predicate);
+  EXPECT_EQ(float_predicate->predicate_condition, PredicateCondition::BetweenInclusive);
+  EXPECT_GT(boost::get<float>(float_predicate->value), 3.1);
+  EXPECT_LT(boost::get<float>(float_predicate->value2), 4.1);
+
+  EXPECT_FALSE(TableARTIndex::cast_search_predicate(PredicateCondition::LessThan, 3.5, NullValue{}, DataType::Int));
+  EXPECT_FALSE(TableARTIndex::cast_search_predicate(PredicateCondition::BetweenInclusive, 1, 3.5, DataType::Int));
+
+  const auto null_predicate =
+      TableARTIndex::cast_search_predicate(PredicateCondition::LessThan, NullValue{}, NullValue{}, DataType::Int);
+  ASSERT_TRUE(null_predicate);
+  EXPECT_TRUE(variant_is_null(null_predicate->value));
+}
+
+TEST_F(TableARTIndexTest, MaintainedByAppendAndInsert) {
+  Hyrise::get().storage_manager.add_table("table", table);
+  const auto index = table->create_table_art_index(ColumnID{0});
+
+  table->append({7, "c", 2.0});
+  EXPECT_EQ(index->lookup(PredicateCondition::BetweenInclusive, 6, 8), std::vector<RowID>({row(1, 2)}));
+
+  auto values = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  values->append({6, "d", 3.0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto insert = std::make_shared<Insert>("table", table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+  EXPECT_EQ(index->lookup(PredicateCondition::BetweenInclusive, 6, 8), std::vector<RowID>({row(2, 0), row(1, 2)}));
+
+  // Rolled back rows are removed from the index
+  transaction_context->rollback(RollbackReason::User);
+  EXPECT_EQ(index->lookup(PredicateCondition::BetweenInclusive, 6, 8), std::vector<RowID>({row(1, 2)}));
+  EXPECT_EQ(index->size(), 5u);
+}
+
+}  // namespace opossum
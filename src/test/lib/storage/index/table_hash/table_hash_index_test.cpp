@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TableHashIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::String, false);
+
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+    table->append({1, "one"});
+    table->append({2, "two"});
+    table->append({NullValue{}, "null"});
+    table->append({1, "uno"});
+    table->append({3, "three"});
+  }
+
+  static std::vector<RowID> sorted(std::vector<RowID> row_ids) {
+    std::sort(row_ids.begin(), row_ids.end());
+    return row_ids;
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(TableHashIndexTest, CreateAndLookup) {
+  const auto index = table->create_table_hash_index({ColumnID{0}}, "a_hash");
+
+  EXPECT_EQ(table->get_table_hash_index({ColumnID{0}}), index);
+  EXPECT_FALSE(table->get_table_hash_index({ColumnID{1}}));
+  ASSERT_EQ(table->indexes_statistics().size(), 1u);
+  EXPECT_EQ(table->indexes_statistics().front().type, SegmentIndexType::TableHash);
+
+  // The row with a NULL value is not indexed
+  EXPECT_EQ(index->size(), 4u);
+
+  EXPECT_EQ(sorted(index->lookup({1})), std::vector<RowID>({RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}}));
+  EXPECT_EQ(index->lookup({3}), std::vector<RowID>({RowID{ChunkID{1}, 1}}));
+  EXPECT_TRUE(index->lookup({4}).empty());
+  EXPECT_TRUE(index->lookup({NullValue{}}).empty());
+
+  // Values of other types are converted if this is possible without loss
+  EXPECT_EQ(index->lookup({int64_t{2}}), std::vector<RowID>({RowID{ChunkID{0}, 1}}));
+  EXPECT_EQ(index->lookup({2.0f}), std::vector<RowID>({RowID{ChunkID{0}, 1}}));
+  EXPECT_TRUE(index->lookup({2.5}).empty());
+}
+
+TEST_F(TableHashIndexTest, MultiColumnLookup) {
+  const auto index = table->create_table_hash_index({ColumnID{0}, ColumnID{1}});
+
+  EXPECT_EQ(index->lookup({1, "uno"}), std::vector<RowID>({RowID{ChunkID{1}, 0}}));
+  EXPECT_TRUE(index->lookup({1, "two"}).empty());
+  EXPECT_TRUE(index->lookup({NullValue{}, "null"}).empty());
+}
+
+TEST_F(TableHashIndexTest, LookupChunkRange) {
+  const auto index = table->create_table_hash_index({ColumnID{0}});
+
+  const auto matches_per_row = index->lookup(*table->get_chunk(ChunkID{0}), ChunkID{0}, ChunkOffset{0}, ChunkOffset{3});
+  ASSERT_EQ(matches_per_row.size(), 3u);
+  EXPECT_EQ(sorted(matches_per_row[0]), std::vector<RowID>({RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}}));
+  EXPECT_EQ(matches_per_row[1], std::vector<RowID>({RowID{ChunkID{0}, 1}}));
+  EXPECT_TRUE(matches_per_row[2].empty());
+}
+
+TEST_F(TableHashIndexTest, AppendAndRemoveChunk) {
+  const auto index = table->create_table_hash_index({ColumnID{0}});
+
+  table->append({3, "tres"});
+  table->append({4, "four"});
+  EXPECT_EQ(index->size(), 6u);
+  EXPECT_EQ(sorted(index->lookup({3})), std::vector<RowID>({RowID{ChunkID{1}, 1}, RowID{ChunkID{1}, 2}}));
+  EXPECT_EQ(index->lookup({4}), std::vector<RowID>({RowID{ChunkID{2}, 0}}));
+
+  table->get_chunk(ChunkID{0})->increase_invalid_row_count(3);
+  table->remove_chunk(ChunkID{0});
+  EXPECT_EQ(index->size(), 4u);
+  EXPECT_EQ(index->lookup({1}), std::vector<RowID>({RowID{ChunkID{1}, 0}}));
+  EXPECT_TRUE(index->lookup({2}).empty());
+}
+
+TEST_F(TableHashIndexTest, DeferredErasure) {
+  const auto index = table->create_table_hash_index({ColumnID{0}});
+  const auto& chunk = *table->get_chunk(ChunkID{0});
+
+  index->erase_after_commit(chunk, RowIDPosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 2}}, CommitID{5});
+  EXPECT_EQ(index->pending_erasure_count(), 1u);
+
+  // Transactions with a snapshot commit id of 4 can still see the deleted row
+  index->erase_obsolete_entries(CommitID{4});
+  EXPECT_EQ(index->pending_erasure_count(), 1u);
+  EXPECT_EQ(index->lookup({1}).size(), 2u);
+
+  index->erase_obsolete_entries(CommitID{5});
+  EXPECT_EQ(index->pending_erasure_count(), 0u);
+  EXPECT_EQ(index->lookup({1}), std::vector<RowID>({RowID{ChunkID{1}, 0}}));
+}
+
+TEST_F(TableHashIndexTest, MaintainedByInsertAndDelete) {
+  Hyrise::get().storage_manager.add_table("table", table);
+  const auto index = table->create_table_hash_index({ColumnID{0}});
+
+  auto values = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  values->append({5, "five"});
+  values->append({5, "cinco"});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  // Rolled back rows are removed from the index
+  {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto insert = std::make_shared<Insert>("table", table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    EXPECT_EQ(index->lookup({5}).size(), 2u);
+
+    transaction_context->rollback(RollbackReason::User);
+    EXPECT_TRUE(index->lookup({5}).empty());
+  }
+
+  {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto insert = std::make_shared<Insert>("table", table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+    EXPECT_EQ(index->lookup({5}).size(), 2u);
+  }
+
+  // Deleted rows remain in the index until no active transaction can see them anymore
+  const auto delete_rows = [&](const int32_t value) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    const auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::Equals, value);
+    table_scan->execute();
+    const auto delete_op = std::make_shared<Delete>(table_scan);
+    delete_op->set_transaction_context(transaction_context);
+    delete_op->execute();
+    transaction_context->commit();
+  };
+
+  delete_rows(5);
+  EXPECT_EQ(index->pending_erasure_count(), 2u);
+
+  delete_rows(3);
+  EXPECT_TRUE(index->lookup({5}).empty());
+  EXPECT_EQ(index->pending_erasure_count(), 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/trigram/trigram_index.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TrigramIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto values = pmr_vector<pmr_string>{"ERR-1234 disk full", "WARN-77 slow",   "ERR-1235 disk full", "",
+                                         "ok",                 "err-1234 lower", "ERR-1234",           "null"};
+    auto null_values = pmr_vector<bool>{false, false, false, false, false, false, false, true};
+    segment = std::make_shared<ValueSegment<pmr_string>>(std::move(values), std::move(null_values));
+    index = std::make_shared<TrigramIndex>(std::vector<std::shared_ptr<const AbstractSegment>>({segment}));
+  }
+
+  std::shared_ptr<ValueSegment<pmr_string>> segment;
+  std::shared_ptr<TrigramIndex> index;
+};
+
+TEST_F(TrigramIndexTest, Candidates) {
+  EXPECT_EQ(index->type(), SegmentIndexType::Trigram);
+
+  EXPECT_EQ(index->candidates("%ERR-1234%"), std::vector<ChunkOffset>({0, 6}));
+  EXPECT_EQ(index->candidates("ERR-123_ disk%"), std::vector<ChunkOffset>({0, 2}));
+  EXPECT_EQ(index->candidates("%disk%ERR%"), std::vector<ChunkOffset>({0, 2}));
+  EXPECT_EQ(index->candidates("%slow"), std::vector<ChunkOffset>({1}));
+  EXPECT_EQ(index->candidates("%lower%"), std::vector<ChunkOffset>({5}));
+  EXPECT_TRUE(index->candidates("%ERR-9999%")->empty());
+
+  // NULL values are not indexed
+  EXPECT_TRUE(index->candidates("%nul%")->empty());
+
+  // Without a literal part of three or more characters, the index cannot narrow down the candidates
+  EXPECT_FALSE(index->candidates("%ok%"));
+  EXPECT_FALSE(index->candidates("E_R%"));
+  EXPECT_FALSE(TrigramIndex::is_pattern_supported("%ok%"));
+  EXPECT_TRUE(TrigramIndex::is_pattern_supported("%ERR-1234%"));
+}
+
+TEST_F(TrigramIndexTest, NullsAndRangeQueries) {
+  EXPECT_EQ(std::vector<ChunkOffset>(index->null_cbegin(), index->null_cend()), std::vector<ChunkOffset>({7}));
+  EXPECT_THROW(index->lower_bound({"ERR"}), std::logic_error);
+  EXPECT_THROW(index->cbegin(), std::logic_error);
+}
+
+TEST_F(TrigramIndexTest, EncodedSegment) {
+  const auto encoded_segment = ChunkEncoder::encode_segment(segment, DataType::String,
+                                                            SegmentEncodingSpec{EncodingType::FixedStringDictionary});
+  const auto encoded_index = TrigramIndex{std::vector<std::shared_ptr<const AbstractSegment>>({encoded_segment})};
+
+  EXPECT_EQ(encoded_index.candidates("%ERR-1234%"), std::vector<ChunkOffset>({0, 6}));
+  EXPECT_EQ(encoded_index.memory_consumption(), index->memory_consumption());
+}
+
+TEST_F(TrigramIndexTest, EstimateMemoryConsumption) {
+  EXPECT_EQ(TrigramIndex::estimate_memory_consumption(ChunkOffset{100}, ChunkOffset{10}, 2u), 0u);
+  EXPECT_GT(AbstractIndex::estimate_memory_consumption(SegmentIndexType::Trigram, ChunkOffset{100}, ChunkOffset{10},
+                                                       20u),
+            100u * 18u * sizeof(ChunkOffset));
+}
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/lz4_segment/lz4_block_cache.hpp"
+
+namespace opossum {
+
+class LZ4BlockCacheTest : public BaseTest {
+ protected:
+  static LZ4BlockCache::Block block(const size_t size) { return std::make_shared<const std::vector<char>>(size, 'x'); }
+};
+
+TEST_F(LZ4BlockCacheTest, SetAndGet) {
+  auto cache = LZ4BlockCache{100};
+  EXPECT_EQ(cache.capacity(), 100u);
+
+  const auto block_a = block(10);
+  cache.set({0, 0}, block_a);
+  cache.set({0, 1}, block(20));
+  cache.set({1, 0}, block(30));
+
+  EXPECT_EQ(cache.size(), 3u);
+  EXPECT_EQ(cache.memory_usage(), 60u);
+  EXPECT_EQ(cache.try_get({0, 0}), block_a);
+  EXPECT_EQ(cache.try_get({1, 0})->size(), 30u);
+  EXPECT_FALSE(cache.try_get({1, 1}));
+
+  // Setting an existing key replaces the block
+  cache.set({0, 0}, block(5));
+  EXPECT_EQ(cache.size(), 3u);
+  EXPECT_EQ(cache.memory_usage(), 55u);
+  EXPECT_EQ(cache.try_get({0, 0})->size(), 5u);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.memory_usage(), 0u);
+  EXPECT_FALSE(cache.try_get({0, 0}));
+}
+
+TEST_F(LZ4BlockCacheTest, EvictLeastRecentlyUsed) {
+  auto cache = LZ4BlockCache{100};
+
+  cache.set({0, 0}, block(40));
+  cache.set({0, 1}, block(40));
+
+  // Accessing the first block makes the second one the least recently used block
+  EXPECT_TRUE(cache.try_get({0, 0}));
+
+  cache.set({0, 2}, block(40));
+  EXPECT_EQ(cache.memory_usage(), 80u);
+  EXPECT_TRUE(cache.try_get({0, 0}));
+  EXPECT_FALSE(cache.try_get({0, 1}));
+  EXPECT_TRUE(cache.try_get({0, 2}));
+
+  // Blocks larger than the capacity are not cached
+  cache.set({0, 3}, block(101));
+  EXPECT_FALSE(cache.try_get({0, 3}));
+  EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST_F(LZ4BlockCacheTest, Resize) {
+  auto cache = LZ4BlockCache{100};
+
+  cache.set({0, 0}, block(40));
+  cache.set({0, 1}, block(40));
+
+  cache.resize(50);
+  EXPECT_EQ(cache.capacity(), 50u);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_FALSE(cache.try_get({0, 0}));
+  EXPECT_TRUE(cache.try_get({0, 1}));
+
+  cache.resize(0);
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.memory_usage(), 0u);
+}
+
+TEST_F(LZ4BlockCacheTest, UniqueSegmentIds) {
+  const auto first_id = LZ4BlockCache::next_segment_id();
+  const auto second_id = LZ4BlockCache::next_segment_id();
+  EXPECT_NE(first_id, second_id);
+}
+
+}  // namespace opossum
@@ -5,10 +5,12 @@
 #include "base_test.hpp"
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/lz4_segment/lz4_encoder.hpp"
+#include "storage/lz4_segment/lz4_segment_iterable.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/value_segment.hpp"
 #include "types.hpp"
@@ -343,4 +345,68 @@ TEST_F(StorageLZ4SegmentTest, CompressDictionaryIntSegment) {
   EXPECT_EQ(decompressed_data[20124], 40248);
 }
 
+TEST_F(StorageLZ4SegmentTest, DecompressUsesBlockCache) {
+  const auto num_rows = 100'000 / 4;
+  for (auto index = size_t{0u}; index < num_rows; ++index) {
+    vs_int->append(static_cast<int>(index * 2));
+  }
+  auto lz4_segment = compress(vs_int, DataType::Int);
+  ASSERT_GT(lz4_segment->lz4_blocks().size(), 1u);
+
+  auto& block_cache = *Hyrise::get().lz4_block_cache;
+  block_cache.clear();
+
+  EXPECT_EQ(lz4_segment->decompress(ChunkOffset{1u}), 2);
+  EXPECT_EQ(block_cache.size(), 1u);
+  EXPECT_EQ(block_cache.memory_usage(), LZ4Encoder::_block_size);
+
+  // Values of the same block are retrieved from the cached block
+  EXPECT_EQ(lz4_segment->decompress(ChunkOffset{200u}), 400);
+  EXPECT_EQ(lz4_segment->get_typed_value(ChunkOffset{3u}), 6);
+  EXPECT_EQ(block_cache.size(), 1u);
+
+  EXPECT_EQ(lz4_segment->decompress(ChunkOffset{num_rows - 1}), 2 * (num_rows - 1));
+  EXPECT_EQ(block_cache.size(), 2u);
+
+  // Copies of the segment do not share cached blocks with the original segment
+  const auto copy = std::static_pointer_cast<LZ4Segment<int>>(lz4_segment->copy_using_allocator({}));
+  EXPECT_EQ(copy->decompress(ChunkOffset{1u}), 2);
+  EXPECT_EQ(block_cache.size(), 3u);
+
+  // Without a block cache, blocks are decompressed on each access
+  Hyrise::get().lz4_block_cache = nullptr;
+  EXPECT_EQ(lz4_segment->decompress(ChunkOffset{10123u}), 20246);
+}
+
+TEST_F(StorageLZ4SegmentTest, PointAccessWithUnorderedPositionList) {
+  const auto num_rows = 100'000 / 4;
+  for (auto index = size_t{0u}; index < num_rows; ++index) {
+    vs_int->append(static_cast<int>(index * 2));
+  }
+  auto lz4_segment = compress(vs_int, DataType::Int);
+
+  // Alternate between the first and the last block
+  auto position_filter = std::make_shared<RowIDPosList>();
+  for (auto index = ChunkOffset{0u}; index < 100; ++index) {
+    position_filter->emplace_back(ChunkID{0}, index);
+    position_filter->emplace_back(ChunkID{0}, static_cast<ChunkOffset>(num_rows - 1 - index));
+  }
+  position_filter->guarantee_single_chunk();
+
+  Hyrise::get().lz4_block_cache->clear();
+
+  auto values = std::vector<int>{};
+  LZ4SegmentIterable<int>{*lz4_segment}.with_iterators(position_filter, [&](auto it, const auto end) {
+    for (; it != end; ++it) {
+      values.emplace_back(it->value());
+    }
+  });
+
+  ASSERT_EQ(values.size(), position_filter->size());
+  for (auto index = size_t{0u}; index < values.size(); ++index) {
+    EXPECT_EQ(values[index], static_cast<int>((*position_filter)[index].chunk_offset * 2));
+  }
+  EXPECT_EQ(Hyrise::get().lz4_block_cache->size(), 2u);
+}
+
 }  // namespace opossum
@@ -1,8 +1,17 @@
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "base_test.hpp"
 
+#include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "storage/table.hpp"
 #include "storage/table_key_constraint.hpp"
 
@@ -33,6 +42,23 @@ class TableKeyConstraintTest : public BaseTest {
     }
   }
 
+  // Inserts the given rows into the table and returns whether the Insert succeeded
+  static bool insert(const std::string& table_name, const std::vector<std::vector<AllTypeVariant>>& rows,
+                     const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto& target_table = Hyrise::get().storage_manager.get_table(table_name);
+    const auto values = std::make_shared<Table>(target_table->column_definitions(), TableType::Data);
+    for (const auto& row : rows) {
+      values->append(row);
+    }
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    return !insert->execute_failed();
+  }
+
   std::shared_ptr<Table> _table;
   std::shared_ptr<Table> _table_nullable;
 };
@@ -90,6 +116,95 @@ TEST_F(TableKeyConstraintTest, AddKeyConstraintsInvalid) {
                std::logic_error);
 }
 
+TEST_F(TableKeyConstraintTest, AddEnforcedKeyConstraint) {
+  _table->append({1, 1, 1, 1});
+  _table->append({2, 1, 2, 2});
+
+  _table->add_key_constraint({{ColumnID{2}, ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  EXPECT_EQ(_table->soft_key_constraints().size(), 1);
+  ASSERT_EQ(_table->key_constraint_indexes().size(), 1);
+  EXPECT_EQ(_table->key_constraint_indexes().front(), _table->get_table_hash_index({ColumnID{0}, ColumnID{2}}));
+
+  // Invalid, because the existing rows violate the constraint
+  EXPECT_THROW(_table->add_key_constraint({{ColumnID{1}}, KeyConstraintType::UNIQUE}), std::logic_error);
+  EXPECT_EQ(_table->soft_key_constraints().size(), 1);
+  EXPECT_FALSE(_table->get_table_hash_index({ColumnID{1}}));
+
+  // An existing TableHashIndex is reused
+  const auto table_hash_index = _table->create_table_hash_index({ColumnID{3}});
+  _table->append({3, 2, 3, 3});
+  _table->add_key_constraint({{ColumnID{3}}, KeyConstraintType::UNIQUE});
+  EXPECT_EQ(_table->key_constraint_indexes().back(), table_hash_index);
+}
+
+TEST_F(TableKeyConstraintTest, EnforcedKeyConstraintOnInsert) {
+  _table->add_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+
+  {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    EXPECT_TRUE(insert("table", {{1, 0, 0, 0}, {2, 0, 0, 0}, {3, 0, 0, 0}}, transaction_context));
+    transaction_context->commit();
+  }
+
+  // Duplicate of a committed row
+  {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    EXPECT_FALSE(insert("table", {{4, 0, 0, 0}, {2, 0, 0, 0}}, transaction_context));
+    transaction_context->rollback(RollbackReason::Conflict);
+  }
+
+  // Duplicates within the inserted rows
+  {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    EXPECT_FALSE(insert("table", {{5, 0, 0, 0}, {5, 0, 0, 0}}, transaction_context));
+    transaction_context->rollback(RollbackReason::Conflict);
+  }
+
+  // Duplicate of an uncommitted row of a concurrent transaction
+  {
+    const auto transaction_context_a = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto transaction_context_b = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    EXPECT_TRUE(insert("table", {{6, 0, 0, 0}}, transaction_context_a));
+    EXPECT_FALSE(insert("table", {{6, 0, 0, 0}}, transaction_context_b));
+    transaction_context_b->rollback(RollbackReason::Conflict);
+    transaction_context_a->commit();
+  }
+
+  // Rows that were deleted (e.g., by an Update) can be replaced
+  {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    const auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::Equals, 1);
+    table_scan->execute();
+    const auto delete_op = std::make_shared<Delete>(table_scan);
+    delete_op->set_transaction_context(transaction_context);
+    delete_op->execute();
+
+    EXPECT_TRUE(insert("table", {{1, 1, 1, 1}}, transaction_context));
+    transaction_context->commit();
+  }
+
+  // Rolled back rows do not violate the constraint
+  {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    EXPECT_TRUE(insert("table", {{4, 0, 0, 0}, {5, 0, 0, 0}}, transaction_context));
+    transaction_context->commit();
+  }
+}
+
+TEST_F(TableKeyConstraintTest, EnforcedUniqueConstraintAllowsNulls) {
+  _table_nullable->add_key_constraint({{ColumnID{1}}, KeyConstraintType::UNIQUE});
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TRUE(insert("table_nullable", {{1, NullValue{}}, {2, NullValue{}}, {3, 3}}, transaction_context));
+  EXPECT_FALSE(insert("table_nullable", {{4, 3}}, transaction_context));
+  transaction_context->rollback(RollbackReason::Conflict);
+}
+
 TEST_F(TableKeyConstraintTest, Equals) {
   const auto key_constraint_a = TableKeyConstraint{{ColumnID{0}, ColumnID{2}}, KeyConstraintType::UNIQUE};
   const auto key_constraint_a_reordered = TableKeyConstraint{{ColumnID{2}, ColumnID{0}}, KeyConstraintType::UNIQUE};
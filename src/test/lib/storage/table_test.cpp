@@ -1,12 +1,18 @@
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "base_test.hpp"
 
 #include "resolve_type.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
 
@@ -274,4 +280,97 @@ TEST_F(StorageTableTest, StableChunks) {
   EXPECT_EQ((*(*first_chunk)->get_segment(ColumnID{0}))[0], AllTypeVariant{100});
 }
 
+TEST_F(StorageTableTest, CreateIndexOnQualifyingChunks) {
+  for (auto value = int32_t{0}; value < 5; ++value) {
+    t->append({value, "Hello"});
+  }
+  ChunkEncoder::encode_chunks(t, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  // The second chunk is not dictionary-encoded yet and the third chunk is still mutable
+  t->create_index<GroupKeyIndex>({ColumnID{0}});
+  ASSERT_EQ(t->indexes_statistics().size(), 1u);
+  EXPECT_TRUE(t->get_chunk(ChunkID{0})->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+  EXPECT_FALSE(t->get_chunk(ChunkID{1})->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+  EXPECT_FALSE(t->get_chunk(ChunkID{2})->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+
+  // Once the chunk is encoded, it is indexed as well, but only once
+  ChunkEncoder::encode_chunks(t, {ChunkID{1}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_EQ(t->get_chunk(ChunkID{1})->get_indexes(std::vector<ColumnID>{ColumnID{0}}).size(), 1u);
+  t->create_chunk_indexes(ChunkID{1});
+  EXPECT_EQ(t->get_chunk(ChunkID{1})->get_indexes(std::vector<ColumnID>{ColumnID{0}}).size(), 1u);
+
+  // BTreeIndexes do not require encoded segments
+  t->create_index<BTreeIndex>({ColumnID{1}});
+  EXPECT_TRUE(t->get_chunk(ChunkID{1})->get_index(SegmentIndexType::BTree, std::vector<ColumnID>{ColumnID{1}}));
+  EXPECT_FALSE(t->get_chunk(ChunkID{2})->get_index(SegmentIndexType::BTree, std::vector<ColumnID>{ColumnID{1}}));
+
+  // Thus, they are created when the chunk is finalized
+  t->append({5, "Hello"});
+  t->append({6, "Hello"});
+  EXPECT_TRUE(t->get_chunk(ChunkID{2})->get_index(SegmentIndexType::BTree, std::vector<ColumnID>{ColumnID{1}}));
+  EXPECT_FALSE(t->get_chunk(ChunkID{2})->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+  EXPECT_FALSE(t->get_chunk(ChunkID{3})->get_index(SegmentIndexType::BTree, std::vector<ColumnID>{ColumnID{1}}));
+}
+
+TEST_F(StorageTableTest, KeepColumnGroupStatisticsOnIncrementalUpdates) {
+  for (auto row_id = int32_t{0}; row_id < 20; ++row_id) {
+    t->append({row_id, "Hello"});
+  }
+  t->set_table_statistics(TableStatistics::from_table(*t));
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+  const auto column_group_statistics = t->column_group_statistics(column_ids);
+
+  // Adding a chunk updates the table statistics incrementally. The column group statistics are kept.
+  t->append({20, "World"});
+  t->append({21, "World"});
+  t->set_table_statistics(t->table_statistics()->updated(*t, {ChunkID{10}}));
+  EXPECT_GT(t->table_statistics()->added_row_count, 0.0f);
+  EXPECT_EQ(t->column_group_statistics(column_ids), column_group_statistics);
+
+  // Creating the table statistics anew drops them
+  t->set_table_statistics(TableStatistics::from_table(*t));
+  EXPECT_NE(t->column_group_statistics(column_ids), column_group_statistics);
+}
+
+TEST_F(StorageTableTest, InsertLanes) {
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  auto& insert_lane = table->insert_lane();
+  {
+    const auto lock = std::lock_guard<std::mutex>{insert_lane.mutex};
+    EXPECT_EQ(table->claim_mutable_tail(insert_lane), ChunkID{0});
+  }
+  EXPECT_EQ(table->mutable_tail_chunk_id(), ChunkID{0});
+
+  // Immutable chunks that are appended after the tail do not end it
+  const auto chunk = std::make_shared<Chunk>(
+      Segments{std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{1}),
+               std::make_shared<ValueSegment<pmr_string>>(pmr_vector<pmr_string>{"a"}, pmr_vector<bool>{false})},
+      std::make_shared<MvccData>(1, CommitID{0}));
+  chunk->finalize();
+  table->append_chunk(chunk);
+  {
+    const auto lock = std::lock_guard<std::mutex>{insert_lane.mutex};
+    EXPECT_EQ(table->claim_mutable_tail(insert_lane), ChunkID{0});
+  }
+  EXPECT_EQ(table->mutable_tail_chunk_ids(), std::vector<ChunkID>{ChunkID{0}});
+
+  if (std::thread::hardware_concurrency() < 2) GTEST_SKIP();
+
+  // Threads that use another lane insert into their own tail
+  auto other_tail_chunk_id = std::optional<ChunkID>{};
+  for (auto thread_count = 0; thread_count < 64 && !other_tail_chunk_id; ++thread_count) {
+    std::thread([&]() {
+      auto& other_insert_lane = table->insert_lane();
+      if (&other_insert_lane == &insert_lane) return;
+
+      const auto lock = std::lock_guard<std::mutex>{other_insert_lane.mutex};
+      other_tail_chunk_id = table->claim_mutable_tail(other_insert_lane);
+    }).join();
+  }
+  ASSERT_TRUE(other_tail_chunk_id);
+  EXPECT_EQ(*other_tail_chunk_id, ChunkID{2});
+  EXPECT_EQ(table->mutable_tail_chunk_id(), ChunkID{0});
+  EXPECT_EQ(table->mutable_tail_chunk_ids(), std::vector<ChunkID>({ChunkID{0}, ChunkID{2}}));
+}
+
 }  // namespace opossum
@@ -0,0 +1,256 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/chunk_maintenance_plugin.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class ChunkMaintenancePluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // 3 Rows, chunk_size = 4
+    _table = load_table("resources/test_data/tbl/int.tbl", 4u);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    // 10 Rows
+    Hyrise::get().storage_manager.add_table("source", load_table("resources/test_data/tbl/10_ints.tbl"));
+  }
+
+  void TearDown() override { Hyrise::reset(); }
+
+ protected:
+  std::shared_ptr<TransactionContext> _insert_source_rows() {
+    const auto get_table = std::make_shared<GetTable>("source");
+    get_table->execute();
+
+    const auto insert = std::make_shared<Insert>(_table_name, get_table);
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+
+    return transaction_context;
+  }
+
+  static std::vector<ChunkID> _finalize_completed_chunks(const std::shared_ptr<Table>& table) {
+    return ChunkMaintenancePlugin::_finalize_completed_chunks(table);
+  }
+
+  static bool _merge_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids) {
+    return ChunkMaintenancePlugin::_merge_chunks(table_name, chunk_ids);
+  }
+
+  static void _encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids) {
+    ChunkMaintenancePlugin::_encode_chunks(table, chunk_ids);
+  }
+
+  static void _erase_obsolete_index_entries(const std::shared_ptr<Table>& table) {
+    ChunkMaintenancePlugin::_erase_obsolete_index_entries(table);
+  }
+
+  const std::string _table_name{"chunkMaintenanceTestTable"};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkMaintenancePluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseChunkMaintenancePlugin"));
+  pm.unload_plugin("hyriseChunkMaintenancePlugin");
+}
+
+TEST_F(ChunkMaintenancePluginTest, TracksPendingInserts) {
+  const auto transaction_context = _insert_source_rows();
+
+  // Chunk 0 was finalized by load_table, chunks 1 and 2 are full, chunk 3 holds the remaining two rows.
+  ASSERT_EQ(_table->chunk_count(), 4);
+  for (auto chunk_id = ChunkID{1}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(_table->get_chunk(chunk_id)->mvcc_data()->pending_inserts_count(), 1);
+  }
+
+  transaction_context->commit();
+
+  for (auto chunk_id = ChunkID{1}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(_table->get_chunk(chunk_id)->mvcc_data()->pending_inserts_count(), 0);
+  }
+}
+
+TEST_F(ChunkMaintenancePluginTest, DoesNotFinalizeChunksWithPendingInserts) {
+  const auto transaction_context = _insert_source_rows();
+
+  EXPECT_TRUE(_finalize_completed_chunks(_table).empty());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+
+  transaction_context->commit();
+}
+
+TEST_F(ChunkMaintenancePluginTest, FinalizeCommittedChunks) {
+  _insert_source_rows()->commit();
+
+  EXPECT_EQ(_finalize_completed_chunks(_table), std::vector<ChunkID>({ChunkID{1}, ChunkID{2}}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->mvcc_data()->max_begin_cid);
+
+  // The last chunk is not full and can still receive new rows.
+  EXPECT_TRUE(_table->get_chunk(ChunkID{3})->is_mutable());
+
+  // Chunks are not finalized twice.
+  EXPECT_TRUE(_finalize_completed_chunks(_table).empty());
+}
+
+TEST_F(ChunkMaintenancePluginTest, FinalizeRolledBackChunks) {
+  _insert_source_rows()->rollback(RollbackReason::User);
+
+  EXPECT_EQ(_finalize_completed_chunks(_table), std::vector<ChunkID>({ChunkID{1}, ChunkID{2}}));
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->invalid_row_count(), 4);
+}
+
+TEST_F(ChunkMaintenancePluginTest, EncodeFinalizedChunks) {
+  _insert_source_rows()->commit();
+
+  const auto expected_rows = _table->get_rows();
+
+  const auto chunk_ids = _finalize_completed_chunks(_table);
+  _encode_chunks(_table, chunk_ids);
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_TRUE(chunk->pruning_statistics());
+    EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(ColumnID{0})).encoding_type, EncodingType::Dictionary);
+  }
+
+  EXPECT_EQ(_table->get_rows(), expected_rows);
+}
+
+TEST_F(ChunkMaintenancePluginTest, EncodeWithEncodingOfFirstChunk) {
+  ChunkEncoder::encode_chunk(_table->get_chunk(ChunkID{0}), _table->column_data_types(),
+                             SegmentEncodingSpec{EncodingType::RunLength});
+  _insert_source_rows()->commit();
+
+  const auto chunk_ids = _finalize_completed_chunks(_table);
+  _encode_chunks(_table, chunk_ids);
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto segment = _table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    EXPECT_EQ(get_segment_encoding_spec(segment).encoding_type, EncodingType::RunLength);
+  }
+}
+
+TEST_F(ChunkMaintenancePluginTest, MergeChunksOfTablesWithPrimaryKey) {
+  _table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  _insert_source_rows()->commit();
+
+  auto expected_rows = _table->get_rows();
+
+  const auto chunk_ids = _finalize_completed_chunks(_table);
+  ASSERT_EQ(chunk_ids, std::vector<ChunkID>({ChunkID{1}, ChunkID{2}}));
+  EXPECT_TRUE(_merge_chunks(_table_name, chunk_ids));
+
+  // The eight rows of chunks 1 and 2 are written to two new chunks sorted by the primary key.
+  ASSERT_EQ(_table->chunk_count(), 6);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->get_cleanup_commit_id());
+
+  auto merged_values = std::vector<AllTypeVariant>{};
+  for (auto chunk_id = ChunkID{4}; chunk_id < 6; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_EQ(chunk->individually_sorted_by().size(), 1);
+    const auto segment = chunk->get_segment(ColumnID{0});
+    EXPECT_EQ(get_segment_encoding_spec(segment).encoding_type, EncodingType::Dictionary);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      merged_values.emplace_back((*segment)[chunk_offset]);
+    }
+  }
+  EXPECT_EQ(merged_values, std::vector<AllTypeVariant>({1, 2, 4, 5, 23, 24, 25, 234}));
+
+  // The same rows are visible as before.
+  const auto get_table = std::make_shared<GetTable>(_table_name);
+  const auto validate = std::make_shared<Validate>(get_table);
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  get_table->set_transaction_context(transaction_context);
+  validate->set_transaction_context(transaction_context);
+  get_table->execute();
+  validate->execute();
+  auto visible_rows = validate->get_output()->get_rows();
+  std::sort(visible_rows.begin(), visible_rows.end());
+  std::sort(expected_rows.begin(), expected_rows.end());
+  EXPECT_EQ(visible_rows, expected_rows);
+
+  // Chunk 3 is not the last chunk anymore, but it remains the target of Inserts until it is full.
+  EXPECT_EQ(_table->mutable_tail_chunk_id(), ChunkID{3});
+  EXPECT_TRUE(_finalize_completed_chunks(_table).empty());
+
+  _insert_source_rows()->commit();
+  ASSERT_EQ(_table->chunk_count(), 8);
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->size(), 4);
+  EXPECT_EQ(_finalize_completed_chunks(_table), std::vector<ChunkID>({ChunkID{3}, ChunkID{6}, ChunkID{7}}));
+}
+
+TEST_F(ChunkMaintenancePluginTest, MergeChunksOfTablesWithoutPrimaryKey) {
+  _insert_source_rows()->commit();
+
+  const auto chunk_ids = _finalize_completed_chunks(_table);
+  ASSERT_EQ(chunk_ids, std::vector<ChunkID>({ChunkID{1}, ChunkID{2}}));
+  EXPECT_TRUE(_merge_chunks(_table_name, chunk_ids));
+
+  // Without a primary key, the rows keep their order
+  ASSERT_EQ(_table->chunk_count(), 6);
+  auto merged_values = std::vector<AllTypeVariant>{};
+  for (auto chunk_id = ChunkID{4}; chunk_id < 6; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(chunk->individually_sorted_by().empty());
+    const auto segment = chunk->get_segment(ColumnID{0});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      merged_values.emplace_back((*segment)[chunk_offset]);
+    }
+  }
+  EXPECT_EQ(merged_values, std::vector<AllTypeVariant>({1, 24, 234, 25, 23, 4, 2, 5}));
+}
+
+TEST_F(ChunkMaintenancePluginTest, EraseObsoleteIndexEntries) {
+  const auto table_hash_index = _table->create_table_hash_index({ColumnID{0}});
+  ASSERT_EQ(table_hash_index->size(), 3u);
+
+  {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+
+    const auto delete_op = std::make_shared<Delete>(validate);
+    delete_op->set_transaction_context(transaction_context);
+    delete_op->execute();
+    transaction_context->commit();
+  }
+
+  // The committing transaction could still see the deleted rows, so they were not removed from the index. Without
+  // further Deletes, they are removed by the plugin.
+  EXPECT_EQ(table_hash_index->pending_erasure_count(), 3u);
+  _erase_obsolete_index_entries(_table);
+  EXPECT_EQ(table_hash_index->pending_erasure_count(), 0u);
+  EXPECT_EQ(table_hash_index->size(), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/clustering_plugin.hpp"
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class ClusteringPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // 2000 rows in four chunks. Column b is a permutation of the values of column a, so that every chunk covers
+    // almost the entire value range of b.
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::Int, false);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 500, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 2000; ++value) {
+      _table->append({value, (value * 7) % 2000});
+    }
+    _table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  }
+
+  void TearDown() override { Hyrise::reset(); }
+
+ protected:
+  static std::shared_ptr<const Table> _execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    return pipeline.get_result_table().second;
+  }
+
+  void _update_scores() { _plugin._update_scores(); }
+
+  void _select_clustering_columns() { _plugin._select_clustering_columns(); }
+
+  bool _cluster_tables() { return _plugin._cluster_tables(); }
+
+  const auto& _scores() const { return _plugin._scores; }
+
+  auto& _clustering_columns() { return _plugin._clustering_columns; }
+
+  const std::string _table_name{"clusteringTestTable"};
+  const std::string _range_query{"SELECT * FROM clusteringTestTable WHERE b BETWEEN 100 AND 199"};
+  std::shared_ptr<Table> _table;
+  ClusteringPlugin _plugin;
+};
+
+TEST_F(ClusteringPluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseClusteringPlugin"));
+  pm.unload_plugin("hyriseClusteringPlugin");
+}
+
+TEST_F(ClusteringPluginTest, SelectsColumnOfPrunablePredicates) {
+  for (auto execution = 0; execution < 10; ++execution) {
+    _execute(_range_query);
+    _execute("SELECT * FROM clusteringTestTable WHERE a <> 5");
+  }
+
+  _update_scores();
+  ASSERT_EQ(_scores().size(), 1u);
+  EXPECT_GT(_scores().at({_table_name, ColumnID{1}}), ClusteringPlugin::MIN_SCORE);
+
+  _select_clustering_columns();
+  ASSERT_EQ(_clustering_columns().size(), 1u);
+  EXPECT_EQ(_clustering_columns().at(_table_name), ColumnID{1});
+
+  // A slightly better column does not replace the clustering column
+  for (auto execution = 0; execution < 11; ++execution) {
+    _execute("SELECT * FROM clusteringTestTable WHERE a BETWEEN 100 AND 199");
+  }
+  _update_scores();
+  _select_clustering_columns();
+  EXPECT_EQ(_clustering_columns().at(_table_name), ColumnID{1});
+}
+
+TEST_F(ClusteringPluginTest, ClustersScannedChunks) {
+  _clustering_columns().emplace(_table_name, ColumnID{1});
+
+  // The chunks have not been scanned yet, rewriting them is not worth it
+  EXPECT_FALSE(_cluster_tables());
+
+  for (auto execution = 0; execution < 10; ++execution) {
+    _execute(_range_query);
+  }
+  EXPECT_TRUE(_cluster_tables());
+
+  // The original chunks were removed, as no transaction can see them anymore. The new chunks are sorted by b and cover
+  // disjoint ranges.
+  ASSERT_EQ(_table->chunk_count(), 8u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{4}; ++chunk_id) {
+    EXPECT_FALSE(_table->get_chunk(chunk_id));
+  }
+  for (auto chunk_id = ChunkID{4}; chunk_id < ChunkID{8}; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    ASSERT_TRUE(chunk);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(chunk->pruning_statistics());
+    ASSERT_EQ(chunk->individually_sorted_by().size(), 1u);
+    EXPECT_EQ(chunk->individually_sorted_by().front(), SortColumnDefinition(ColumnID{1}));
+    const auto first_value = static_cast<int32_t>(chunk_id - 4) * 500;
+    EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[ChunkOffset{0}], AllTypeVariant{first_value});
+  }
+
+  // The clustered chunks are not rewritten again
+  EXPECT_FALSE(_cluster_tables());
+
+  const auto result = _execute(_range_query);
+  EXPECT_EQ(result->row_count(), 100u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,176 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/index_tuning_plugin.hpp"
+#include "hyrise.hpp"
+#include "operators/pqp_utils.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class IndexTuningPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // 2000 rows with distinct values in four chunks
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::Int, false);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 500);
+    for (auto value = int32_t{0}; value < 2000; ++value) {
+      _table->append({value, value % 2});
+    }
+    _table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  }
+
+  void TearDown() override { Hyrise::reset(); }
+
+ protected:
+  static std::shared_ptr<const Table> _execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.disable_mvcc().create_pipeline();
+    return pipeline.get_result_table().second;
+  }
+
+  void _update_scores() { _plugin._update_scores(); }
+
+  bool _tune_indexes(const size_t memory_budget) { return _plugin._tune_indexes(memory_budget); }
+
+  const auto& _scores() const { return _plugin._scores; }
+
+  static size_t _estimate_memory_consumption(const Table& table, const ColumnID column_id) {
+    return IndexTuningPlugin::_estimate_memory_consumption(table, column_id);
+  }
+
+  bool _has_index(const ChunkID chunk_id, const ColumnID column_id) const {
+    return static_cast<bool>(
+        _table->get_chunk(chunk_id)->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{column_id}));
+  }
+
+  const std::string _table_name{"indexTuningTestTable"};
+  const std::string _selective_query{"SELECT * FROM indexTuningTestTable WHERE a = 5"};
+  std::shared_ptr<Table> _table;
+  IndexTuningPlugin _plugin;
+};
+
+TEST_F(IndexTuningPluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseIndexTuningPlugin"));
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("IndexTuningPlugin.MemoryBudget"));
+  pm.unload_plugin("hyriseIndexTuningPlugin");
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("IndexTuningPlugin.MemoryBudget"));
+}
+
+TEST_F(IndexTuningPluginTest, ScoresOnlySelectivePredicates) {
+  for (auto execution = 0; execution < 10; ++execution) {
+    _execute(_selective_query);
+    _execute("SELECT * FROM indexTuningTestTable WHERE b = 1");
+  }
+
+  _update_scores();
+  ASSERT_EQ(_scores().size(), 1u);
+  const auto score = _scores().at({_table_name, ColumnID{0}});
+  EXPECT_GT(score, IndexTuningPlugin::MIN_SCORE);
+
+  // Only executions since the last run are counted
+  _update_scores();
+  EXPECT_DOUBLE_EQ(_scores().at({_table_name, ColumnID{0}}), score * IndexTuningPlugin::SCORE_DECAY);
+}
+
+TEST_F(IndexTuningPluginTest, CreateAndDropIndexes) {
+  for (auto execution = 0; execution < 10; ++execution) {
+    _execute(_selective_query);
+  }
+  _update_scores();
+
+  EXPECT_TRUE(_tune_indexes(std::numeric_limits<size_t>::max()));
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_TRUE(_has_index(chunk_id, ColumnID{0}));
+    EXPECT_FALSE(_has_index(chunk_id, ColumnID{1}));
+  }
+  ASSERT_EQ(_table->indexes_statistics().size(), 1u);
+  EXPECT_EQ(_table->indexes_statistics().front().column_ids, std::vector<ColumnID>{ColumnID{0}});
+
+  // Nothing changes without new queries
+  EXPECT_FALSE(_tune_indexes(std::numeric_limits<size_t>::max()));
+
+  // The next plan uses the index
+  Hyrise::get().default_pqp_cache->clear();
+  auto pipeline = SQLPipelineBuilder{_selective_query}.disable_mvcc().create_pipeline();
+  pipeline.get_result_table();
+  auto uses_index_scan = false;
+  visit_pqp(pipeline.get_physical_plans().front(), [&](const auto& op) {
+    uses_index_scan |= op->type() == OperatorType::IndexScan;
+    return PQPVisitation::VisitInputs;
+  });
+  EXPECT_TRUE(uses_index_scan);
+
+  // Without memory, the index is dropped. The cached plan still contains the IndexScan, which now scans the chunks.
+  EXPECT_TRUE(_tune_indexes(0));
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(_has_index(chunk_id, ColumnID{0}));
+  }
+  EXPECT_TRUE(_table->indexes_statistics().empty());
+
+  const auto result = _execute(_selective_query);
+  ASSERT_EQ(result->row_count(), 1u);
+  EXPECT_EQ(result->get_value<int32_t>(ColumnID{0}, 0), 5);
+}
+
+TEST_F(IndexTuningPluginTest, IndexesChunksEncodedLater) {
+  for (auto execution = 0; execution < 10; ++execution) {
+    _execute(_selective_query);
+  }
+  _update_scores();
+  EXPECT_TRUE(_tune_indexes(std::numeric_limits<size_t>::max()));
+
+  // The table indexes chunks that are encoded after the index was created, the plugin does not have to run again
+  for (auto value = int32_t{2000}; value < 2500; ++value) {
+    _table->append({value, value % 2});
+  }
+  _table->last_chunk()->finalize();
+  ChunkEncoder::encode_chunks(_table, {ChunkID{4}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_TRUE(_has_index(ChunkID{4}, ColumnID{0}));
+
+  EXPECT_FALSE(_tune_indexes(std::numeric_limits<size_t>::max()));
+  ASSERT_EQ(_table->indexes_statistics().size(), 1u);
+  EXPECT_EQ(_table->indexes_statistics().front().name, "IndexTuningPlugin");
+}
+
+TEST_F(IndexTuningPluginTest, KeepsUserIndexes) {
+  _table->create_index<GroupKeyIndex>({ColumnID{0}});
+  for (auto execution = 0; execution < 10; ++execution) {
+    _execute(_selective_query);
+  }
+  _update_scores();
+
+  EXPECT_FALSE(_tune_indexes(0));
+  EXPECT_FALSE(_tune_indexes(std::numeric_limits<size_t>::max()));
+  EXPECT_TRUE(_has_index(ChunkID{0}, ColumnID{0}));
+  EXPECT_EQ(_table->indexes_statistics().size(), 1u);
+}
+
+TEST_F(IndexTuningPluginTest, EstimateMemoryConsumption) {
+  // Each chunk has 500 distinct values in 500 rows
+  EXPECT_EQ(_estimate_memory_consumption(*_table, ColumnID{0}),
+            4 * AbstractIndex::estimate_memory_consumption(SegmentIndexType::GroupKey, 500, 500, 0));
+
+  // Mutable chunks are not indexed
+  _table->append({2000, 0});
+  EXPECT_EQ(_estimate_memory_consumption(*_table, ColumnID{0}),
+            4 * AbstractIndex::estimate_memory_consumption(SegmentIndexType::GroupKey, 500, 500, 0));
+}
+
+}  // namespace opossum
@@ -15,6 +15,8 @@
 #include "operators/table_scan.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_encoding_utils.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
@@ -64,6 +66,10 @@ class MvccDeletePluginTest : public BaseTest {
                                   std::shared_ptr<TransactionContext> transaction_context) {
     return MvccDeletePlugin::_try_logical_delete(table_name, chunk_id, transaction_context);
   }
+  static std::optional<size_t> _try_compaction(const std::string& table_name, const std::vector<ChunkID>& chunk_ids) {
+    auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    return MvccDeletePlugin::_try_compaction(table_name, chunk_ids, transaction_context);
+  }
   static void _delete_chunk_physically(const std::string& table_name, ChunkID chunk_id) {
     MvccDeletePlugin::_delete_chunk_physically(Hyrise::get().storage_manager.get_table(table_name), chunk_id);
   }
@@ -208,4 +214,61 @@ TEST_F(MvccDeletePluginTest, PhysicalDelete) {
   EXPECT_TRUE(table->get_chunk(chunk_to_delete_id) == nullptr);
 }
 
+/**
+ * This test checks that multiple sparse, immutable chunks are compacted into new, full, and encoded chunks within a
+ * single transaction.
+ */
+TEST_F(MvccDeletePluginTest, Compaction) {
+  // --- Expected: 1, 24, 234 | 25, 23, 4 | 2, 5, 234 | 234
+  const auto compaction_table_name = std::string{"compactionTestTable"};
+  const auto table = load_table("resources/test_data/tbl/10_ints.tbl", 3);
+  Hyrise::get().storage_manager.add_table(compaction_table_name, table);
+  ChunkEncoder::encode_chunk(table->get_chunk(ChunkID{0}), table->column_data_types(),
+                             SegmentEncodingSpec{EncodingType::RunLength});
+
+  // --- Expected: 1, _, _ | _, _, 4 | 2, 5, _ | _
+  {
+    const auto sql = "DELETE FROM " + compaction_table_name + " WHERE a > 20";
+    auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    (void)sql_pipeline.get_result_table();
+  }
+
+  const auto sparse_memory = table->get_chunk(ChunkID{0})->memory_usage(MemoryUsageCalculationMode::Sampled) +
+                             table->get_chunk(ChunkID{1})->memory_usage(MemoryUsageCalculationMode::Sampled) +
+                             table->get_chunk(ChunkID{2})->memory_usage(MemoryUsageCalculationMode::Sampled);
+  const auto saved_memory = _try_compaction(compaction_table_name, {ChunkID{0}, ChunkID{1}, ChunkID{2}});
+  ASSERT_TRUE(saved_memory);
+  EXPECT_LT(*saved_memory, sparse_memory);
+
+  // The row that does not fill a complete chunk is inserted into a new mutable chunk instead of a partial chunk.
+  // --- Expected: _, _, _ | _, _, _ | _, _, _ | _ | 5 | 1, 4, 2
+  EXPECT_EQ(table->chunk_count(), 6);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    EXPECT_TRUE(table->get_chunk(chunk_id)->get_cleanup_commit_id());
+  }
+  EXPECT_FALSE(table->get_chunk(ChunkID{3})->get_cleanup_commit_id());
+
+  EXPECT_EQ(table->get_chunk(ChunkID{4})->size(), 1);
+  EXPECT_TRUE(table->get_chunk(ChunkID{4})->is_mutable());
+  EXPECT_EQ(table->mutable_tail_chunk_id(), ChunkID{4});
+  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{4}, ColumnID{0}, ChunkOffset{0}), 5);
+
+  const auto& compacted_chunk = table->get_chunk(ChunkID{5});
+  EXPECT_EQ(compacted_chunk->size(), 3);
+  EXPECT_FALSE(compacted_chunk->is_mutable());
+  EXPECT_EQ(get_segment_encoding_spec(compacted_chunk->get_segment(ColumnID{0})).encoding_type,
+            EncodingType::RunLength);
+  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{5}, ColumnID{0}, ChunkOffset{0}), 1);
+  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{5}, ColumnID{0}, ChunkOffset{1}), 4);
+  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{5}, ColumnID{0}, ChunkOffset{2}), 2);
+
+  // --- Check whether GetTable filters out the compacted chunks
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  auto get_table = std::make_shared<GetTable>(compaction_table_name);
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 3);
+  EXPECT_EQ(get_table->get_output()->row_count(), 5);
+}
+
 }  // namespace opossum
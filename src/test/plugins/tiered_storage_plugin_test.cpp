@@ -0,0 +1,124 @@
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/tiered_storage_plugin.hpp"
+#include "hyrise.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class TieredStoragePluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // 10 rows in four chunks
+    _table = load_table("resources/test_data/tbl/10_ints.tbl", 3u);
+    ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    _directory = std::filesystem::temp_directory_path() / "hyrise_tiered_storage_plugin_test";
+    std::filesystem::create_directories(_directory);
+  }
+
+  void TearDown() override {
+    Hyrise::reset();
+    std::filesystem::remove_all(_directory);
+  }
+
+ protected:
+  static size_t _evict_cold_segments(const size_t memory_budget, const std::filesystem::path& directory) {
+    return TieredStoragePlugin::_evict_cold_segments(memory_budget, directory);
+  }
+
+  const std::string _table_name{"tieredStorageTestTable"};
+  std::shared_ptr<Table> _table;
+  std::filesystem::path _directory;
+};
+
+TEST_F(TieredStoragePluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseTieredStoragePlugin"));
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("TieredStoragePlugin.MemoryBudget"));
+  pm.unload_plugin("hyriseTieredStoragePlugin");
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("TieredStoragePlugin.MemoryBudget"));
+}
+
+TEST_F(TieredStoragePluginTest, MemoryBudgetSetting) {
+  auto setting = std::make_shared<TieredStoragePlugin::MemoryBudgetSetting>();
+  EXPECT_EQ(setting->memory_budget(), std::numeric_limits<size_t>::max());
+
+  setting->set("1000");
+  EXPECT_EQ(setting->get(), "1000");
+  EXPECT_EQ(setting->memory_budget(), 1000u);
+}
+
+TEST_F(TieredStoragePluginTest, NoEvictionWithinBudget) {
+  EXPECT_EQ(_evict_cold_segments(std::numeric_limits<size_t>::max(), _directory), 0u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_TRUE(_table->get_chunk(chunk_id)->segment_residency(ColumnID{0}).is_resident);
+  }
+}
+
+TEST_F(TieredStoragePluginTest, EvictColdSegments) {
+  const auto expected_rows = _table->get_rows();
+
+  // Access the segment of the first chunk so that it is the hottest one
+  const auto hot_segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  hot_segment->access_counter[SegmentAccessCounter::AccessType::Sequential] = 100;
+  const auto hot_segment_size = hot_segment->memory_usage(MemoryUsageCalculationMode::Sampled);
+
+  // The budget only fits the hottest segment
+  EXPECT_EQ(_evict_cold_segments(hot_segment_size, _directory), 3u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->segment_residency(ColumnID{0}).is_resident);
+  for (auto chunk_id = ChunkID{1}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto residency = _table->get_chunk(chunk_id)->segment_residency(ColumnID{0});
+    EXPECT_FALSE(residency.is_resident);
+    EXPECT_EQ(residency.eviction_count, 1);
+  }
+
+  // Evicted segments are loaded on access
+  EXPECT_EQ(_table->get_rows(), expected_rows);
+  for (auto chunk_id = ChunkID{1}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto residency = _table->get_chunk(chunk_id)->segment_residency(ColumnID{0});
+    EXPECT_TRUE(residency.is_resident);
+    EXPECT_EQ(residency.load_count, 1);
+  }
+}
+
+TEST_F(TieredStoragePluginTest, DoesNotEvictMutableOrUnencodedSegments) {
+  const auto mutable_table = load_table("resources/test_data/tbl/int.tbl", 10u, FinalizeLastChunk::No);
+  Hyrise::get().storage_manager.add_table("mutableTable", mutable_table);
+  const auto unencoded_table = load_table("resources/test_data/tbl/int.tbl");
+  Hyrise::get().storage_manager.add_table("unencodedTable", unencoded_table);
+
+  EXPECT_EQ(_evict_cold_segments(0, _directory), 4u);
+  EXPECT_TRUE(mutable_table->get_chunk(ChunkID{0})->segment_residency(ColumnID{0}).is_resident);
+  EXPECT_TRUE(unencoded_table->get_chunk(ChunkID{0})->segment_residency(ColumnID{0}).is_resident);
+}
+
+TEST_F(TieredStoragePluginTest, DoesNotEvictUnsupportedOrIndexedSegments) {
+  // The binary segment format does not support SIMD-BP128
+  const auto simd_bp128_table = load_table("resources/test_data/tbl/int.tbl");
+  ChunkEncoder::encode_all_chunks(simd_bp128_table,
+                                  SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128});
+  Hyrise::get().storage_manager.add_table("simdBp128Table", simd_bp128_table);
+
+  // Both segments are indexed by the composite index, even though only the first one is its prefix
+  const auto indexed_table = load_table("resources/test_data/tbl/int_int.tbl");
+  ChunkEncoder::encode_all_chunks(indexed_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  indexed_table->create_index<CompositeGroupKeyIndex>({ColumnID{0}, ColumnID{1}});
+  Hyrise::get().storage_manager.add_table("indexedTable", indexed_table);
+
+  EXPECT_EQ(_evict_cold_segments(0, _directory), 4u);
+  EXPECT_TRUE(simd_bp128_table->get_chunk(ChunkID{0})->segment_residency(ColumnID{0}).is_resident);
+  EXPECT_TRUE(indexed_table->get_chunk(ChunkID{0})->segment_residency(ColumnID{0}).is_resident);
+  EXPECT_TRUE(indexed_table->get_chunk(ChunkID{0})->segment_residency(ColumnID{1}).is_resident);
+}
+
+}  // namespace opossum